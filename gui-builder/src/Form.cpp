@@ -177,41 +177,41 @@ static void makePathsAbsolute(const std::unique_ptr<tgui::DataIO::Node>& node, c
     {
         if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image"))
         {
-            if (pair.second->value.empty() || pair.second->value.equalIgnoreCase(U"none") || pair.second->value.equalIgnoreCase(U"null") || pair.second->value.equalIgnoreCase(U"nullptr"))
+            if (pair.second->getValue().empty() || pair.second->getValue().equalIgnoreCase(U"none") || pair.second->getValue().equalIgnoreCase(U"null") || pair.second->getValue().equalIgnoreCase(U"nullptr"))
                 continue;
 
             // Skip absolute paths
-            if (pair.second->value[0] != '"')
+            if (pair.second->getValue()[0] != '"')
             {
 #ifdef TGUI_SYSTEM_WINDOWS
-                if ((pair.second->value[0] == '/') || (pair.second->value[0] == '\\') || ((pair.second->value.size() > 1) && (pair.second->value[1] == ':')))
+                if ((pair.second->getValue()[0] == '/') || (pair.second->getValue()[0] == '\\') || ((pair.second->getValue().size() > 1) && (pair.second->getValue()[1] == ':')))
 #else
-                if (pair.second->value[0] == '/')
+                if (pair.second->getValue()[0] == '/')
 #endif
                     continue;
             }
             else // The filename is between quotes
             {
-                if (pair.second->value.size() <= 1)
+                if (pair.second->getValue().size() <= 1)
                     continue;
 
 #ifdef TGUI_SYSTEM_WINDOWS
-                if ((pair.second->value[1] == '/') || (pair.second->value[1] == '\\') || ((pair.second->value.size() > 2) && (pair.second->value[2] == ':')))
+                if ((pair.second->getValue()[1] == '/') || (pair.second->getValue()[1] == '\\') || ((pair.second->getValue().size() > 2) && (pair.second->getValue()[2] == ':')))
 #else
-                if (pair.second->value[1] == '/')
+                if (pair.second->getValue()[1] == '/')
 #endif
                     continue;
             }
 
             tgui::String filename;
-            if (pair.second->value[0] != '"')
-                filename = pair.second->value;
+            if (pair.second->getValue()[0] != '"')
+                filename = pair.second->getValue();
             else
             {
                 // The filename is surrounded by quotes, with optional options behind it
-                const auto endQuotePos = pair.second->value.find('"', 1);
+                const auto endQuotePos = pair.second->getValue().find('"', 1);
                 assert(endQuotePos != tgui::String::npos);
-                filename = pair.second->value.substr(1, endQuotePos - 1);
+                filename = pair.second->getValue().substr(1, endQuotePos - 1);
             }
 
             // If the file can't be found anywhere then don't inject the file path
@@ -227,10 +227,10 @@ static void makePathsAbsolute(const std::unique_ptr<tgui::DataIO::Node>& node, c
 
             // Insert the path into the filename.
             // We can't just deserialize the value to get rid of the quotes as it may contain things behind the filename.
-            if (pair.second->value[0] != '"')
-                pair.second->value = pathToInject + '/' + pair.second->value;
+            if (pair.second->getValue()[0] != '"')
+                pair.second->setValue(pathToInject + '/' + pair.second->getValue());
             else // The filename is between quotes
-                pair.second->value = '"' + pathToInject + '/' + pair.second->value.substr(1);
+                pair.second->setValue('"' + pathToInject + '/' + pair.second->getValue().substr(1));
         }
     }
 
@@ -246,57 +246,61 @@ static void makePathsRelative(const std::unique_ptr<tgui::DataIO::Node>& node, c
     {
         if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image"))
         {
-            if (pair.second->value.empty() || pair.second->value.equalIgnoreCase(U"none") || pair.second->value.equalIgnoreCase(U"null") || pair.second->value.equalIgnoreCase(U"nullptr"))
+            if (pair.second->getValue().empty() || pair.second->getValue().equalIgnoreCase(U"none") || pair.second->getValue().equalIgnoreCase(U"null") || pair.second->getValue().equalIgnoreCase(U"nullptr"))
                 continue;
 
             // Skip paths that are already relative (this shouldn't happen)
-            if (pair.second->value[0] != '"')
+            if (pair.second->getValue()[0] != '"')
             {
 #ifdef TGUI_SYSTEM_WINDOWS
-                if ((pair.second->value[0] != '/') && (pair.second->value[0] != '\\') && ((pair.second->value.size() <= 1) || (pair.second->value[1] != ':')))
+                if ((pair.second->getValue()[0] != '/') && (pair.second->getValue()[0] != '\\') && ((pair.second->getValue().size() <= 1) || (pair.second->getValue()[1] != ':')))
 #else
-                if (pair.second->value[0] != '/')
+                if (pair.second->getValue()[0] != '/')
 #endif
                     continue;
             }
             else // The filename is between quotes
             {
-                if (pair.second->value.size() <= 1)
+                if (pair.second->getValue().size() <= 1)
                     continue;
 
 #ifdef TGUI_SYSTEM_WINDOWS
-                if ((pair.second->value[1] != '/') && (pair.second->value[1] != '\\') && ((pair.second->value.size() <= 2) || (pair.second->value[2] != ':')))
+                if ((pair.second->getValue()[1] != '/') && (pair.second->getValue()[1] != '\\') && ((pair.second->getValue().size() <= 2) || (pair.second->getValue()[2] != ':')))
 #else
-                if (pair.second->value[1] != '/')
+                if (pair.second->getValue()[1] != '/')
 #endif
                     continue;
             }
 
             tgui::String filename;
-            if (pair.second->value[0] != '"')
-                filename = pair.second->value;
+            if (pair.second->getValue()[0] != '"')
+                filename = pair.second->getValue();
             else
             {
                 // The filename is surrounded by quotes, with optional options behind it
-                const auto endQuotePos = pair.second->value.find('"', 1);
+                const auto endQuotePos = pair.second->getValue().find('"', 1);
                 assert(endQuotePos != tgui::String::npos); // DataIO wouldn't have accepted the file if there is no close quote
-                filename = pair.second->value.substr(1, endQuotePos - 1);
+                filename = pair.second->getValue().substr(1, endQuotePos - 1);
             }
 
             // Make the path relative to the form or gui builder
             if (filename.startsWith(formPath))
             {
-                if (pair.second->value[0] != '"')
-                    pair.second->value.erase(0, formPath.length());
+                tgui::String value = pair.second->getValue();
+                if (value[0] != '"')
+                    value.erase(0, formPath.length());
                 else
-                    pair.second->value.erase(1, formPath.length());
+                    value.erase(1, formPath.length());
+                pair.second->setValue(std::move(value));
             }
             else if (filename.startsWith(guiBuilderPath))
             {
-                if (pair.second->value[0] != '"')
-                    pair.second->value.erase(0, guiBuilderPath.length());
+                tgui::String value = pair.second->getValue();
+                if (value[0] != '"')
+                    value.erase(0, guiBuilderPath.length());
                 else
-                    pair.second->value.erase(1, guiBuilderPath.length());
+                    value.erase(1, guiBuilderPath.length());
+                pair.second->setValue(std::move(value));
             }
             else // We will need to use ".." if we want to make the path relative
             {
@@ -360,16 +364,10 @@ static void makePathsRelative(const std::unique_ptr<tgui::DataIO::Node>& node, c
 
                             if (filename.startsWith(basePathStr))
                             {
-                                if (pair.second->value[0] != '"')
-                                {
-                                    pair.second->value.erase(0, basePathStr.length());
-                                    pair.second->value = relativePath + pair.second->value;
-                                }
+                                if (pair.second->getValue()[0] != '"')
+                                    pair.second->setValue(relativePath + pair.second->getValue().substr(basePathStr.length()));
                                 else
-                                {
-                                    pair.second->value.erase(0, basePathStr.length() + 1);
-                                    pair.second->value = U'"' + relativePath + pair.second->value;
-                                }
+                                    pair.second->setValue(U'"' + relativePath + pair.second->getValue().substr(basePathStr.length() + 1));
                             }
                             else
                                 std::cerr << "Failed to make path relative. '" + filename + "' does not start with '" + basePathStr + "'." << std::endl;
@@ -875,11 +873,8 @@ void Form::load()
     if (!fileContents)
         throw tgui::Exception("Failed to open '" + filename + "'.");
 
-    /// TODO: Optimize this (DataIO::parse function should be able to use a string view directly on file contents)
-    std::stringstream inStream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-
     // Parse the file from memory
-    auto rootNode = tgui::DataIO::parse(inStream);
+    auto rootNode = tgui::DataIO::parse(reinterpret_cast<const char*>(fileContents.get()), fileSize);
 
     // If the file was created with TGUI 0.8 then convert it into a valid TGUI 0.9/0.10 form
     importOldForm(rootNode);
@@ -67,7 +67,7 @@ static const float EDIT_BOX_HEIGHT = 24;
 
 namespace
 {
-    bool compareRenderers(std::map<tgui::String, tgui::ObjectConverter> themePropertyValuePairs, std::map<tgui::String, tgui::ObjectConverter> widgetPropertyValuePairs)
+    bool compareRenderers(tgui::PropertyValueMap themePropertyValuePairs, tgui::PropertyValueMap widgetPropertyValuePairs)
     {
         for (auto themeIt = themePropertyValuePairs.begin(); themeIt != themePropertyValuePairs.end(); ++themeIt)
         {
@@ -449,7 +449,7 @@ bool GuiBuilder::loadGuiBuilderState()
     {
         if (node->propertyValuePairs["FormSize"])
         {
-            const auto& size = node->propertyValuePairs["FormSize"]->value;
+            const auto& size = node->propertyValuePairs["FormSize"]->getValue();
             m_formSize = parseSize(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, size).getString());
         }
 
@@ -483,7 +483,7 @@ bool GuiBuilder::loadGuiBuilderState()
 
     if (node->propertyValuePairs["DefaultPath"])
     {
-        m_defaultPath = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, node->propertyValuePairs["DefaultPath"]->value).getString();
+        m_defaultPath = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, node->propertyValuePairs["DefaultPath"]->getValue()).getString();
         if (!m_defaultPath.empty() && (m_defaultPath[m_defaultPath.length()-1] != '/') && (m_defaultPath[m_defaultPath.length()-1] != '\\'))
             m_defaultPath += '/';
     }
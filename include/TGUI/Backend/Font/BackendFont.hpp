@@ -31,6 +31,8 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -194,6 +196,23 @@ namespace tgui
         bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widths of all parts of a word, using a cache so that each word only has to be measured once
+        ///
+        /// @param word           Pointer to the first character of the word
+        /// @param length         Amount of characters in the word, which has to be at least 1
+        /// @param characterSize  Size of the characters
+        /// @param bold           Is the word printed in bold?
+        ///
+        /// @return List containing for each character in the word the width from the start of the word up to that character.
+        ///         The last element is thus the width of the entire word. The reference remains valid until the next call.
+        ///
+        /// The width is the sum of the advances of the characters, including the kerning between them.
+        /// The kerning between the first character and whatever precedes the word is not included.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<float>& getWordPrefixWidths(const char32_t* word, std::size_t length, unsigned int characterSize, bool bold);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -217,6 +236,16 @@ namespace tgui
     protected:
 
         bool m_isSmooth = true;
+
+        // Cached measurements of words, indexed by a hash of the word, character size and bold flag
+        struct CachedWordWidths
+        {
+            std::u32string word;
+            unsigned int characterSize;
+            bool bold;
+            std::vector<float> prefixWidths;
+        };
+        std::unordered_multimap<std::uint64_t, CachedWordWidths> m_wordWidthsCache;
     };
 }
 
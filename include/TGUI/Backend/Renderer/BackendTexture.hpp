@@ -29,6 +29,7 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/String.hpp>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +42,46 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines what the load function keeps in memory after the pixels have been uploaded to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelStorage
+        {
+            Full,     ///< All RGBA pixels are kept, so that getPixels can return them (default)
+            AlphaMask ///< Only a single bit per pixel is kept for isTransparentPixel, getPixels will return nullptr
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Block compression formats that can be passed to loadCompressed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class CompressedFormat
+        {
+            BC1_RGB,    ///< S3TC DXT1 without alpha (8 bytes per 4x4 block)
+            BC1_RGBA,   ///< S3TC DXT1 with 1-bit alpha (8 bytes per 4x4 block)
+            BC2,        ///< S3TC DXT3 (16 bytes per 4x4 block)
+            BC3,        ///< S3TC DXT5 (16 bytes per 4x4 block)
+            BC7,        ///< BPTC (16 bytes per 4x4 block)
+            ETC2_RGB,   ///< ETC2 without alpha (8 bytes per 4x4 block)
+            ETC2_RGBA1, ///< ETC2 with 1-bit alpha (8 bytes per 4x4 block)
+            ETC2_RGBA   ///< ETC2 with EAC alpha (16 bytes per 4x4 block)
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Block compressed image data, which doesn't own the memory that it points to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct CompressedImage
+        {
+            struct Level
+            {
+                const std::uint8_t* data = nullptr;
+                std::size_t dataSize = 0;
+            };
+
+            CompressedFormat format = CompressedFormat::BC1_RGB;
+            Vector2u size;
+            std::vector<Level> levels; ///< Level 0 is the full image, every next level is half the size of the previous one
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +98,45 @@ namespace tgui
         bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what is kept in memory for textures that are loaded afterwards
+        ///
+        /// @param pixelStorage  Whether the load function should keep the full pixels or only whether each pixel is transparent
+        ///
+        /// Keeping only the alpha mask uses 32 times less memory per texture. Transparent pixels can still be ignored by
+        /// widgets, but textures without a filename can no longer be saved to a form file, as their pixels are unknown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setPixelStorage(PixelStorage pixelStorage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what is kept in memory for textures that are loaded
+        ///
+        /// @return Whether the load function keeps the full pixels or only whether each pixel is transparent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static PixelStorage getPixelStorage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether smooth textures that are loaded afterwards will have mipmaps
+        ///
+        /// @param enabled  Should mipmaps be generated when loading a texture with the smooth filter enabled?
+        ///
+        /// Mipmaps improve the quality of images that are drawn much smaller than their original size, at the cost of using
+        /// a third more video memory per texture. Only the OpenGL and SFML renderers support mipmaps, and OpenGL ES 2 only
+        /// supports them for images with power-of-two sizes. Mipmaps are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMipmapsEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether smooth textures will have mipmaps
+        ///
+        /// @return Are mipmaps generated when loading a texture with the smooth filter enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getMipmapsEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the texture from an array of 32-bits RGBA pixels, but don't take ownership of the pixels
         ///
@@ -69,6 +149,20 @@ namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from block compressed data that can be uploaded to the graphics card as-is
+        ///
+        /// @param image  Compressed image, the memory it points to only has to remain valid during this call
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True if the texture was created, false if the backend or graphics driver doesn't support the format
+        ///
+        /// The pixels of the image aren't known, so isTransparentPixel will always return false for a compressed texture.
+        /// The default implementation returns false, only the OpenGL renderers support compressed textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadCompressed(const CompressedImage& image, bool smooth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -106,6 +200,8 @@ namespace tgui
         /// @brief Returns a pointer to the pixels (read-only)
         ///
         /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if the pixel data isn't stored.
+        ///
+        /// @see setPixelStorage
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::uint8_t* getPixels() const;
 
@@ -115,7 +211,11 @@ namespace tgui
 
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::unique_ptr<std::uint8_t[]> m_alphaMask; // One bit per pixel, set when the pixel isn't transparent
         bool m_isSmooth = true;
+
+        static PixelStorage m_pixelStorage;
+        static bool m_mipmapsEnabled;
     };
 }
 
@@ -57,6 +57,19 @@ namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from block compressed data that can be uploaded to the graphics card as-is
+        ///
+        /// @param image  Compressed image, the memory it points to only has to remain valid during this call
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True if the texture was created, false if the graphics driver doesn't support the format
+        ///
+        /// The mipmaps stored in the image are only used when mipmaps are enabled and the image contains all levels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadCompressed(const CompressedImage& image, bool smooth) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -72,10 +85,20 @@ namespace tgui
         unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the OpenGL texture has mipmaps
+        /// @return Was the texture created with mipmaps?
+        ///
+        /// @see setMipmapsEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasMipmaps() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         unsigned int m_textureId = 0;
+        bool m_hasMipmaps = false;
     };
 }
 
@@ -27,6 +27,7 @@
 #define TGUI_OPENGL_HPP
 
 #include <TGUI/Config.hpp>
+#include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
@@ -53,6 +54,12 @@ namespace tgui
     namespace priv
     {
         void checkAndLogErrorOpenGL(const char* file, unsigned int line, const char* expression);
+
+        // Returns the amount of levels in a full mipmap chain for a texture of the given size
+        unsigned int getMipmapLevelCountOpenGL(Vector2u size);
+
+        // Returns the internal format for glCompressedTexImage2D, or 0 when the driver doesn't support the format
+        GLenum getCompressedFormatOpenGL(BackendTexture::CompressedFormat format);
     }
 }
 
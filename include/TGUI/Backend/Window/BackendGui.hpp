@@ -31,6 +31,7 @@
 #include <TGUI/RelFloatRect.hpp>
 #include <TGUI/Event.hpp>
 #include <TGUI/Cursor.hpp>
+#include <TGUI/Optional.hpp>
 #include <chrono>
 #include <stack>
 
@@ -549,6 +550,25 @@ namespace tgui
         void setDrawingUpdatesTime(bool drawUpdatesTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the minimum time between two frames that are drawn by the mainLoop function
+        ///
+        /// @param frameTime  Minimum duration between the start of two frames (default is 35 milliseconds)
+        ///
+        /// The main loop only draws when the screen changed, this setting only limits how often that happens during e.g. an
+        /// animation. If the window uses vsync then you can set the frame time to 0 and let the display limit the framerate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMinimumFrameTime(Duration frameTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the minimum time between two frames that are drawn by the mainLoop function
+        ///
+        /// @return Minimum duration between the start of two frames
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Duration getMinimumFrameTime() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Updates the internal clock (for timers, animations and blinking edit cursors)
         ///
@@ -569,6 +589,25 @@ namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds a widget to the list of widgets on which updateTime is called
+        ///
+        /// The widget is removed from the list again once its isUpdateTimeRequired function returns false.
+        /// This function is called by the widget itself, you should not call it directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void registerTimeUpdates(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Removes a widget from the list of widgets on which updateTime is called
+        ///
+        /// This function is called when the widget is removed from the gui, you should not call it directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unregisterTimeUpdates(Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Converts the pixel coordinate to a position within the view
@@ -601,6 +640,13 @@ namespace tgui
         virtual void updateContainerSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long the main loop can wait for events before the time has to be updated or the screen has to be drawn.
+        // An empty value is returned when nothing changes until the next event arrives, in which case the main loop can block.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getMainLoopWaitTime(bool refreshRequired, std::chrono::steady_clock::time_point lastRenderTime) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -613,6 +659,10 @@ namespace tgui
         std::chrono::steady_clock::time_point m_lastUpdateTime;
         bool m_windowFocused = true;
 
+        // Widgets that need their time to be updated, e.g. because they are playing an animation
+        std::vector<Widget*> m_timeUpdateWidgets;
+        bool m_updatingTime = false;
+
         RootContainer::Ptr m_container = nullptr;
 
         Widget::Ptr m_visibleToolTip = nullptr;
@@ -627,6 +677,7 @@ namespace tgui
         FloatRect m_lastView;
 
         bool m_drawUpdatesTime = true;
+        Duration m_minimumFrameTime = std::chrono::milliseconds(35);
         bool m_tabKeyUsageEnabled = true;
 
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
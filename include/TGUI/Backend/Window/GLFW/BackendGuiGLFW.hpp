@@ -225,6 +225,7 @@ namespace tgui
     protected:
 
         GLFWwindow* m_window = nullptr;
+        bool m_eventProcessed = false; // Set when one of the callbacks changed the gui, used by mainLoop to know when to draw
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
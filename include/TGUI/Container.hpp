@@ -29,6 +29,7 @@
 #include <TGUI/Widget.hpp>
 
 #include <list>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +105,8 @@ namespace tgui
         ///
         /// @return Vector of all widget pointers
         ///
+        /// @warning Widgets that are still waiting to be created because of lazy loading aren't part of the list
+        /// @see setLazyLoadingEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<Widget::Ptr>& getWidgets() const
         {
@@ -122,6 +125,7 @@ namespace tgui
         void sortWidgets(Function&& function)
         {
             std::sort(m_widgets.begin(), m_widgets.end(), std::forward<Function>(function));
+            m_spatialIndexOutdated = true;
         }
 
 
@@ -287,6 +291,29 @@ namespace tgui
         std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree(const String& rootDirectory = "") const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether invisible containers that are loaded afterwards only create their child widgets when needed
+        ///
+        /// @param enabled  Should creating the widgets inside invisible containers be delayed while loading widgets from a file?
+        ///
+        /// When enabled, a Panel, Group, ScrollablePanel, RadioButtonGroup or ChildWindow that is invisible after loading keeps
+        /// the nodes of its child widgets instead of creating them. They are created the first time the container is made
+        /// visible, or when get is called with the name of a widget inside it. This speeds up loading forms with many hidden
+        /// pages, e.g. the panels of a TabContainer. Invisible containers inside such a container are again only loaded when needed.
+        /// Until they are created, the widgets aren't returned by getWidgets.
+        /// Lazy loading is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLazyLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether invisible containers only create their child widgets when needed
+        ///
+        /// @return Is creating the widgets inside invisible containers delayed while loading widgets from a file?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getLazyLoadingEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets, to the front of the z-order
         ///
@@ -386,6 +413,54 @@ namespace tgui
         virtual Widget::Ptr getWidgetAtPosition(Vector2f pos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget that is located below the mouse
+        ///
+        /// @param enabled  Should the container keep track of which grid cells are covered by each child widget?
+        ///
+        /// Without the index, every mouse event checks the child widgets one by one until the widget below the mouse is found.
+        /// With the index, only the widgets that overlap with the grid cell below the mouse are checked, which is a lot faster
+        /// when the container has a large amount of children. Rotated or scaled widgets and widgets that are larger than the
+        /// cells allow are still checked one by one.
+        ///
+        /// The index assumes that the mouse can only be on top of a child widget when it is located inside the rectangle given
+        /// by the position, origin, widget offset and full size of that widget.
+        ///
+        /// The spatial index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget that is located below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of the cells in the spatial index
+        ///
+        /// @param cellSize  Size of the grid cells, which should be close to the size of a typical child widget
+        ///
+        /// The default cell size is 100.
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of the cells in the spatial index
+        ///
+        /// @return Size of the grid cells
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getSpatialIndexCellSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -419,6 +494,15 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides the container
+        /// @param visible  Is the container visible?
+        ///
+        /// Showing the container creates the child widgets that were still waiting to be loaded because of lazy loading.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Inform the container about a mouse move event
         /// @param pos  Mouse position
@@ -477,6 +561,34 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size, origin, scale or rotation of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a widget is added to this container, right after the parent of the widget was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetAttached(Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a widget is removed from this container, right before the parent of the widget is changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetDetached(Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the name of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetRenamed(Widget* child, const String& oldName);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +657,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // This function is called every frame with the time passed since the last frame.
+        // The child widgets are only updated here when the container isn't part of a gui, otherwise the gui updates them.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
@@ -603,6 +716,39 @@ namespace tgui
         void updateTextSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets may still be created after the load function returned
+        ///
+        /// Containers that access their child widgets while loading, or that aren't used as pages, should return false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool canLoadWidgetsLazily() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates and loads child widgets from their nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the child widgets of which the loading was delayed because the container was invisible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadLazyWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the delayed widgets in this container and all containers inside it, or only in the containers where a
+        // widget with the given name is waiting to be created. Returns whether any widgets were created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadLazyWidgetsInTree(const String& widgetName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the delayed widgets that could contain a widget with the given name, as a last resort when get didn't find it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getLazyLoadedWidget(const String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -617,6 +763,36 @@ namespace tgui
         Widget::Ptr updateWidgetBelowMouse(Vector2f mousePos);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the topmost container, which keeps the name index of all widgets in the tree
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Container* getRootContainer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget and all widgets inside it to the name index of this root container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToDescendantNameIndex(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget and all widgets inside it from the name index of this root container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromDescendantNameIndex(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the spatial index from scratch, after widgets were added, removed or reordered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget at the given index in m_widgets to the spatial index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToSpatialIndex(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -668,6 +844,35 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Location of a child widget in the spatial index
+        struct SpatialIndexEntry
+        {
+            std::size_t index = 0; // Index of the widget in m_widgets
+            bool inGrid = false; // Is the widget stored in the grid cells or in m_spatialIndexUngriddedWidgets?
+            int left = 0; // Grid cells that are covered by the widget, only used when inGrid is true
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+        };
+
+        bool m_spatialIndexEnabled = false;
+        float m_spatialIndexCellSize = 100;
+        mutable bool m_spatialIndexOutdated = true; // The index is rebuilt when needed after widgets are added, removed or reordered
+        mutable std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_spatialIndexCells; // Indices of widgets per grid cell
+        mutable std::unordered_map<const Widget*, SpatialIndexEntry> m_spatialIndexEntries;
+        mutable std::vector<std::size_t> m_spatialIndexUngriddedWidgets; // Indices of widgets that have to be checked one by one
+
+        std::unordered_map<String, std::vector<Widget*>> m_childNameIndex; // Named direct children of this container
+        std::unordered_map<String, std::vector<Widget*>> m_descendantNameIndex; // Named widgets in the entire tree, only used in the root container
+        std::size_t m_subwidgetContainerCount = 0; // Amount of SubwidgetContainer widgets in the tree, only used in the root container
+
+        // Child widgets that weren't created yet because the container was invisible when it was loaded
+        std::vector<std::unique_ptr<DataIO::Node>> m_lazyWidgetNodes;
+        LoadingRenderersMap m_lazyWidgetRenderers;
+        Theme::Ptr m_lazyWidgetTheme; // Default theme while the container was loaded, which the delayed widgets are created with
+
+        static bool m_lazyLoadingEnabled;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -182,6 +182,20 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether updateTime has to be called. This is always the case since the update function is user-defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the time until updateTime has to be called, which is every frame since the update function is user-defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
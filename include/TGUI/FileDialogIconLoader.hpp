@@ -68,6 +68,14 @@ namespace tgui
         virtual bool update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a background thread is still busy, i.e. whether update() still has to be called
+        ///
+        /// @return True until update() has reported the result of the last thread that was started
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether this icon loader does something or whether its functions are no-ops
         ///
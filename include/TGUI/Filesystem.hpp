@@ -27,6 +27,7 @@
 #define TGUI_FILESYSTEM_HPP
 
 #include <TGUI/String.hpp>
+#include <functional>
 #include <cstdint>
 #include <vector>
 #include <ctime>
@@ -375,6 +376,48 @@ namespace tgui
         /// @return List of files (including directories) that are found within the given path
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static std::vector<FileInfo> listFilesInDirectory(const Path& path);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lists the files and folders inside a given directory, passing each of them to a callback as soon as found
+        ///
+        /// @param path             Path in which all directories and files should be listed
+        /// @param callback         Function that is called for each file, the listing is aborted when it returns false
+        /// @param directoriesOnly  Should only the directories be listed?
+        /// @param updateCache      Should the result be stored in the directory listing cache when all files were listed?
+        ///
+        /// @return False if the listing was aborted by the callback, true otherwise
+        ///
+        /// This function can be called from a different thread than the one running the gui.
+        /// When only directories are requested then the file type that is returned by the directory listing is used when
+        /// available, so that the other files can be skipped without querying their size and modification time.
+        /// The cache is never updated when only directories are listed.
+        ///
+        /// @see getCachedFilesInDirectory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool listFilesInDirectory(const Path& path, const std::function<bool(FileInfo&&)>& callback, bool directoriesOnly = false, bool updateCache = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the files and folders inside a directory from the directory listing cache
+        ///
+        /// @param path   Path of the directory that was listed earlier
+        /// @param files  Vector that will be filled with the files when the function returns true
+        ///
+        /// @return True when the directory was cached and hasn't been changed since it was listed, false otherwise
+        ///
+        /// The cache only contains directories that were listed by calling listFilesInDirectory with updateCache set to true.
+        /// On Linux, inotify is used to find out whether anything changed inside the directory. On other platforms (or when
+        /// inotify isn't available), the modification time of the directory is compared instead, which detects files being
+        /// added, removed or renamed but not a change in size or modification time of the files themselves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getCachedFilesInDirectory(const Path& path, std::vector<FileInfo>& files);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all directories from the directory listing cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearDirectoryListingCache();
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,9 +29,11 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Vector2.hpp>
 #include <type_traits>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -123,7 +125,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -152,14 +154,6 @@ namespace tgui
         ~Layout();
 
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Replaces the value of the layout without overwriting its parent
-        ///
-        /// @param value  New value of the layout
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void replaceValue(const Layout& value);
-
-
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Return the cached value of the layout
         ///
@@ -178,7 +172,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return m_steps.empty();
         }
 
 
@@ -204,30 +198,43 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  Widget that is being destroyed
+        ///
+        /// The layout doesn't inform the widget that it is no longer bound, the widget is expected to forget about the layout.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout based on the operations it contains
+        ///
+        /// If the layout is connected to a widget then it is scheduled to be recalculated by the next layout pass instead.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns a pointer to the left operand (or nullptr if this layout does not store an operation on two operands)
+        /// @brief Postpones recalculating the layouts of widgets until endDeferredUpdates is called
+        ///
+        /// Changes to the position or size of widgets normally cause the layouts that depend on them to be recalculated before
+        /// the function that made the change returns. Between a call to this function and the matching endDeferredUpdates call,
+        /// the affected layouts are only marked as outdated. They are recalculated once the outermost endDeferredUpdates call is
+        /// made, in the order of their dependencies so that each layout is recalculated only once.
+        /// The gui uses this to recalculate all layouts in a single pass when the window is resized and when widgets are animated.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Layout* getLeftOperand() const;
+        static void beginDeferredUpdates();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns a pointer to the right operand (or nullptr if this layout does not store an operation on two operands)
+        /// @brief Recalculates all layouts that became outdated since beginDeferredUpdates was called
+        ///
+        /// Calls to beginDeferredUpdates and endDeferredUpdates can be nested, the layouts are only recalculated by the outermost call.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Layout* getRightOperand() const;
+        static void endDeferredUpdates();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,41 +242,100 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Informs the bound widgets that the layout no longer binds them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tells the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the steps of an operand to the end of the steps of this layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendSteps(const Layout& operand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Find the widget corresponding to the given name and bind it to the step if found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseBindingString(std::size_t stepIndex, const String& expression, Widget* widget, bool xAxis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the steps to calculate the value of the layout. The values of bindings are remembered in the steps.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        float calculateValue();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Converts the sub-expression that ends with the given step to a string
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        String stepToString(std::size_t stepIndex, const std::vector<std::size_t>& rightOperandStarts) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Returns whether the layout is connected to a widget, in which case it is recalculated by layout passes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const String& expression, Widget* widget, bool xAxis);
+        bool isConnected() const
+        {
+            return m_connectedWidgetCallback && m_connectedWidget;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the connected layouts of other widgets that depend on the value of this connected layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getDependentRoots(std::vector<Layout*>& dependents) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks a connected layout as outdated and recalculates it immediately unless updates are being deferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void scheduleUpdate(Layout* root);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates all outdated layouts in the order of their dependencies
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void processScheduledUpdates();
+
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Restores the state of the layout updates when recalculating the layouts is interrupted by an exception
+        struct UpdatePassGuard;
+
+        // State of the layout while the layouts of a pass are being sorted by their dependencies
+        enum class VisitState : std::uint8_t
+        {
+            Unvisited,
+            OnStack,
+            Sorted
+        };
+
+        // Single step of the layout. The steps are executed in postfix order, operations pop their operands
+        // from a small stack of values and push their result back on it.
+        struct Step
+        {
+            Operation operation;
+            float value; // Value of a constant, or the last known value of a binding
+            Widget* widget; // The widget on which this step depends in case the operation is a binding
+            String boundString; // String referring to a widget in case the step was created from a string and contains a binding operation
+        };
+
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::vector<Step> m_steps; // Steps to calculate the value, empty when the layout is a constant
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout isn't a constant
+        Widget* m_connectedWidget = nullptr; // Widget of which this layout is the position or size
+        bool m_updateScheduled = false; // Is the layout waiting to be recalculated by the next layout pass?
+        bool m_updatePending = false; // Is the layout part of the layout pass that is being executed and not recalculated yet?
+        VisitState m_updateVisitState = VisitState::Unvisited;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
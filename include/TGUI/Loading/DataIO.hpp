@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/String.hpp>
+#include <TGUI/ObjectConverter.hpp>
 #include <sstream>
 #include <memory>
 #include <vector>
@@ -66,11 +67,49 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         struct ValueNode
         {
-            ValueNode(const String& v = "") : value(v) {}
+            ValueNode(const String& v = "") : m_value(v) {}
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value as it is written in the text format
+            ///
+            /// When the binary parser stored a deserialized value in the node, the string is only created on the first call.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const String& getValue() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the value as it is written in the text format
+            ///
+            /// The deserialized value is removed, as it no longer matches the new value.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setValue(String value);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value that the binary parser already deserialized
+            ///
+            /// @return Deserialized value, or an object of type None if the type of the value wasn't known while parsing
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const ObjectConverter& getDeserializedValue() const
+            {
+                return m_deserializedValue;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stores a deserialized value in the node, without creating the string for it yet
+            ///
+            /// @param value          Deserialized value
+            /// @param valueToString  Function that getValue will call to create the string from the deserialized value
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setDeserializedValue(ObjectConverter value, String (*valueToString)(ObjectConverter));
 
-            String value;
             bool listNode = false;
             std::vector<String> valueList;
+
+        private:
+            mutable String m_value;
+            ObjectConverter m_deserializedValue;
+
+            // Function that still has to be called to fill m_value, or nullptr when m_value is up-to-date
+            mutable String (*m_valueToString)(ObjectConverter) = nullptr;
         };
 
 
@@ -85,6 +124,31 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  UTF-8 encoded contents of the widget file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// The data is read directly without making a copy of it first, so this is faster than parsing a stringstream.
+        /// Both the text format and the binary format that is created by emitBinary are accepted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data is in the binary format that is created by emitBinary
+        ///
+        /// @param data  Contents of the widget file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return True if the data starts with the header of the binary format
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBinary(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -93,6 +157,20 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the tree of nodes in a compact binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be stored
+        /// @param stream   Stream to which the binary data will be added
+        ///
+        /// Loading the binary data with the parse function is faster than parsing the text format, because no tokenizing is
+        /// needed: all names and values are stored with their length and list values are already split. Values of which the
+        /// type can be recognized from their syntax (strings, numbers, booleans, colors and outlines) are stored in binary form,
+        /// the parser stores them as deserialized value in the value node so that they don't have to be parsed again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 #include <map>
 #include <vector>
 
@@ -46,6 +47,15 @@ namespace tgui
 
         static ObjectConverter deserialize(ObjectConverter::Type type, const String& serializedString);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deserializes the value of a node that was read by DataIO
+        ///
+        /// When the parser already deserialized the value (which the binary format does for values of which the type can be
+        /// recognized), the value is returned without parsing the string again, unless the deserialize function for the type
+        /// was replaced with setFunction.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ObjectConverter deserialize(ObjectConverter::Type type, const DataIO::ValueNode& node);
+
         static void setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer);
         static const DeserializeFunc& getFunction(ObjectConverter::Type type);
 
@@ -29,6 +29,7 @@
 
 #include <TGUI/Vector2.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Backend/Renderer/BackendTexture.hpp>
 #include <cstdint>
 #include <memory>
 
@@ -64,6 +65,52 @@ namespace tgui
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a file in memory contains a compressed texture instead of an image that can be decoded
+        ///
+        /// @param data       Pointer to the file in memory
+        /// @param dataSize   Amount of bytes of the file in memory
+        ///
+        /// @return True if the data starts with the KTX2 file identifier
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isCompressedTexture(const std::uint8_t* data, std::size_t dataSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads a compressed texture from a KTX2 file in memory, without decompressing it
+        ///
+        /// @param data       Pointer to the file in memory
+        /// @param dataSize   Amount of bytes of the file in memory
+        /// @param image      Output parameter that will point to the levels inside the data if loaded successfully
+        ///
+        /// @return True on success, false if the file is invalid or uses an unsupported format
+        ///
+        /// Only 2D KTX2 files without supercompression are supported, containing BC1, BC2, BC3, BC7 or ETC2 data.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool loadCompressedFromMemory(const std::uint8_t* data, std::size_t dataSize, BackendTexture::CompressedImage& image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a directory in which decoded images are stored, to speed up loading the same images the next time
+        ///
+        /// @param directory  Directory to store the decoded images in, or an empty string to disable the disk cache (default)
+        ///
+        /// Decoding large png images can take longer than reading the raw pixels from disk. When a cache directory is set,
+        /// every decoded image is also written to this directory, and the next time an image with the exact same file
+        /// contents is loaded (e.g. when the program is started again) the pixels are read from the cache instead.
+        /// The directory is created if it doesn't exist yet. Files in it can be removed at any time to clear the cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDiskCacheDirectory(const String& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which decoded images are stored
+        ///
+        /// @return Directory of the disk cache, or an empty string when the disk cache is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static String getDiskCacheDirectory();
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
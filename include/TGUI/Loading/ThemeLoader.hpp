@@ -29,6 +29,8 @@
 
 #include <TGUI/String.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/PropertyValueMap.hpp>
+#include <unordered_map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -73,6 +75,20 @@ namespace tgui
         virtual const std::map<String, String>& load(const String& primary, const String& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as values that can be copied directly into a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The returned map is shared and must not be modified. The default implementation converts the result of the load
+        /// function each time it is called, loaders that cache their data can override this function to avoid that work.
+        ///
+        /// @return Map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<const PropertyValueMap> loadProperties(const String& primary, const String& secondary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Check if the requested property-value pairs are available
         ///
@@ -142,6 +158,23 @@ namespace tgui
         const std::map<String, String>& load(const String& filename, const String& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as values that can be copied directly into a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Nested sections and references to other sections are already deserialized when the file is cached,
+        /// so they don't have to be parsed again each time a renderer is created.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<const PropertyValueMap> loadProperties(const String& filename, const String& section) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Check if the requested property-value pairs are available
         ///
@@ -178,6 +211,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
         static std::map<String, std::map<String, std::map<String, String>>> m_propertiesCache;
+
+        // The sections from the files in m_propertiesCache, with values that can be copied directly into a renderer
+        static std::unordered_map<String, std::unordered_map<String, std::shared_ptr<const PropertyValueMap>>> m_deserializedPropertiesCache;
     };
 
 
@@ -0,0 +1,262 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROPERTY_VALUE_MAP_HPP
+#define TGUI_PROPERTY_VALUE_MAP_HPP
+
+
+#include <TGUI/ObjectConverter.hpp>
+#include <initializer_list>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Integer identifier of a renderer property, which is a hash of the property name
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using PropertyId = std::uint64_t;
+
+    namespace priv
+    {
+        // The id is the 64-bit FNV-1a hash of the UTF-8 bytes of the property name
+        constexpr PropertyId propertyIdOffsetBasis = 14695981039346656037ULL;
+        constexpr PropertyId propertyIdPrime = 1099511628211ULL;
+
+        constexpr PropertyId hashPropertyName(const char* name, PropertyId hash)
+        {
+            return (*name == '\0') ? hash : hashPropertyName(name + 1, (hash ^ static_cast<unsigned char>(*name)) * propertyIdPrime);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a renderer property
+    ///
+    /// @param name  Name of the property, encoded as UTF-8
+    ///
+    /// This function can be evaluated at compile time, so it can be used as the label of a switch case:
+    /// @code
+    /// switch (getPropertyId(property))
+    /// {
+    ///     case getPropertyId("TextColor"):
+    ///         break;
+    /// }
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr PropertyId getPropertyId(const char* name)
+    {
+        return priv::hashPropertyName(name, priv::propertyIdOffsetBasis);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a renderer property
+    ///
+    /// @param name  Name of the property
+    ///
+    /// The returned id is the same as the one returned by getPropertyId(const char*) when passing the name encoded as UTF-8.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API PropertyId getPropertyId(const String& name);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Map of renderer properties and their values
+    ///
+    /// The properties are iterated in alphabetical order, like with a std::map. Lookups go through an index that is sorted
+    /// on the id of the property, so finding a property doesn't require any string comparisons (except for a final check).
+    ///
+    /// Copies of the map share their properties until one of them is accessed through a non-const function, at which point
+    /// that map makes its own copy. References to values obtained through non-const functions remain valid until the property
+    /// is removed from the map, references obtained through const functions remain valid until the map is changed.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyValueMap
+    {
+    public:
+
+        using iterator = std::map<String, ObjectConverter>::iterator;
+        using const_iterator = std::map<String, ObjectConverter>::const_iterator;
+        using value_type = std::map<String, ObjectConverter>::value_type;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates an empty map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the map from the given properties and their values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(std::map<String, ObjectConverter> pairs);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the map from the given properties and their values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(std::initializer_list<value_type> pairs);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// The properties are only copied when one of the maps is changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(const PropertyValueMap& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(PropertyValueMap&& other) noexcept;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap& operator=(const PropertyValueMap& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap& operator=(PropertyValueMap&& other) noexcept;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value if the property didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const String& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property
+        /// @return Iterator to the property or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(const String& property);
+        const_iterator find(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property of which the id is already known
+        ///
+        /// @param id        Id of the property, which must be equal to getPropertyId(property)
+        /// @param property  Name of the property, encoded as UTF-8
+        ///
+        /// @return Iterator to the property or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(PropertyId id, const char* property);
+        const_iterator find(PropertyId id, const char* property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns 1 if the property exists and 0 otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t count(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        /// @return Number of removed properties (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(const String& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        /// @return Iterator to the property following the removed one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties in the map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const
+        {
+            return m_storage->pairs.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the map is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const
+        {
+            return m_storage->pairs.empty();
+        }
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const { return m_storage->pairs.cbegin(); }
+        const_iterator end() const { return m_storage->pairs.cend(); }
+        const_iterator cbegin() const { return m_storage->pairs.cbegin(); }
+        const_iterator cend() const { return m_storage->pairs.cend(); }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct IndexEntry
+        {
+            PropertyId id;
+            iterator it;
+        };
+
+        struct Storage
+        {
+            // Rebuilds the index after the pairs were replaced
+            void rebuildIndex();
+
+            std::map<String, ObjectConverter> pairs;
+            std::vector<IndexEntry> index; // Sorted on id
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position in the index where the property with the given id is or would have to be inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findIndexPosition(PropertyId id) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the properties are no longer shared with other maps before giving access to them that allows changing them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detach();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Shares the properties of another map, unless that map already gave out references that allow changing them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyFrom(const PropertyValueMap& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the storage that is shared by all empty maps
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const std::shared_ptr<Storage>& getEmptyStorage();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::shared_ptr<Storage> m_storage;
+        bool m_writeAccessGiven = false; // Copies can't share the properties once references were given that allow changing them
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_VALUE_MAP_HPP
@@ -34,9 +34,10 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::Outline); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getOutline(); \
         else \
             return {}; \
     } \
@@ -50,9 +51,10 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::Color); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getColor(); \
         else \
             return DEFAULT; \
     } \
@@ -66,9 +68,10 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::TextStyle); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getTextStyle(); \
         else \
             return DEFAULT; \
     } \
@@ -82,9 +85,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::Number); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -101,9 +105,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::Bool); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getBool(); \
         else \
             return DEFAULT; \
     }
@@ -120,13 +125,14 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTexture(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        const tgui::PropertyValueMap& pairs = m_data->propertyValuePairs; \
+        if (pairs.find(id, #NAME) != pairs.end()) \
+            return m_data->propertyValuePairs.find(id, #NAME)->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            static const tgui::Texture emptyTexture; \
+            return emptyTexture; \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
@@ -139,9 +145,10 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        constexpr tgui::PropertyId id = tgui::getPropertyId(#NAME); \
+        tgui::ObjectConverter value = getDeserializedProperty(id, #NAME, tgui::ObjectConverter::Type::RendererData); \
+        if (value.getType() != tgui::ObjectConverter::Type::None) \
+            return value.getRenderer(); \
         else \
         { \
             const auto& renderer = tgui::Theme::getDefault()->getRendererNoThrow(RENDERER); \
@@ -29,8 +29,10 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyValueMap.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <unordered_map>
+#include <vector>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,8 +51,32 @@ namespace tgui
         /// @internal
         static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
-        std::map<String, ObjectConverter> propertyValuePairs;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones notifying the widgets about changed properties until endUpdate is called
+        ///
+        /// Changing many properties between beginUpdate and endUpdate is faster than changing them one by one, because each
+        /// widget that uses this renderer only has to update itself once.
+        /// Calls to beginUpdate can be nested, the widgets are notified when the outermost endUpdate is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Notifies the widgets about all properties that were changed since beginUpdate was called
+        ///
+        /// @throw Exception when one of the changed properties isn't supported by a widget. Contrary to when changing the
+        ///        property outside beginUpdate and endUpdate, the value of the property is not restored in this case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+        /// @internal
+        /// Informs the observers that the given properties were changed
+        void notifyObservers(const std::vector<String>& properties);
+
+        PropertyValueMap propertyValuePairs;
         std::unordered_map<const void*, std::function<void(const String& property)>> observers;
+        std::unordered_map<const void*, std::function<void(const std::vector<String>& properties)>> batchObservers;
+        std::vector<String> changedProperties; // Properties changed since beginUpdate was called
+        unsigned int updateDepth = 0;
         bool shared = true;
     };
 
@@ -217,7 +243,7 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<String, ObjectConverter>& getPropertyValuePairs() const;
+        const PropertyValueMap& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,7 +257,19 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Subscribes a callback function to changes in the renderer
+        /// @brief Subscribes callback functions to changes in the renderer
+        ///
+        /// @param id             Unique identifier for these callback functions so that you can unsubscribe them later
+        /// @param function       Callback function to call when a single property of the renderer changes
+        /// @param batchFunction  Callback function to call when multiple properties were changed at once
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribe(const void* id, const std::function<void(const String& property)>& function,
+                       const std::function<void(const std::vector<String>& properties)>& batchFunction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unsubscribes the callback functions that were subscribed to changes in the renderer
         ///
         /// @param id  Unique identifier used when subscribing the callback function
         ///
@@ -272,6 +310,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the value of a property as the given type, or an object of type None when the property doesn't exist.
+        // The properties may be shared with the theme until they are changed, so a value that still has to be deserialized
+        // is deserialized in the own copy of the properties that the renderer data gets before changing them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter getDeserializedProperty(PropertyId id, const char* property, ObjectConverter::Type type) const;
+
+
         std::shared_ptr<RendererData> m_data = RendererData::create();
 
 
@@ -128,17 +128,14 @@ namespace tgui
         template <typename Func, typename... BoundArgs, typename std::enable_if_t<std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value>* = nullptr>
         unsigned int connect(const Func& func, const BoundArgs&... args)
         {
-            const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                return addHandler(func);
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                return addHandler([=]{ invokeFunc(func, args...); });
             }
-
-            return id;
         }
 
 
@@ -226,6 +223,21 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the signal handler and returns the unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()> handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any signal handler is connected to this signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && (m_handlers->connectedCount > 0);
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,9 +279,27 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id; // 0 when the handler was disconnected while the signal was being emitted
+            std::function<void()> callback;
+        };
+
+        // The handlers are shared with the emit function, so that they outlive the signal when a handler destroys the widget.
+        // While the signal is being emitted, the handlers vector is never resized: disconnected handlers only get their id
+        // cleared and new handlers are stored in pendingHandlers. Both are processed when the outermost emit call finishes.
+        struct HandlerList
+        {
+            std::vector<Handler> handlers;
+            std::vector<Handler> pendingHandlers;
+            std::size_t connectedCount = 0;
+            unsigned int emitDepth = 0;
+            bool containsDisconnectedHandlers = false;
+        };
+
         bool m_enabled = true;
         String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<HandlerList> m_handlers; // Only created when the first handler is connected
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
@@ -351,7 +381,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param);
@@ -436,7 +466,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param1);
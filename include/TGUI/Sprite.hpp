@@ -31,8 +31,10 @@
 #include <TGUI/Rect.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <TGUI/Duration.hpp>
 #include <vector>
 #include <memory>
+#include <chrono>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -239,11 +241,29 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns the internal SVG texture for drawing.
+        ///
+        /// While the sprite is being resized, this may be a stretched texture of a nearby size. The svg is rasterized at the
+        /// exact size when this function is called after the size stopped changing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::shared_ptr<BackendTexture>& getSvgTexture() const
-        {
-            return m_svgTexture;
-        }
+        const std::shared_ptr<BackendTexture>& getSvgTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how long the size of an svg sprite has to stay the same before it is rasterized at its exact size
+        ///
+        /// @param settleTime  Time since the last size change (default is 150ms)
+        ///
+        /// When the size changes again within this time, a cached texture with a nearby size is stretched instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setSvgResizeSettleTime(Duration settleTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the size of an svg sprite has to stay the same before it is rasterized at its exact size
+        ///
+        /// @return Time since the last size change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Duration getSvgResizeSettleTime();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,7 +300,9 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        std::shared_ptr<BackendTexture> m_svgTexture;
+        mutable std::shared_ptr<BackendTexture> m_svgTexture; // Shared with other sprites through the TextureManager
+        mutable bool m_svgTextureOutdated = false; // Is m_svgTexture a texture of a nearby size while resizing?
+        std::chrono::steady_clock::time_point m_svgResizeTime;
         std::vector<Vertex> m_vertices;
         std::vector<int> m_indices;
 
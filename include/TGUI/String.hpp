@@ -1484,4 +1484,21 @@ namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace std
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Hash function for tgui::String, which allows it to be used as key in unordered containers
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash<tgui::String>
+    {
+        std::size_t operator()(const tgui::String& str) const
+        {
+            return std::hash<std::u32string>{}(str.toUtf32());
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif // TGUI_STRING_HPP
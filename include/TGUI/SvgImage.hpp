@@ -90,6 +90,34 @@ namespace tgui
         void rasterize(BackendTexture& texture, Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum amount of threads that may be used to rasterize a single image
+        ///
+        /// @param threadCount  Maximum number of threads, including the thread that calls rasterize
+        ///
+        /// Large images are split into horizontal bands that are rasterized in parallel. By default, the number of hardware
+        /// threads is used (with a maximum of 8), so images aren't split on machines with a single hardware thread.
+        /// Setting this to 1 rasterizes all images on the calling thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMaxRasterizeThreads(unsigned int threadCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of threads that may be used to rasterize a single image
+        ///
+        /// @return Maximum number of threads, including the thread that calls rasterize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getMaxRasterizeThreads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops the worker threads that rasterize large images in parallel
+        ///
+        /// Workers are started again when needed by the next call to rasterize. This function is called when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopRasterizeThreads();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         NSVGimage* m_svg = nullptr;
@@ -55,6 +55,7 @@ namespace tgui
         using CallbackFunc = std::function<void(std::shared_ptr<TextureData>)>;
         using BackendTextureLoaderFunc = std::function<bool(BackendTexture&, const String&, bool smooth)>;
         using TextureLoaderFunc = std::function<std::shared_ptr<TextureData>(Texture&, const String&, bool smooth)>;
+        using AsyncLoadedFunc = std::function<void(const Texture&)>;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +185,10 @@ namespace tgui
         /// @param middleRect Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
         /// @param smooth     Enable smoothing on the texture
         ///
+        /// Besides the image formats that can be decoded, the data can also be a KTX2 file containing BC1, BC2, BC3, BC7 or ETC2
+        /// compressed data, which is uploaded to the graphics card without decoding it. Compressed textures are only supported
+        /// by the OpenGL renderers when the graphics driver supports the format, and isTransparentPixel can't be used on them.
+        ///
         /// @throw Exception when loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadFromMemory(const std::uint8_t* data, std::size_t dataSize, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
@@ -220,6 +225,25 @@ namespace tgui
         void loadFromBase64(CharStringView imageAsBase64, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture in the background
+        ///
+        /// @param id          Id for the the image to load (for the default loader, the id is the filename)
+        /// @param onLoaded    Function that is called with the texture once it has been loaded
+        /// @param partRect    Load only part of the image. Don't pass this parameter if you want to load the full image
+        /// @param middleRect  Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth      Enable smoothing on the texture
+        ///
+        /// The image is decoded by a worker thread. The gui uploads the decoded image while updating its time, after which
+        /// onLoaded is called on the main thread. Without a gui, TextureManager::processAsyncLoads has to be called instead.
+        /// If the image could not be loaded then onLoaded is called with an empty texture.
+        ///
+        /// When the image was already loaded before, or when it can't be decoded in the background (e.g. svg images or when
+        /// a custom texture loader is used), the texture is loaded immediately and onLoaded is called before this function returns.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void loadAsync(const String& id, const AsyncLoadedFunc& onLoaded, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the id that was used to load the texture (for the default loader, the id is the filename)
         ///
@@ -29,9 +29,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <TGUI/Duration.hpp>
+#include <unordered_map>
+#include <functional>
 #include <memory>
 #include <list>
-#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,6 +61,68 @@ namespace tgui
         static std::shared_ptr<TextureData> getTexture(Texture& texture, const String& filename, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture in the background
+        ///
+        /// @param filename   Filename of the image to load
+        /// @param smooth     Enable smoothing on the texture
+        /// @param callback   Function that is called on the main thread with the texture data, or with nullptr if loading failed
+        ///
+        /// The image is decoded by a worker thread, it is only uploaded when processAsyncLoads is called. If the image was
+        /// already loaded with the same settings then the callback is called immediately.
+        /// The texture data passed to the callback has already been counted as a user, like with getTexture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void getTextureAsync(const String& filename, bool smooth, const std::function<void(std::shared_ptr<TextureData>)>& callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads the images that were decoded in the background and passes them to the functions that requested them
+        ///
+        /// The gui calls this function while updating its time. Images keep being uploaded until the time budget is exceeded,
+        /// the remaining images are uploaded the next time this function is called.
+        ///
+        /// @return True when at least one texture was loaded, false when nothing changed
+        ///
+        /// @see setAsyncUploadTimeBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool processAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are textures that are still being loaded in the background
+        ///
+        /// @return Are there any textures that were requested with getTextureAsync that haven't been passed to their callback yet?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool hasPendingAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Cancels the textures that are still being loaded in the background and stops the worker threads
+        ///
+        /// The callbacks of the cancelled requests are never called. This function waits until the worker threads finished
+        /// decoding the image they were working on. It is called when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how long processAsyncLoads may spend on uploading images before leaving the rest for the next frame
+        ///
+        /// @param budget  Maximum time to spend uploading images per call (default is 4ms)
+        ///
+        /// At least one image is uploaded per call, even when that takes longer than the budget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncUploadTimeBudget(Duration budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long processAsyncLoads may spend on uploading images before leaving the rest for the next frame
+        ///
+        /// @return Maximum time to spend uploading images per call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Duration getAsyncUploadTimeBudget();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shares the image with another texture
         ///
@@ -79,6 +143,73 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the svg image rasterized at the given size
+        ///
+        /// @param data  Texture data containing the svg image
+        /// @param size  Size of the texture in pixels
+        ///
+        /// Rasterized images are cached, so all sprites that show the same svg at the same size share a single texture.
+        /// When the cache is full, the texture that was least recently requested is removed from it.
+        ///
+        /// @return Texture containing the rasterized svg
+        ///
+        /// @see setSvgTextureCacheSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<BackendTexture> getSvgTexture(const std::shared_ptr<TextureData>& data, Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a cached rasterization of the svg image with a size close to the requested one
+        ///
+        /// @param data                   Texture data containing the svg image
+        /// @param size                   Size of the texture in pixels
+        /// @param maxRelativeDifference  How much the width and height may differ from the requested size (e.g. 0.25 for 25%)
+        ///
+        /// Unlike getSvgTexture, this function never rasterizes the image. It is used to keep showing a stretched texture
+        /// while a sprite is being resized continuously.
+        ///
+        /// @return Texture closest to the requested size, or nullptr when no cached texture is close enough
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<BackendTexture> getNearbySvgTexture(const std::shared_ptr<TextureData>& data, Vector2u size, float maxRelativeDifference);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets how many rasterized svg images are kept in memory
+        ///
+        /// @param maxTextures  Maximum amount of textures in the svg cache (default is 128)
+        ///
+        /// Textures that are still used by a sprite stay alive when they are removed from the cache, they are just no longer
+        /// shared with sprites that request the same size later.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setSvgTextureCacheSize(std::size_t maxTextures);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rasterized svg images are kept in memory
+        ///
+        /// @return Maximum amount of textures in the svg cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSvgTextureCacheSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all rasterized svg images from the cache
+        ///
+        /// This function is called when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearSvgTextureCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many rasterized svg images are stored in the texture manager
+        ///
+        /// @return Number of textures in the svg cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCachedSvgTexturesCount();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Returns how many textures are stored in the texture manager
@@ -93,7 +224,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        static std::unordered_map<String, std::list<TextureDataHolder>> m_imageMap;
+
+        // Maps each loaded texture data to its holder in m_imageMap, so that copying and removing textures doesn't require a search
+        static std::unordered_map<const TextureData*, TextureDataHolder*> m_dataHolders;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include <TGUI/Duration.hpp>
 #include <TGUI/Optional.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -181,14 +182,45 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::shared_ptr<Timer>> m_activeTimers;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the timer to the queue, with a deadline that lies one interval after the current time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void schedule();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the entry of the timer in the queue as outdated, it is only removed from the queue later
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unschedule();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the outdated entries from the front of the queue, or from the entire queue if there are too many of them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeOutdatedEntries();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct QueueEntry
+        {
+            Duration deadline;
+            std::uint64_t id;
+            std::shared_ptr<Timer> timer;
+        };
+
+        static std::vector<QueueEntry> m_queue; // Min-heap of enabled timers, ordered on their deadline
+        static std::size_t m_outdatedQueueEntries;
+        static std::uint64_t m_nextQueueEntryId;
+        static Duration m_totalElapsedTime;
 
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        std::uint64_t m_queueEntryId = 0; // Id of the entry in m_queue that belongs to this timer, or 0 if there is none
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
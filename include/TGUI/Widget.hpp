@@ -35,6 +35,7 @@
 #include <TGUI/String.hpp>
 #include <TGUI/Vector2.hpp>
 #include <TGUI/Duration.hpp>
+#include <TGUI/Optional.hpp>
 #include <TGUI/Cursor.hpp>
 #include <TGUI/Event.hpp>
 #include <TGUI/Any.hpp>
@@ -872,12 +873,46 @@ namespace tgui
         virtual bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the widget still needs updateTime to be called, e.g. because it is playing an animation
+        ///
+        /// The gui only calls updateTime on widgets that requested it. A widget stops receiving time updates once this
+        /// function returns false, until it calls requestUpdateTime again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateTimeRequired() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how long the gui can wait before it has to call updateTime on the widget again
+        ///
+        /// This function is only called while isUpdateTimeRequired returns true. The main loop sleeps until the earliest time
+        /// that is returned by any widget. A zero duration means that the widget has to be updated every frame (e.g. while it
+        /// plays an animation), an empty value means that nothing changes until some other event wakes up the main loop.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Optional<Duration> getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool isMouseOnWidget(Vector2f pos) const = 0;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the area outside of which isMouseOnWidget always returns false
+        ///
+        /// @return Area relative to the top-left position of the widget (its position minus the origin)
+        ///
+        /// Containers with a spatial index only call isMouseOnWidget on widgets for which the mouse lies inside this area.
+        /// By default this is the full size of the widget, moved by the widget offset. Widgets that can be clicked outside
+        /// of that area have to override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual FloatRect getHitBounds() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1059,6 +1094,27 @@ namespace tgui
         virtual void rendererChanged(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when multiple properties of the renderer were changed at once
+        ///
+        /// @param properties  Names of the properties that were changed
+        ///
+        /// The default implementation calls rendererChanged for each property and recalculates the layout afterwards if any of
+        /// them called updateSizeAfterRendererChange. Widgets can override this function to postpone other expensive updates
+        /// until all properties were processed as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererPropertiesChanged(const std::vector<String>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layout of the widget after a renderer property changed, by calling setSize(m_size)
+        ///
+        /// While rendererPropertiesChanged is processing multiple properties, the call to setSize is postponed until all
+        /// properties were processed, so that the layout is only recalculated once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSizeAfterRendererChange();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1089,6 +1145,27 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes certain that the gui calls updateTime on this widget until isUpdateTimeRequired returns false
+        ///
+        /// Widgets that start an animation or a timer have to call this function, the gui doesn't update the time of widgets
+        /// that didn't request it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestUpdateTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time left until m_animationTimeElapsed reaches the given duration, or zero when an animation is playing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Duration getTimeUntilTimerExpires(Duration timerDuration) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the registration for time updates to the current gui after m_parentGui was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parentGuiChanged(BackendGui* oldParentGui);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -1098,6 +1175,12 @@ namespace tgui
         void rendererChangedCallback(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Callback function which is called when multiple renderer properties change and which calls rendererPropertiesChanged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererPropertiesChangedCallback(const std::vector<String>& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1193,12 +1276,18 @@ namespace tgui
         Any m_userData;
         Cursor::Type m_mouseCursor = Cursor::Type::Arrow;
 
+        // Set while rendererPropertiesChanged is processing multiple properties, to only recalculate the layout once afterwards
+        bool m_sizeUpdatesPostponed = false;
+        bool m_sizeUpdatePending = false;
+
         std::function<void(const String& property)> m_rendererChangedCallback = [this](const String& property){ rendererChangedCallback(property); };
+        std::function<void(const std::vector<String>& properties)> m_rendererPropertiesChangedCallback = [this](const std::vector<String>& properties){ rendererPropertiesChangedCallback(properties); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses save and load functions
+        friend class Layout; // Layout accesses the bound layouts to find out in which order layouts need to be recalculated
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
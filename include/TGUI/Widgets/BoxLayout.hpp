@@ -150,6 +150,12 @@ namespace tgui
         void rendererChanged(const String& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets may still be created after the load function returned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoadWidgetsLazily() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
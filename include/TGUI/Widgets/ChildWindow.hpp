@@ -410,6 +410,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isMouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the area in which the mouse is on the widget, which includes the resize border of resizable windows
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getHitBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,6 +515,12 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets may still be created after the load function returned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoadWidgetsLazily() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief This function is called when the mouse enters the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,8 +575,8 @@ namespace tgui
         Vector2f       m_draggingPosition;
         Vector2f       m_maximumSize    = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
         Vector2f       m_minimumSize    = {0, 0};
-        Layout*        m_decorationLayoutX = nullptr;
-        Layout*        m_decorationLayoutY = nullptr;
+        Layout2d       m_clientSizeLayout; // Layout that was passed to setClientSize
+        bool           m_sizeSetFromClientSize = false; // Is the size the client size layout plus the size of the borders and title bar?
         TitleAlignment m_titleAlignment = TitleAlignment::Center;
         unsigned int   m_titleButtons   = TitleButton::Close;
         unsigned int   m_titleTextSize  = 0;
@@ -201,6 +201,12 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node> &node, const LoadingRenderersMap &renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets may still be created after the load function returned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoadWidgetsLazily() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
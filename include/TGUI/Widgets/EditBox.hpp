@@ -533,6 +533,18 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while the caret is blinking
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the caret has to blink
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +111,12 @@ namespace tgui
         FileDialog& operator= (FileDialog&& right) noexcept;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~FileDialog();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Makes a copy of another file dialog
         ///
@@ -439,12 +445,30 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets may still be created after the load function returned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoadWidgetsLazily() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while files are listed or icons are loaded in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the dialog checks again whether the background threads found new files or icons
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,6 +496,38 @@ namespace tgui
         void sortFilesInListView();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a single file to the end of the list view, unless it is rejected by the file type filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFileToListView(const Filesystem::FileInfo& file, const Texture& icon);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts listing the files of the current directory in a background thread, aborting any listing that was still busy
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startDirectoryListing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Aborts the background thread that lists the files in the current directory (if it was still running).
+        // This doesn't wait for the thread to stop, it is only joined once it has noticed that it was cancelled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelDirectoryListing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Joins the threads of cancelled listings that have stopped, or waits for all of them to stop when waitForAll is true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void joinCancelledDirectoryListings(bool waitForAll);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the files that were found by the background thread since the last call to the list view.
+        // Returns whether anything was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateDirectoryListing();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Stores the selected files and closes the dialog
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -543,6 +599,11 @@ namespace tgui
 
         std::shared_ptr<FileDialogIconLoader> m_iconLoader;
 
+        // State that is shared with the thread that lists the files in the current directory, nullptr when no listing is busy
+        struct DirectoryListing;
+        std::shared_ptr<DirectoryListing> m_directoryListing;
+        std::vector<std::shared_ptr<DirectoryListing>> m_cancelledDirectoryListings; // Threads that still have to be joined
+
         std::vector<Filesystem::Path> m_selectedFiles;
     };
 
@@ -357,6 +357,15 @@ namespace tgui
         void rendererChanged(const String& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when multiple properties of the renderer were changed at once
+        ///
+        /// @param properties  Names of the properties that were changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererPropertiesChanged(const std::vector<String>& properties) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,12 +390,30 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text, making use of the given size of maximum text width.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the word-wrapped text, reusing the result of an earlier call with the same maximum width when possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const String& getWordWrappedText(float maxWidth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +444,9 @@ namespace tgui
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_possibleDoubleClick = false;
 
+        // Set while multiple renderer properties are being processed, the text is only rearranged once afterwards
+        bool m_rearrangeTextPostponed = false;
+
         CopiedSharedPtr<ScrollbarChildWidget> m_scrollbar;
         Scrollbar::Policy  m_scrollbarPolicy = Scrollbar::Policy::Automatic;
 
@@ -432,6 +462,29 @@ namespace tgui
         Color     m_textOutlineColorCached;
         float     m_textOutlineThicknessCached = 0;
 
+        // Parameters that were used the last time the text was rearranged, so that it can be skipped when nothing changed
+        struct RearrangeTextParams
+        {
+            String string;
+            Font font;
+            unsigned int textSize = 0;
+            unsigned int textStyle = 0;
+            Vector2f size;
+            float maximumTextWidth = 0;
+            float scrollbarWidth = 0;
+            Outline borders;
+            Outline padding;
+            HorizontalAlignment horizontalAlignment = HorizontalAlignment::Left;
+            VerticalAlignment verticalAlignment = VerticalAlignment::Top;
+            Scrollbar::Policy scrollbarPolicy = Scrollbar::Policy::Automatic;
+            bool autoSize = true;
+        };
+        RearrangeTextParams m_rearrangeTextParams;
+
+        // Word-wrapped strings for the text, font, text size and style in m_rearrangeTextParams, stored per maximum line width.
+        // There can be two widths as the text is wrapped again when the automatic scrollbar is needed.
+        std::vector<std::pair<float, String>> m_wordWrapCache;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -608,6 +608,15 @@ namespace tgui
         void rendererChanged(const String& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when multiple properties of the renderer were changed at once
+        ///
+        /// @param properties  Names of the properties that were changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererPropertiesChanged(const std::vector<String>& properties) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -674,6 +683,18 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -721,6 +742,11 @@ namespace tgui
         bool m_possibleDoubleClick = false;
 
         bool m_autoScroll = true;
+
+        // Set while multiple renderer properties are being processed, the item colors are only updated once afterwards
+        bool m_itemColorsUpdatePostponed = false;
+        bool m_itemColorsUpdatePending = false;
+
         ListBox::TextAlignment m_textAlignment = ListBox::TextAlignment::Left;
 
         Sprite m_spriteBackground;
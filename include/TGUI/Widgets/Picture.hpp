@@ -124,6 +124,22 @@ namespace tgui
         using Widget::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture of the picture in the background
+        ///
+        /// @param id          Id for the the image to load (for the default loader, the id is the filename)
+        /// @param partRect    Load only part of the image. Don't pass this parameter if you want to load the full image
+        /// @param middleRect  Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth      Enable smoothing on the texture
+        ///
+        /// The current texture of the picture (e.g. a placeholder image) remains visible until the new texture has been loaded.
+        /// The onTextureLoad signal is emitted once loading finished. The texture is left unchanged when loading fails.
+        ///
+        /// @see Texture::loadAsync
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadTextureAsync(const String& id, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = Texture::getDefaultSmooth());
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets whether the widget should completely ignore mouse events and let them pass to the widgets behind it
         ///
@@ -195,6 +211,7 @@ namespace tgui
     public:
 
         SignalVector2f onDoubleClick = {"DoubleClicked"};  //!< The picture was double clicked. Optional parameter: mouse position relative to picture
+        SignalBool onTextureLoad = {"TextureLoaded"};      //!< Texture requested with loadTextureAsync finished loading. Optional parameter: whether loading succeeded
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +244,18 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +271,9 @@ namespace tgui
 
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_possibleDoubleClick = false;
+
+        // Incremented each time loadTextureAsync is called, so that textures from older requests can be ignored
+        unsigned int m_asyncTextureRequest = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +187,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isMouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the area in which the mouse is on the widget, which includes the text when it is clickable
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getHitBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +304,12 @@ namespace tgui
         void updateTextColor();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Informs the parent that the hit bounds changed, if they differ from the ones before the text was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void hitBoundsChanged(const FloatRect& oldHitBounds);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#include <unordered_map>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -61,6 +63,8 @@ namespace tgui
             bool expanded = true;
             Node* parent = nullptr;
             std::vector<std::shared_ptr<Node>> nodes;
+            std::unordered_map<String, Node*> nodesByText; // First child node for each text, used for fast lookups
+            bool lazyChildren = false; // Children still have to be requested with onItemsRequested before expanding the node
         };
 
 
@@ -146,6 +150,35 @@ namespace tgui
         bool addItem(const std::vector<String>& hierarchy, bool createParents = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the tree view at once
+        ///
+        /// @param hierarchies   List of item hierarchies, each with the last item being the leaf item
+        /// @param createParents Should the hierarchies be created if they did not exist yet?
+        ///
+        /// @return Amount of items that were added (always the size of the list if createParents is true and no hierarchy is empty)
+        ///
+        /// This function is much faster than calling addItem for each item when adding a large amount of items,
+        /// as the list of visible items is only rebuilt once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addItems(const std::vector<std::vector<String>>& hierarchies, bool createParents = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new collapsed branch item of which the children will only be requested when it gets expanded
+        ///
+        /// @param hierarchy     Hierarchy of items, with the last item being the lazy branch item
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the item was added (always the case if createParents is true)
+        ///
+        /// When the item is expanded for the first time, the onItemsRequested signal is emitted. The children of the item
+        /// should be added by the signal handler, right before the item gets expanded.
+        /// Lazy items are not expanded by expandAll, as that would request the children of all these items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addLazyItem(const std::vector<String>& hierarchy, bool createParents = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands the given item
         ///
@@ -156,6 +189,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands all items
+        ///
+        /// Lazy items (added with addLazyItem) of which the children haven't been requested yet will remain collapsed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void expandAll();
 
@@ -391,6 +426,18 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime has to be called, which is the case while a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateTimeRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,7 +453,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void createNode(std::vector<std::shared_ptr<Node>>& menus, Node* parent, const String& text);
+        Node* createNode(std::vector<std::shared_ptr<Node>>& menus, Node* parent, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Node* addItemImpl(const std::vector<String>& hierarchy, bool createParents);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -439,6 +492,30 @@ namespace tgui
         unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts or removes the children of a visible node in the list of visible items after the node was expanded or collapsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleNodesAfterToggle(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the text of a node that has become visible and updates the maximum width of the items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNodeTextPosition(Node& node, float textPadding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the size and maximum of the scrollbars after the list of visible items changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Emits onItemsRequested for a lazy node that is about to be expanded for the first time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestLazyChildren(const std::shared_ptr<Node>& node);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the text colors of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,12 +542,14 @@ namespace tgui
         SignalItemHierarchy onExpand = {"Expanded"};           //!< A branch node was expanded in the tree view. Optional parameter: expanded node
         SignalItemHierarchy onCollapse = {"Collapsed"};        //!< A branch node was collapsed in the tree view. Optional parameter: collapsed node
         SignalItemHierarchy onRightClick = {"RightClicked"};   //!< A node was right clicked. Optional parameter: node below mouse
+        SignalItemHierarchy onItemsRequested = {"ItemsRequested"}; //!< A lazy node is expanded for the first time and its children should be added. Optional parameter: lazy node
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         // This contains the nodes of the tree
         std::vector<std::shared_ptr<Node>> m_nodes;
+        std::unordered_map<String, Node*> m_nodesByText;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
 
         int m_selectedItem = -1;
@@ -2,6 +2,9 @@
 // - Code was placed in a "tgui" namespace to avoid conflicts if a TGUI user also uses NanoSVG in their project
 // - All floats were replaced by doubles (to get rid of warnings about implicit conversions and promotions)
 // - Some other c++ compiler warnings were fixed, mainly about usage of old-style casts
+// - nsvgRasterizeFull skips shapes that lie entirely above or below the bitmap (used when rasterizing an image in bands)
+// - Active edges calculate their position on each scanline instead of adding a rounded step, which made long edges drift
+//   by up to half a pixel depending on where rasterization started
 
 /*
  * Copyright (c) 2013-14 Mikko Mononen memon@inside.org
@@ -102,7 +105,8 @@ typedef struct NSVGpoint {
 } NSVGpoint;
 
 typedef struct NSVGactiveEdge {
-	int x,dx;
+	int x;
+	double x0,y0,dxdy;
 	double ey;
 	int dir;
 	struct NSVGactiveEdge *next;
@@ -871,11 +875,9 @@ static NSVGactiveEdge* nsvg__addActive(NSVGrasterizer* r, NSVGedge* e, double st
 
 	double dxdy = (e->x1 - e->x0) / (e->y1 - e->y0);
 //	STBTT_assert(e->y0 <= start_point);
-	// round dx down to avoid going too far
-	if (dxdy < 0)
-		z->dx = static_cast<int>(-floor(NSVG__FIX * -dxdy));
-	else
-		z->dx = static_cast<int>(floor(NSVG__FIX * dxdy));
+	z->x0 = e->x0;
+	z->y0 = e->y0;
+	z->dxdy = dxdy;
 	z->x = static_cast<int>(floor(NSVG__FIX * (e->x0 + dxdy * (startPoint - e->y0))));
 //	z->x -= off_x * FIX;
 	z->ey = e->y1;
@@ -1141,7 +1143,8 @@ static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, double tx, double ty,
 //					NSVG__assert(z->valid);
 					nsvg__freeActive(r, z);
 				} else {
-					z->x += z->dx; // advance to position for current scanline
+					// advance to position for current scanline
+					z->x = static_cast<int>(floor(NSVG__FIX * (z->x0 + z->dxdy * (scany - z->y0))));
 					step = &((*step)->next); // advance through list
 				}
 			}
@@ -1392,6 +1395,11 @@ void nsvgRasterizeFull(NSVGrasterizer* r,
 		if (!(shape->flags & NSVG_FLAGS_VISIBLE))
 			continue;
 
+		// The bounds don't include the stroke, so leave a margin that is large enough for miter joins and square caps
+		double margin = shape->strokeWidth * (shape->miterLimit > 2.0 ? shape->miterLimit : 2.0) * scaley + 2.0;
+		if ((ty + shape->bounds[3] * scaley + margin < 0) || (ty + shape->bounds[1] * scaley - margin > h))
+			continue;
+
 		if (shape->fill.type != NSVG_PAINT_NONE) {
 			nsvg__resetPool(r);
 			r->freelist = nullptr;
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Backend/Font/BackendFont.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::vector<float>& BackendFont::getWordPrefixWidths(const char32_t* word, std::size_t length, unsigned int characterSize, bool bold)
+    {
+        TGUI_ASSERT(length > 0, "BackendFont::getWordPrefixWidths can't be called with an empty word");
+
+        // Calculate a FNV-1a hash of the word and its style
+        std::uint64_t hash = 14695981039346656037ULL;
+        const auto addToHash = [&hash](std::uint64_t value){ hash = (hash ^ value) * 1099511628211ULL; };
+        addToHash(characterSize);
+        addToHash(bold ? 1 : 0);
+        for (std::size_t i = 0; i < length; ++i)
+            addToHash(word[i]);
+
+        const auto range = m_wordWidthsCache.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            const CachedWordWidths& cachedWord = it->second;
+            if ((cachedWord.characterSize == characterSize) && (cachedWord.bold == bold)
+             && (cachedWord.word.length() == length) && std::equal(word, word + length, cachedWord.word.begin()))
+            {
+                return cachedWord.prefixWidths;
+            }
+        }
+
+        // Prevent the cache from growing indefinitely when lots of different texts are measured
+        if (m_wordWidthsCache.size() >= 16384)
+            m_wordWidthsCache.clear();
+
+        CachedWordWidths newWord;
+        newWord.word.assign(word, length);
+        newWord.characterSize = characterSize;
+        newWord.bold = bold;
+        newWord.prefixWidths.reserve(length);
+
+        float width = getGlyph(word[0], characterSize, bold).advance;
+        newWord.prefixWidths.push_back(width);
+        for (std::size_t i = 1; i < length; ++i)
+        {
+            width += getKerning(word[i-1], word[i], characterSize, bold) + getGlyph(word[i], characterSize, bold).advance;
+            newWord.prefixWidths.push_back(width);
+        }
+
+        return m_wordWidthsCache.emplace(hash, std::move(newWord))->second.prefixWidths;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
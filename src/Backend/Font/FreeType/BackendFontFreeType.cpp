@@ -62,6 +62,7 @@ namespace tgui
         cleanup();
         m_cachedLineSpacing.clear();
         m_glyphs.clear();
+        m_wordWidthsCache.clear();
         m_rows.clear();
         m_pixels = nullptr;
         m_texture = nullptr;
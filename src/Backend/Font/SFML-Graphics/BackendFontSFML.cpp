@@ -37,6 +37,7 @@ namespace tgui
 
     bool BackendFontSFML::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        m_wordWidthsCache.clear();
         m_fileContents = std::move(data);
         return m_font.loadFromMemory(m_fileContents.get(), sizeInBytes);
     }
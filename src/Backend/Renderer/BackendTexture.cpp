@@ -29,6 +29,9 @@
 
 namespace tgui
 {
+    BackendTexture::PixelStorage BackendTexture::m_pixelStorage = BackendTexture::PixelStorage::Full;
+    bool BackendTexture::m_mipmapsEnabled = false;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
@@ -38,17 +41,58 @@ namespace tgui
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        if (m_pixelStorage == PixelStorage::AlphaMask)
+        {
+            const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y;
+            m_alphaMask = std::make_unique<std::uint8_t[]>((pixelCount + 7) / 8);
+            for (std::size_t i = 0; i < pixelCount; ++i)
+            {
+                if (pixels[(i * 4) + 3] != 0)
+                    m_alphaMask[i / 8] |= static_cast<std::uint8_t>(1 << (i % 8));
+            }
+        }
+        else
+            m_pixels = std::move(pixels);
+
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTexture::setPixelStorage(PixelStorage pixelStorage)
+    {
+        m_pixelStorage = pixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getPixelStorage()
+    {
+        return m_pixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setMipmapsEnabled(bool enabled)
+    {
+        m_mipmapsEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::getMipmapsEnabled()
+    {
+        return m_mipmapsEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTexture::loadTextureOnly(Vector2u size, const std::uint8_t*, bool smooth)
     {
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
         m_pixels = nullptr;
+        m_alphaMask = nullptr;
         m_imageSize = size;
         m_isSmooth = smooth;
         return true;
@@ -56,6 +100,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::loadCompressed(const CompressedImage&, bool)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -79,13 +130,16 @@ namespace tgui
 
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_pixels && !m_alphaMask)
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        const std::size_t pixelIndex = static_cast<std::size_t>(pixel.y) * m_imageSize.x + pixel.x;
+        if (m_alphaMask)
+            return (m_alphaMask[pixelIndex / 8] & (1 << (pixelIndex % 8))) == 0;
+        else
+            return (m_pixels[(pixelIndex * 4) + 3] == 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
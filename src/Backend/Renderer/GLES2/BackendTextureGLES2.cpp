@@ -28,10 +28,34 @@
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        GLint getMinFilter(bool smooth, bool hasMipmaps)
+        {
+            if (!smooth)
+                return GL_NEAREST;
+
+            return hasMipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // OpenGL ES 2 doesn't support mipmaps for textures that don't have a power-of-two size
+        bool canHaveMipmaps(Vector2u size)
+        {
+            if (TGUI_GLAD_GL_ES_VERSION_3_0)
+                return true;
+
+            return ((size.x & (size.x - 1)) == 0) && ((size.y & (size.y - 1)) == 0);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendTextureGLES2::~BackendTextureGLES2()
@@ -47,9 +71,13 @@ namespace tgui
         TGUI_ASSERT(getBackend(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        // Empty textures are only created to render to, so they never get mipmaps
+        const bool useMipmaps = (m_mipmapsEnabled && smooth && pixels && canHaveMipmaps(size));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth)
+                                   && (useMipmaps == m_hasMipmaps));
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_hasMipmaps = useMipmaps;
 
         if (!reuseTexture)
         {
@@ -72,14 +100,15 @@ namespace tgui
         else
         {
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter(smooth, useMipmaps)));
 
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
+            const GLsizei levelCount = useMipmaps ? static_cast<GLsizei>(priv::getMipmapLevelCountOpenGL(size)) : 1;
             if (TGUI_GLAD_GL_ES_VERSION_3_0)
             {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, levelCount, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
                 if (pixels)
                     TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
             }
@@ -90,6 +119,57 @@ namespace tgui
             }
         }
 
+        if (m_hasMipmaps)
+            TGUI_GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::loadCompressed(const CompressedImage& image, bool smooth)
+    {
+        TGUI_ASSERT(getBackend(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
+        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+
+        if (image.levels.empty() || (image.size.x == 0) || (image.size.y == 0))
+            return false;
+
+        const GLenum internalFormat = priv::getCompressedFormatOpenGL(image.format);
+        if (internalFormat == 0)
+            return false;
+
+        // The texture would be incomplete if some levels were missing, so the stored mipmaps are only used when all exist
+        const bool useMipmaps = (m_mipmapsEnabled && smooth && canHaveMipmaps(image.size) && (image.levels.size() == priv::getMipmapLevelCountOpenGL(image.size)));
+        const std::size_t levelCount = useMipmaps ? image.levels.size() : 1;
+
+        BackendTexture::loadTextureOnly(image.size, nullptr, smooth);
+        m_hasMipmaps = useMipmaps;
+
+        if (m_textureId != 0)
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+
+        TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter(smooth, useMipmaps)));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+
+        for (std::size_t level = 0; level < levelCount; ++level)
+        {
+            const GLsizei width = static_cast<GLsizei>(std::max(1u, image.size.x >> level));
+            const GLsizei height = static_cast<GLsizei>(std::max(1u, image.size.y >> level));
+            TGUI_GL_CHECK(glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, width, height, 0,
+                                                 static_cast<GLsizei>(image.levels[level].dataSize), image.levels[level].data));
+        }
+
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
         return true;
@@ -112,7 +192,7 @@ namespace tgui
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
         TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter(m_isSmooth, m_hasMipmaps)));
 
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, oldBoundTexture));
@@ -126,6 +206,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::hasMipmaps() const
+    {
+        return m_hasMipmaps;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 #include <TGUI/String.hpp>
 
+#include <algorithm>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -67,6 +70,55 @@ namespace tgui
         {
         }
 #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int getMipmapLevelCountOpenGL(Vector2u size)
+        {
+            unsigned int levels = 1;
+            unsigned int largestSide = std::max(size.x, size.y);
+            while (largestSide > 1)
+            {
+                largestSide /= 2;
+                ++levels;
+            }
+
+            return levels;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GLenum getCompressedFormatOpenGL(BackendTexture::CompressedFormat format)
+        {
+            // The S3TC formats are only available as extensions, so they aren't defined in our glad header.
+            // Images are uploaded without sRGB conversion, just like uncompressed textures.
+            GLenum internalFormat = 0;
+            switch (format)
+            {
+                case BackendTexture::CompressedFormat::BC1_RGB:    internalFormat = 0x83F0; break; // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+                case BackendTexture::CompressedFormat::BC1_RGBA:   internalFormat = 0x83F1; break; // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+                case BackendTexture::CompressedFormat::BC2:        internalFormat = 0x83F2; break; // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+                case BackendTexture::CompressedFormat::BC3:        internalFormat = 0x83F3; break; // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+                case BackendTexture::CompressedFormat::BC7:        internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM; break;
+                case BackendTexture::CompressedFormat::ETC2_RGB:   internalFormat = GL_COMPRESSED_RGB8_ETC2; break;
+                case BackendTexture::CompressedFormat::ETC2_RGBA1: internalFormat = GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2; break;
+                case BackendTexture::CompressedFormat::ETC2_RGBA:  internalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;
+            }
+
+            // Only use formats that the driver lists as supported. Desktop drivers that have to decode ETC2 in software
+            // typically don't list it, in which case loading the original png would be faster anyway.
+            GLint formatCount = 0;
+            TGUI_GL_CHECK(glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount));
+            if (formatCount <= 0)
+                return 0;
+
+            std::vector<GLint> supportedFormats(static_cast<std::size_t>(formatCount));
+            TGUI_GL_CHECK(glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, supportedFormats.data()));
+            if (std::find(supportedFormats.begin(), supportedFormats.end(), static_cast<GLint>(internalFormat)) == supportedFormats.end())
+                return 0;
+
+            return internalFormat;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +145,7 @@ namespace tgui
 
         m_texture = texture;
         m_pixels = nullptr;
+        m_alphaMask = nullptr;
 
         int width;
         int height;
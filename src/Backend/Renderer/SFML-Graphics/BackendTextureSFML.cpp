@@ -51,8 +51,14 @@ namespace tgui
         }
 
         if (pixels)
+        {
             m_texture.update(pixels);
 
+            // Updating the texture discards the mipmaps, so they are generated again after every update
+            if (smooth && m_mipmapsEnabled)
+                m_texture.generateMipmap();
+        }
+
         return true;
     }
 
@@ -85,6 +91,7 @@ namespace tgui
         m_texture = texture;
 
         m_pixels = nullptr;
+        m_alphaMask = nullptr;
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
     }
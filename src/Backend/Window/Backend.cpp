@@ -25,6 +25,8 @@
 
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/SvgImage.hpp>
 #include <TGUI/Timer.hpp>
 #include <TGUI/Font.hpp>
 #include <TGUI/DefaultFont.hpp>
@@ -66,6 +68,13 @@ namespace tgui
 
             // Destroy the global theme
             Theme::setDefault(nullptr);
+
+            // Destroy the rasterized svg images that are no longer used by any sprite
+            TextureManager::clearSvgTextureCache();
+
+            // Stop the worker threads, images can no longer be loaded without a backend
+            TextureManager::stopAsyncLoads();
+            SvgImage::stopRasterizeThreads();
         }
     }
 
@@ -27,11 +27,29 @@
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/TextureManager.hpp>
+
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns false if the widget or one of its parents is hidden
+        bool isWidgetShownInTree(const Widget* widget)
+        {
+            for (; widget != nullptr; widget = widget->getParent())
+            {
+                if (!widget->isVisible())
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendGui::BackendGui()
@@ -476,6 +494,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setMinimumFrameTime(Duration frameTime)
+    {
+        m_minimumFrameTime = frameTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration BackendGui::getMinimumFrameTime() const
+    {
+        return m_minimumFrameTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::updateTime()
     {
         const auto timePointNow = std::chrono::steady_clock::now();
@@ -494,10 +526,35 @@ namespace tgui
     {
         bool screenRefreshRequired = Timer::updateTime(elapsedTime);
 
+        // Upload the textures that were decoded in the background since the last frame
+        screenRefreshRequired |= TextureManager::processAsyncLoads();
+
         if (!m_windowFocused)
             return screenRefreshRequired;
 
-        screenRefreshRequired |= m_container->updateTime(elapsedTime);
+        // Layouts that depend on animated widgets are only recalculated once after all animations have been updated
+        Layout::beginDeferredUpdates();
+
+        // Only the widgets that requested time updates are updated, idle widgets don't cost anything here.
+        // Widgets that get unregistered while looping (e.g. because an animation callback removed them) are replaced by a
+        // nullptr until the end of the loop, widgets that get registered while looping are only updated in the next frame.
+        m_updatingTime = true;
+        const std::size_t widgetCount = m_timeUpdateWidgets.size();
+        for (std::size_t i = 0; i < widgetCount; ++i)
+        {
+            Widget* const widget = m_timeUpdateWidgets[i];
+            if (!widget || !isWidgetShownInTree(widget))
+                continue;
+
+            screenRefreshRequired |= widget->updateTime(elapsedTime);
+
+            if (m_timeUpdateWidgets[i] && !widget->isUpdateTimeRequired())
+                m_timeUpdateWidgets[i] = nullptr;
+        }
+        m_updatingTime = false;
+
+        m_timeUpdateWidgets.erase(std::remove(m_timeUpdateWidgets.begin(), m_timeUpdateWidgets.end(), nullptr), m_timeUpdateWidgets.end());
+        Layout::endDeferredUpdates();
 
         if (m_tooltipPossible)
         {
@@ -535,6 +592,77 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::registerTimeUpdates(Widget* widget)
+    {
+        if (std::find(m_timeUpdateWidgets.begin(), m_timeUpdateWidgets.end(), widget) == m_timeUpdateWidgets.end())
+            m_timeUpdateWidgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::unregisterTimeUpdates(Widget* widget)
+    {
+        const auto it = std::find(m_timeUpdateWidgets.begin(), m_timeUpdateWidgets.end(), widget);
+        if (it == m_timeUpdateWidgets.end())
+            return;
+
+        if (m_updatingTime)
+            *it = nullptr;
+        else
+            m_timeUpdateWidgets.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> BackendGui::getMainLoopWaitTime(bool refreshRequired, std::chrono::steady_clock::time_point lastRenderTime) const
+    {
+        const auto timePointNow = std::chrono::steady_clock::now();
+        const Duration timeUntilNextFrame = (lastRenderTime + std::chrono::nanoseconds(m_minimumFrameTime) > timePointNow)
+            ? Duration{lastRenderTime + std::chrono::nanoseconds(m_minimumFrameTime) - timePointNow}
+            : Duration{};
+
+        // A frame that couldn't be drawn yet because of the frame limit has to be drawn as soon as it is allowed
+        Optional<Duration> waitTime;
+        if (refreshRequired)
+            waitTime = timeUntilNextFrame;
+
+        const auto updateWaitTime = [&waitTime](Duration duration){
+            if (!waitTime || (duration < *waitTime))
+                waitTime = duration;
+        };
+
+        const Optional<Duration> timerDuration = Timer::getNextScheduledTime();
+        if (timerDuration)
+            updateWaitTime(*timerDuration);
+
+        // Textures that are being loaded in the background are checked for once per frame until they are all loaded
+        if (TextureManager::hasPendingAsyncLoads())
+            updateWaitTime(std::max(timeUntilNextFrame, Duration{std::chrono::milliseconds(1)}));
+
+        // Widgets and tool tips are only updated while the window has focus
+        if (m_windowFocused)
+        {
+            // Each widget tells when it has to be updated next (e.g. when the caret has to blink). Widgets that play an
+            // animation return zero, they are updated once per frame.
+            for (const Widget* widget : m_timeUpdateWidgets)
+            {
+                if (!widget || !isWidgetShownInTree(widget))
+                    continue;
+
+                const Optional<Duration> widgetWaitTime = widget->getTimeUntilNextUpdate();
+                if (widgetWaitTime)
+                    updateWaitTime(std::max(timeUntilNextFrame, *widgetWaitTime));
+            }
+
+            if (m_tooltipPossible)
+                updateWaitTime((m_tooltipTime < ToolTip::getInitialDelay()) ? ToolTip::getInitialDelay() - m_tooltipTime : Duration{});
+        }
+
+        return waitTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendGui::mapPixelToView(int x, int y) const
     {
         return {((x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -552,7 +680,9 @@ namespace tgui
         if (m_backendRenderTarget)
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_windowSize.x), static_cast<float>(m_windowSize.y)});
 
+        Layout::beginDeferredUpdates();
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        Layout::endDeferredUpdates();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -25,7 +25,6 @@
 
 #include <TGUI/Backend/Window/GLFW/BackendGuiGLFW.hpp>
 #include <TGUI/Backend/Window/GLFW/BackendGLFW.hpp>
-#include <TGUI/Timer.hpp>
 
 #define GLFW_INCLUDE_NONE // Don't let GLFW include an OpenGL extention loader
 #include <GLFW/glfw3.h>
@@ -152,8 +151,8 @@ namespace tgui
     void BackendGuiGLFW::windowFocusCallback(int focused)
     {
         const auto event = convertWindowFocusEvent(focused);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,7 +161,10 @@ namespace tgui
     {
         const auto event = convertSizeEvent(width, height);
         if (event)
+        {
             handleEvent(*event);
+            m_eventProcessed = true;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,8 +172,8 @@ namespace tgui
     void BackendGuiGLFW::charCallback(unsigned int codepoint)
     {
         const auto event = convertCharEvent(codepoint);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,8 +181,8 @@ namespace tgui
     void BackendGuiGLFW::keyCallback(int key, int scancode, int action, int mods)
     {
         const auto event = convertKeyEvent(key, scancode, action, mods);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,8 +190,8 @@ namespace tgui
     void BackendGuiGLFW::scrollCallback(double xoffset, double yoffset)
     {
         const auto event = convertScrollEvent(xoffset, yoffset);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,8 +199,8 @@ namespace tgui
     void BackendGuiGLFW::cursorPosCallback(double xpos, double ypos)
     {
         const auto event = convertCursorPosEvent(xpos, ypos);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,8 +208,8 @@ namespace tgui
     void BackendGuiGLFW::mouseButtonCallback(int button, int action, int mods)
     {
         const auto event = convertMouseButtonEvent(button, action, mods);
-        if (event)
-            handleEvent(*event);
+        if (event && handleEvent(*event))
+            m_eventProcessed = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -355,27 +357,37 @@ namespace tgui
 
         setDrawingUpdatesTime(false);
 
+        bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!glfwWindowShouldClose(m_window))
         {
+            // Wait until an event arrives, or until the time needs to be updated or the screen needs to be drawn.
+            // The events are passed to the gui from within the callbacks that were set above.
+            m_eventProcessed = false;
+            const Optional<Duration> waitTime = getMainLoopWaitTime(refreshRequired, lastRenderTime);
+            if (!waitTime)
+                glfwWaitEvents();
+            else if (*waitTime > Duration{})
+                glfwWaitEventsTimeout(static_cast<double>(waitTime->asSeconds()));
+            else
+                glfwPollEvents();
+
+            if (m_eventProcessed)
+                refreshRequired = true;
+
+            if (updateTime())
+                refreshRequired = true;
+
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(35);
-            if (timePointNextAllowed <= timePointNow)
-            {
-                m_backendRenderTarget->clearScreen();
-                draw();
-                glfwSwapBuffers(m_window);
-                lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
-            }
-
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
-
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
-            updateTime();
+            if (!refreshRequired || (std::chrono::steady_clock::now() < lastRenderTime + std::chrono::nanoseconds(getMinimumFrameTime())))
+                continue;
+
+            m_backendRenderTarget->clearScreen();
+            draw();
+            glfwSwapBuffers(m_window);
+
+            refreshRequired = false;
+            lastRenderTime = std::chrono::steady_clock::now();
         }
     }
 
@@ -25,11 +25,10 @@
 
 #include <TGUI/Backend/Window/SDL/BackendGuiSDL.hpp>
 #include <TGUI/Backend/Window/SDL/BackendSDL.hpp>
-#include <TGUI/Timer.hpp>
 
 #include <TGUI/extlibs/IncludeSDL.hpp>
 
-#include <thread>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -350,15 +349,6 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         bool quit = false;
@@ -366,59 +356,49 @@ namespace tgui
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!quit)
         {
-            bool eventProcessed = false;
-            while (true)
+            // Wait until an event arrives, or until the time needs to be updated or the screen needs to be drawn.
+            // The timeout is recalculated on every iteration, so events that keep coming in won't postpone the deadline.
+            SDL_Event event;
+            int eventReceived;
+            const Optional<Duration> waitTime = getMainLoopWaitTime(refreshRequired, lastRenderTime);
+            if (!waitTime)
+                eventReceived = SDL_WaitEvent(&event);
+            else if (*waitTime > Duration{})
+                eventReceived = SDL_WaitEventTimeout(&event, static_cast<int>(std::ceil(waitTime->asSeconds() * 1000)));
+            else
+                eventReceived = SDL_PollEvent(&event);
+
+            while (eventReceived != 0)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
-                SDL_Event event;
-                while (SDL_PollEvent(&event) != 0)
+                if (handleEvent(event))
+                    refreshRequired = true;
+
+                if (event.type == SDL_QUIT)
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
-                    else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
-                    {
-                        eventProcessed = true;
-                    }
+                    quit = true;
+                    refreshRequired = true;
+                }
+                else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
+                {
+                    refreshRequired = true;
                 }
 
-                if (updateTime())
-                    break;
-
-                if (eventProcessed || refreshRequired)
-                    break;
-
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                eventReceived = SDL_PollEvent(&event);
             }
 
-            refreshRequired = true;
+            if (updateTime())
+                refreshRequired = true;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(35);
-            if (timePointNextAllowed > timePointNow)
-            {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
-
+            if (!refreshRequired || (std::chrono::steady_clock::now() < lastRenderTime + std::chrono::nanoseconds(getMinimumFrameTime())))
                 continue;
-            }
 
             m_backendRenderTarget->clearScreen();
             draw();
             presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
 
             refreshRequired = false;
-            lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+            lastRenderTime = std::chrono::steady_clock::now();
         }
     }
 
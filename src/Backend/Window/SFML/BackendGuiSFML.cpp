@@ -25,7 +25,7 @@
 #include <TGUI/Backend/Window/SFML/BackendGuiSFML.hpp>
 #include <TGUI/Backend/Window/SFML/BackendSFML.hpp>
 #include <TGUI/ToolTip.hpp>
-#include <TGUI/Timer.hpp>
+#include <algorithm>
 #include <thread>
 
 #include <SFML/Graphics/RenderTexture.hpp>
@@ -175,15 +175,6 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         sf::Event event;
@@ -191,56 +182,57 @@ namespace tgui
         std::chrono::steady_clock::time_point lastRenderTime;
         while (m_window->isOpen())
         {
-            bool eventProcessed = false;
-            while (true)
+            // When nothing changes until the next event, we block until an event arrives. SFML can't wait for an event with a
+            // timeout, so while something is changing we poll for events and sleep at most 10ms or until the next deadline.
+            bool eventReceived;
+            const Optional<Duration> waitTime = getMainLoopWaitTime(refreshRequired, lastRenderTime);
+            if (!waitTime)
+                eventReceived = m_window->waitEvent(event);
+            else
             {
-                while (m_window->pollEvent(event))
+                eventReceived = m_window->pollEvent(event);
+                if (!eventReceived && (*waitTime > Duration{}))
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == sf::Event::Closed)
-                    {
-                        m_window->close();
-                        eventProcessed = true;
-                    }
-                    else if (event.type == sf::Event::Resized)
-                    {
-                        eventProcessed = true;
-                    }
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(*waitTime, Duration{std::chrono::milliseconds(10)})));
+                    eventReceived = m_window->pollEvent(event);
                 }
+            }
 
-                if (updateTime())
-                    break;
+            while (eventReceived)
+            {
+                if (handleEvent(event))
+                    refreshRequired = true;
 
-                if (eventProcessed || refreshRequired)
-                    break;
+                if (event.type == sf::Event::Closed)
+                {
+                    m_window->close();
+                    refreshRequired = true;
+                }
+                else if (event.type == sf::Event::Resized)
+                {
+                    refreshRequired = true;
+                }
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                eventReceived = m_window->pollEvent(event);
             }
 
-            refreshRequired = true;
+            if (updateTime())
+                refreshRequired = true;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(35);
-            if (timePointNextAllowed > timePointNow)
-            {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
-
+            if (!refreshRequired || (std::chrono::steady_clock::now() < lastRenderTime + std::chrono::nanoseconds(getMinimumFrameTime())))
                 continue;
-            }
+
+            // The window might have been closed while handling the events
+            if (!m_window->isOpen())
+                break;
 
             m_backendRenderTarget->clearScreen();
             draw();
             m_window->display();
 
             refreshRequired = false;
-            lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+            lastRenderTime = std::chrono::steady_clock::now();
         }
     }
 
@@ -32,6 +32,7 @@
 #include <TGUI/Filesystem.hpp>
 
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +42,48 @@ namespace tgui
 
     namespace
     {
+        // Widgets that would cover more cells than this are not stored in the grid of the spatial index
+        constexpr float maxSpatialIndexCellsPerWidget = 64;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getSpatialIndexCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns false if the coordinate is too large to be stored in a grid cell (or when it is NaN)
+        bool getSpatialIndexCell(float coordinate, float cellSize, int& cell)
+        {
+            const float cellFloat = std::floor(coordinate / cellSize);
+            if (!(std::abs(cellFloat) < 1e9f))
+                return false;
+
+            cell = static_cast<int>(cellFloat);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeFromNameIndex(std::unordered_map<String, std::vector<Widget*>>& nameIndex, const String& name, Widget* widget)
+        {
+            const auto it = nameIndex.find(name);
+            if (it == nameIndex.end())
+                return;
+
+            auto& widgets = it->second;
+            const auto widgetIt = std::find(widgets.begin(), widgets.end(), widget);
+            if (widgetIt == widgets.end())
+                return;
+
+            *widgetIt = widgets.back();
+            widgets.pop_back();
+            if (widgets.empty())
+                nameIndex.erase(it);
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         void getAllRenderers(std::map<RendererData*, std::vector<const Widget*>>& renderers, const Container* container)
@@ -77,8 +120,8 @@ namespace tgui
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    const std::string rendererStr = ObjectConverter{pair.second}.getString().toStdString();
+                    auto rendererRootNode = DataIO::parse(rendererStr.data(), rendererStr.size());
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
@@ -115,37 +158,109 @@ namespace tgui
                 if (!pair.first.startsWith(U"Texture") && (pair.first != U"Font") && (pair.first != U"Image") && (pair.first != U"Icon"))
                     continue;
 
-                if (pair.second->value.empty() || pair.second->value.equalIgnoreCase(U"none") || pair.second->value.equalIgnoreCase(U"null") || pair.second->value.equalIgnoreCase(U"nullptr"))
+                if (pair.second->getValue().empty() || pair.second->getValue().equalIgnoreCase(U"none") || pair.second->getValue().equalIgnoreCase(U"null") || pair.second->getValue().equalIgnoreCase(U"nullptr"))
                     continue;
 
                 String filename;
-                if (pair.second->value[0] != '"')
-                    filename = pair.second->value;
+                if (pair.second->getValue()[0] != '"')
+                    filename = pair.second->getValue();
                 else
                 {
                     // The filename is surrounded by quotes, with optional options behind it
-                    const auto endQuotePos = pair.second->value.find('"', 1);
+                    const auto endQuotePos = pair.second->getValue().find('"', 1);
                     assert(endQuotePos != String::npos); // DataIO wouldn't have accepted the file if there is no close quote
-                    filename = pair.second->value.substr(1, endQuotePos - 1);
+                    filename = pair.second->getValue().substr(1, endQuotePos - 1);
                 }
 
                 // Make the path relative to the form file
                 if (filename.startsWith(formPath))
                 {
-                    if (pair.second->value[0] != '"')
-                        pair.second->value.erase(0, formPath.length());
+                    String value = pair.second->getValue();
+                    if (value[0] != '"')
+                        value.erase(0, formPath.length());
                     else
-                        pair.second->value.erase(1, formPath.length());
+                        value.erase(1, formPath.length());
+                    pair.second->setValue(std::move(value));
                 }
             }
 
             for (const auto& childNode : node->children)
                 makePathsRelativeToForm(childNode, formPath);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Amount of containers that still have to create their child widgets because of lazy loading.
+        // This allows get to skip looking for delayed widgets when lazy loading isn't being used.
+        std::size_t lazyContainerCount = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> cloneNode(const DataIO::Node& node, DataIO::Node* parent)
+        {
+            auto clonedNode = std::make_unique<DataIO::Node>();
+            clonedNode->parent = parent;
+            clonedNode->name = node.name;
+
+            // Widget::load may have inserted empty values when checking whether a property existed
+            for (const auto& pair : node.propertyValuePairs)
+                clonedNode->propertyValuePairs[pair.first] = pair.second ? std::make_unique<DataIO::ValueNode>(*pair.second) : nullptr;
+
+            for (const auto& childNode : node.children)
+                clonedNode->children.push_back(cloneNode(*childNode, clonedNode.get()));
+
+            return clonedNode;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Throws when the node or one of the widgets inside it has a type for which no construct function exists.
+        // Nested nodes are only recognized as widgets when they have a name or a known type, as unnamed sections such as
+        // the items of a TreeView can't be told apart from an unnamed widget of an unknown type.
+        void checkWidgetTypes(const DataIO::Node& widgetNode)
+        {
+            const auto widgetType = widgetNode.name.substr(0, widgetNode.name.find('.'));
+            if (!WidgetFactory::getConstructFunction(widgetType))
+                throw Exception{"No construct function exists for widget type '" + widgetType + "'."};
+
+            for (const auto& childNode : widgetNode.children)
+            {
+                if (childNode->name == "ToolTip")
+                {
+                    for (const auto& toolTipNode : childNode->children)
+                        checkWidgetTypes(*toolTipNode);
+                }
+                else if ((childNode->name.find('.') != String::npos) || WidgetFactory::getConstructFunction(childNode->name))
+                    checkWidgetTypes(*childNode);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether the node or one of its descendants describes a widget with the given name
+        bool containsWidgetNode(const DataIO::Node& node, const String& widgetName)
+        {
+            const auto nameSeparator = node.name.find('.');
+            if ((nameSeparator != String::npos)
+             && (Deserializer::deserialize(ObjectConverter::Type::String, node.name.substr(nameSeparator + 1)).getString() == widgetName))
+                return true;
+
+            for (const auto& childNode : node.children)
+            {
+                if (containsWidgetNode(*childNode, widgetName))
+                    return true;
+            }
+
+            return false;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::m_lazyLoadingEnabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
@@ -155,7 +270,11 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_spatialIndexEnabled {other.m_spatialIndexEnabled},
+        m_spatialIndexCellSize{other.m_spatialIndexCellSize},
+        m_lazyWidgetRenderers {other.m_lazyWidgetRenderers},
+        m_lazyWidgetTheme     {other.m_lazyWidgetTheme}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -166,6 +285,12 @@ namespace tgui
 
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             widgetAdded(m_widgets[i]);
+
+        // The copy will create its own delayed widgets
+        for (const auto& node : other.m_lazyWidgetNodes)
+            m_lazyWidgetNodes.push_back(cloneNode(*node, nullptr));
+        if (!m_lazyWidgetNodes.empty())
+            ++lazyContainerCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,7 +301,12 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_spatialIndexEnabled     {other.m_spatialIndexEnabled},
+        m_spatialIndexCellSize    {other.m_spatialIndexCellSize},
+        m_lazyWidgetNodes         {std::move(other.m_lazyWidgetNodes)},
+        m_lazyWidgetRenderers     {std::move(other.m_lazyWidgetRenderers)},
+        m_lazyWidgetTheme         {std::move(other.m_lazyWidgetTheme)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -188,12 +318,16 @@ namespace tgui
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_lazyWidgetNodes.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::~Container()
     {
+        if (!m_lazyWidgetNodes.empty())
+            --lazyContainerCount;
+
         for (const auto& widget : m_widgets)
         {
             if (widget->getParent() == this)
@@ -214,6 +348,8 @@ namespace tgui
             m_widgetWithLeftMouseDown = nullptr;
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
+            m_spatialIndexEnabled = right.m_spatialIndexEnabled;
+            m_spatialIndexCellSize = right.m_spatialIndexCellSize;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -227,6 +363,13 @@ namespace tgui
 
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
                 widgetAdded(m_widgets[i]);
+
+            for (const auto& node : right.m_lazyWidgetNodes)
+                m_lazyWidgetNodes.push_back(cloneNode(*node, nullptr));
+            m_lazyWidgetRenderers = right.m_lazyWidgetRenderers;
+            m_lazyWidgetTheme = right.m_lazyWidgetTheme;
+            if (!m_lazyWidgetNodes.empty())
+                ++lazyContainerCount;
         }
 
         return *this;
@@ -240,11 +383,30 @@ namespace tgui
         if (this != &right)
         {
             Widget::operator=(std::move(right));
+
+            // The old widgets are no longer part of this container
+            for (auto& widget : m_widgets)
+            {
+                if (widget->getParent() == this)
+                    widget->setParent(nullptr);
+            }
+
             m_widgets                  = std::move(right.m_widgets);
             m_widgetBelowMouse         = std::move(right.m_widgetBelowMouse);
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_spatialIndexEnabled      = right.m_spatialIndexEnabled;
+            m_spatialIndexCellSize     = right.m_spatialIndexCellSize;
+            m_spatialIndexOutdated     = true;
+
+            if (!m_lazyWidgetNodes.empty())
+                --lazyContainerCount;
+
+            m_lazyWidgetNodes          = std::move(right.m_lazyWidgetNodes);
+            m_lazyWidgetRenderers      = std::move(right.m_lazyWidgetRenderers);
+            m_lazyWidgetTheme          = std::move(right.m_lazyWidgetTheme);
+            right.m_lazyWidgetNodes.clear();
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
             // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -289,6 +451,7 @@ namespace tgui
         TGUI_ASSERT(widgetPtr != nullptr, "Can't add nullptr to container");
 
         m_widgets.push_back(widgetPtr);
+        m_spatialIndexOutdated = true;
         if (!widgetName.empty())
             widgetPtr->setWidgetName(widgetName);
 
@@ -299,11 +462,65 @@ namespace tgui
 
     Widget::Ptr Container::get(const String& widgetName) const
     {
-        // First search for direct children
-        for (const auto& child : m_widgets)
+        // First search for direct children. Unnamed widgets aren't stored in the index, so they have to be searched the slow way.
+        if (!widgetName.empty())
+        {
+            const auto childIt = m_childNameIndex.find(widgetName);
+            if (childIt != m_childNameIndex.end())
+            {
+                if (childIt->second.size() == 1)
+                    return childIt->second[0]->shared_from_this();
+
+                // When multiple children have the same name, the first one is returned
+                for (const auto& child : m_widgets)
+                {
+                    if (child->getWidgetName() == widgetName)
+                        return child;
+                }
+            }
+
+            // Look in the index of the entire tree for widgets with this name that are located inside this container
+            bool foundMultiple = false;
+            Widget* foundWidget = nullptr;
+            const Container* root = getRootContainer();
+            const auto descendantIt = root->m_descendantNameIndex.find(widgetName);
+            if (descendantIt != root->m_descendantNameIndex.end())
+            {
+                for (Widget* widget : descendantIt->second)
+                {
+                    const Container* parent = widget->getParent();
+                    while (parent && (parent != this))
+                        parent = parent->getParent();
+
+                    if (!parent)
+                        continue;
+
+                    if (foundWidget)
+                    {
+                        foundMultiple = true;
+                        break;
+                    }
+
+                    foundWidget = widget;
+                }
+            }
+
+            // The result is only ambiguous if there are multiple matches or if the widget could still be inside a SubwidgetContainer
+            if (!foundMultiple)
+            {
+                if (foundWidget)
+                    return foundWidget->shared_from_this();
+                if (root->m_subwidgetContainerCount == 0)
+                    return getLazyLoadedWidget(widgetName);
+            }
+        }
+        else
         {
-            if (child->getWidgetName() == widgetName)
-                return child;
+            for (const auto& child : m_widgets)
+            {
+                if (child->getWidgetName().empty())
+                    return child;
+            }
         }
 
         // If no widget was found then search recursively
@@ -329,7 +546,7 @@ namespace tgui
             }
         }
 
-        return nullptr;
+        return getLazyLoadedWidget(widgetName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,6 +578,7 @@ namespace tgui
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + i);
+            m_spatialIndexOutdated = true;
             return true;
         }
 
@@ -378,6 +596,15 @@ namespace tgui
             widget->setParent(nullptr);
 
         m_widgets.clear();
+        m_spatialIndexOutdated = true;
+
+        if (!m_lazyWidgetNodes.empty())
+        {
+            m_lazyWidgetNodes.clear();
+            m_lazyWidgetRenderers.clear();
+            m_lazyWidgetTheme = nullptr;
+            --lazyContainerCount;
+        }
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -387,6 +614,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setLazyLoadingEnabled(bool enabled)
+    {
+        m_lazyLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getLazyLoadingEnabled()
+    {
+        return m_lazyLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Container::getInnerSize() const
     {
         return getSize();
@@ -420,9 +661,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{"Failed to open '" + filenameInResources + "' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        const auto rootNode = DataIO::parse(reinterpret_cast<const char*>(fileContents.get()), fileSize);
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -535,6 +774,10 @@ namespace tgui
 
     std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree(const String& rootDirectory) const
     {
+        // Widgets that were never created because of lazy loading still need to be saved
+        if (lazyContainerCount > 0)
+            const_cast<Container*>(this)->loadLazyWidgetsInTree("");
+
         auto rootNode = std::make_unique<DataIO::Node>();
 
         std::map<RendererData*, std::vector<const Widget*>> renderers;
@@ -588,6 +831,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
+            m_spatialIndexOutdated = true;
             break;
         }
     }
@@ -608,6 +852,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
+            m_spatialIndexOutdated = true;
             break;
         }
     }
@@ -626,6 +871,7 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            m_spatialIndexOutdated = true;
             return i + 1;
         }
 
@@ -647,6 +893,7 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            m_spatialIndexOutdated = true;
             return i-2;
         }
 
@@ -680,6 +927,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + currentWidgetIndex);
         m_widgets.insert(m_widgets.begin() + index, widget);
+        m_spatialIndexOutdated = true;
         return true;
     }
 
@@ -725,31 +973,22 @@ namespace tgui
     {
         pos -= getPosition() + getChildWidgetsOffset();
 
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
-        {
-            auto& widget = *it;
-
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
-
-            // If the widget is a container then look inside it
-            if (widget->isContainer())
-            {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
-                if (childWidget)
-                    return childWidget;
-            }
+        // Look for a visible widget below the mouse
+        const Widget::Ptr widget = getWidgetBelowMouse(pos);
+        if (!widget)
+            return nullptr;
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
+        // If the widget is a container then look inside it
+        if (widget->isContainer())
+        {
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
+            if (childWidget)
+                return childWidget;
         }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget
+        return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -838,6 +1077,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setVisible(bool visible)
+    {
+        if (visible)
+            loadLazyWidgets();
+
+        Widget::setVisible(visible);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setFocused(bool focused)
     {
         if (m_focusedWidget && (focused != m_focusedWidget->isFocused()))
@@ -1000,17 +1249,24 @@ namespace tgui
     {
         Widget::rendererChanged(property);
 
-        if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
-                m_widgets[i]->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
+        switch (getPropertyId(property))
         {
-            for (const auto& widget : m_widgets)
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
             {
-                if (m_fontCached != Font::getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_widgets[i]->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != Font::getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
             }
         }
     }
@@ -1033,8 +1289,32 @@ namespace tgui
     {
         Widget::load(node, renderers);
 
+        // The child widgets of an invisible container are only created once they are needed
+        if (m_lazyLoadingEnabled && !isVisible() && !node->children.empty() && m_lazyWidgetNodes.empty() && canLoadWidgetsLazily())
+        {
+            // Unknown widget types are still reported while loading the form, also when they are nested in other widgets
+            for (const auto& childNode : node->children)
+                checkWidgetTypes(*childNode);
+
+            // The nodes are copied, as the node tree that is being loaded belongs to the caller
+            for (const auto& childNode : node->children)
+                m_lazyWidgetNodes.push_back(cloneNode(*childNode, nullptr));
+
+            m_lazyWidgetRenderers = renderers;
+            m_lazyWidgetTheme = Theme::getDefault();
+            ++lazyContainerCount;
+            return;
+        }
+
+        loadChildWidgets(node->children, renderers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers)
+    {
         std::vector<std::pair<Widget::Ptr, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>> widgetsToLoad;
-        for (const auto& childNode : node->children)
+        for (const auto& childNode : nodes)
         {
             const auto nameSeparator = childNode->name.find('.');
             const auto widgetType = childNode->name.substr(0, nameSeparator);
@@ -1068,6 +1348,97 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::loadLazyWidgets()
+    {
+        if (m_lazyWidgetNodes.empty())
+            return;
+
+        // Take the nodes out of the container first, so that loading the widgets can't end up in this function again
+        const auto nodes = std::move(m_lazyWidgetNodes);
+        const auto renderers = std::move(m_lazyWidgetRenderers);
+        const auto theme = std::move(m_lazyWidgetTheme);
+        m_lazyWidgetNodes.clear();
+        m_lazyWidgetRenderers.clear();
+        m_lazyWidgetTheme = nullptr;
+        --lazyContainerCount;
+
+        // The widgets are created with the same default theme as when the rest of the form was loaded.
+        // Invisible containers inside them were part of the lazily loaded form, so they are also only loaded on demand.
+        const auto oldTheme = Theme::getDefault();
+        const bool oldLazyLoadingEnabled = m_lazyLoadingEnabled;
+        Theme::setDefault(theme);
+        m_lazyLoadingEnabled = true;
+        try
+        {
+            loadChildWidgets(nodes, renderers);
+        }
+        catch (...)
+        {
+            Theme::setDefault(oldTheme);
+            m_lazyLoadingEnabled = oldLazyLoadingEnabled;
+            throw;
+        }
+
+        Theme::setDefault(oldTheme);
+        m_lazyLoadingEnabled = oldLazyLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::loadLazyWidgetsInTree(const String& widgetName)
+    {
+        bool widgetsCreated = false;
+        std::vector<Container*> containersToCheck{this};
+        while (!containersToCheck.empty())
+        {
+            Container* container = containersToCheck.back();
+            containersToCheck.pop_back();
+
+            for (const auto& node : container->m_lazyWidgetNodes)
+            {
+                if (widgetName.empty() || containsWidgetNode(*node, widgetName))
+                {
+                    container->loadLazyWidgets();
+                    widgetsCreated = true;
+                    break;
+                }
+            }
+
+            // The widgets that were just created are checked as well, as they could also contain invisible containers
+            for (const auto& child : container->m_widgets)
+            {
+                if (child->isContainer())
+                    containersToCheck.push_back(static_cast<Container*>(child.get()));
+                else if (auto subWidgetContainer = dynamic_cast<SubwidgetContainer*>(child.get()))
+                    containersToCheck.push_back(subWidgetContainer->getContainer());
+            }
+        }
+
+        return widgetsCreated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getLazyLoadedWidget(const String& widgetName) const
+    {
+        if ((lazyContainerCount == 0) || widgetName.empty())
+            return nullptr;
+
+        if (!const_cast<Container*>(this)->loadLazyWidgetsInTree(widgetName))
+            return nullptr;
+
+        return get(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::canLoadWidgetsLazily() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::processMouseMoveEvent(Vector2f mousePos)
     {
         // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them
@@ -1221,12 +1592,15 @@ namespace tgui
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // When the container is part of a gui, the gui directly updates the child widgets that requested time updates
+        if (!m_parentGui)
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                screenRefreshRequired |= m_widgets[i]->updateTime(elapsedTime);
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            {
+                // Update the elapsed time in widgets that need it
+                if (m_widgets[i]->isVisible())
+                    screenRefreshRequired |= m_widgets[i]->updateTime(elapsedTime);
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -1238,9 +1612,22 @@ namespace tgui
     void Container::setParent(Container* parent)
     {
         const BackendGui* oldParentGui = m_parentGui;
+        const bool wasRootContainer = (m_parent == nullptr);
 
         Widget::setParent(parent);
 
+        // Only the root container keeps track of the names of all widgets in the tree
+        if (wasRootContainer && m_parent)
+        {
+            m_descendantNameIndex.clear();
+            m_subwidgetContainerCount = 0;
+        }
+        else if (!wasRootContainer && !m_parent)
+        {
+            for (const auto& widget : m_widgets)
+                addToDescendantNameIndex(widget.get());
+        }
+
         // If our parent was added to a gui then we need to inform the child widgets that they have been added as well
         if (oldParentGui != m_parentGui)
         {
@@ -1253,7 +1640,10 @@ namespace tgui
 
     void Container::setParentGui(BackendGui* gui)
     {
+        BackendGui* const oldParentGui = m_parentGui;
         m_parentGui = gui;
+        if (m_parentGui != oldParentGui)
+            parentGuiChanged(oldParentGui);
 
         // If widgets were already added then inform them about the gui
         for (auto& widget : m_widgets)
@@ -1264,6 +1654,45 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        if (m_spatialIndexEnabled)
+        {
+            if (m_spatialIndexOutdated)
+                rebuildSpatialIndex();
+
+            // Only the widgets in the cell below the mouse and the widgets that aren't stored in the grid have to be checked.
+            // The widget with the highest index is the one that is drawn on top.
+            bool widgetFound = false;
+            std::size_t foundIndex = 0;
+            const auto checkWidget = [&](std::size_t index){
+                if (widgetFound && (index <= foundIndex))
+                    return;
+
+                const auto& widget = m_widgets[index];
+                if (widget->isVisible() && widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                {
+                    widgetFound = true;
+                    foundIndex = index;
+                }
+            };
+
+            int cellX;
+            int cellY;
+            if (getSpatialIndexCell(mousePos.x, m_spatialIndexCellSize, cellX) && getSpatialIndexCell(mousePos.y, m_spatialIndexCellSize, cellY))
+            {
+                const auto cellIt = m_spatialIndexCells.find(getSpatialIndexCellKey(cellX, cellY));
+                if (cellIt != m_spatialIndexCells.end())
+                {
+                    for (const std::size_t index : cellIt->second)
+                        checkWidget(index);
+                }
+            }
+
+            for (const std::size_t index : m_spatialIndexUngriddedWidgets)
+                checkWidget(index);
+
+            return widgetFound ? m_widgets[foundIndex] : nullptr;
+        }
+
         for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
         {
             auto& widget = *it;
@@ -1297,6 +1726,233 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        m_spatialIndexEnabled = enabled;
+        m_spatialIndexOutdated = true;
+
+        if (!enabled)
+        {
+            m_spatialIndexCells.clear();
+            m_spatialIndexEntries.clear();
+            m_spatialIndexUngriddedWidgets.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        TGUI_ASSERT(cellSize > 0, "Cell size of spatial index must be positive");
+
+        m_spatialIndexCellSize = cellSize;
+        m_spatialIndexOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Container::getSpatialIndexCellSize() const
+    {
+        return m_spatialIndexCellSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (!m_spatialIndexEnabled || m_spatialIndexOutdated)
+            return;
+
+        const auto entryIt = m_spatialIndexEntries.find(child);
+        if (entryIt == m_spatialIndexEntries.end())
+            return;
+
+        // Remove the widget from the cells that it covered before and add it again with its new bounds
+        const SpatialIndexEntry& entry = entryIt->second;
+        const std::size_t index = entry.index;
+        if (entry.inGrid)
+        {
+            for (int x = entry.left; x <= entry.right; ++x)
+            {
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                {
+                    const auto cellIt = m_spatialIndexCells.find(getSpatialIndexCellKey(x, y));
+                    TGUI_ASSERT(cellIt != m_spatialIndexCells.end(), "Widget in spatial index has to be found in the cells it covers");
+
+                    auto& indices = cellIt->second;
+                    const auto indexIt = std::find(indices.begin(), indices.end(), index);
+                    TGUI_ASSERT(indexIt != indices.end(), "Widget in spatial index has to be found in the cells it covers");
+
+                    *indexIt = indices.back();
+                    indices.pop_back();
+                    if (indices.empty())
+                        m_spatialIndexCells.erase(cellIt);
+                }
+            }
+        }
+        else
+        {
+            m_spatialIndexUngriddedWidgets.erase(std::remove(m_spatialIndexUngriddedWidgets.begin(), m_spatialIndexUngriddedWidgets.end(), index),
+                                                 m_spatialIndexUngriddedWidgets.end());
+        }
+
+        addToSpatialIndex(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetAttached(Widget* child)
+    {
+        if (!child->getWidgetName().empty())
+            m_childNameIndex[child->getWidgetName()].push_back(child);
+
+        const_cast<Container*>(getRootContainer())->addToDescendantNameIndex(child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetDetached(Widget* child)
+    {
+        if (!child->getWidgetName().empty())
+            removeFromNameIndex(m_childNameIndex, child->getWidgetName(), child);
+
+        const_cast<Container*>(getRootContainer())->removeFromDescendantNameIndex(child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetRenamed(Widget* child, const String& oldName)
+    {
+        auto* root = const_cast<Container*>(getRootContainer());
+        if (!oldName.empty())
+        {
+            removeFromNameIndex(m_childNameIndex, oldName, child);
+            removeFromNameIndex(root->m_descendantNameIndex, oldName, child);
+        }
+
+        if (!child->getWidgetName().empty())
+        {
+            m_childNameIndex[child->getWidgetName()].push_back(child);
+            root->m_descendantNameIndex[child->getWidgetName()].push_back(child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Container* Container::getRootContainer() const
+    {
+        const Container* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToDescendantNameIndex(Widget* widget)
+    {
+        if (!widget->getWidgetName().empty())
+            m_descendantNameIndex[widget->getWidgetName()].push_back(widget);
+
+        if (widget->isContainer())
+        {
+            for (const auto& child : static_cast<Container*>(widget)->m_widgets)
+                addToDescendantNameIndex(child.get());
+        }
+        else if (dynamic_cast<SubwidgetContainer*>(widget))
+            ++m_subwidgetContainerCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromDescendantNameIndex(Widget* widget)
+    {
+        if (!widget->getWidgetName().empty())
+            removeFromNameIndex(m_descendantNameIndex, widget->getWidgetName(), widget);
+
+        if (widget->isContainer())
+        {
+            for (const auto& child : static_cast<Container*>(widget)->m_widgets)
+                removeFromDescendantNameIndex(child.get());
+        }
+        else if (dynamic_cast<SubwidgetContainer*>(widget))
+        {
+            TGUI_ASSERT(m_subwidgetContainerCount > 0, "SubwidgetContainer has to be counted before it can be removed from the name index");
+            --m_subwidgetContainerCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex() const
+    {
+        m_spatialIndexCells.clear();
+        m_spatialIndexEntries.clear();
+        m_spatialIndexUngriddedWidgets.clear();
+
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            addToSpatialIndex(i);
+
+        m_spatialIndexOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToSpatialIndex(std::size_t index) const
+    {
+        const auto& widget = m_widgets[index];
+        SpatialIndexEntry& entry = m_spatialIndexEntries[widget.get()];
+        entry.index = index;
+        entry.inGrid = false;
+
+        // Rotated and scaled widgets are checked one by one
+        const bool scaledOrRotated = (widget->getScale().x != 1) || (widget->getScale().y != 1) || (widget->getRotation() != 0);
+        if (!scaledOrRotated)
+        {
+            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+            const FloatRect hitBounds = widget->getHitBounds();
+            const Vector2f topLeft = widget->getPosition() - origin + hitBounds.getPosition();
+            const Vector2f bottomRight = topLeft + hitBounds.getSize();
+
+            int left;
+            int top;
+            int right;
+            int bottom;
+            if (getSpatialIndexCell(topLeft.x, m_spatialIndexCellSize, left)
+             && getSpatialIndexCell(topLeft.y, m_spatialIndexCellSize, top)
+             && getSpatialIndexCell(bottomRight.x, m_spatialIndexCellSize, right)
+             && getSpatialIndexCell(bottomRight.y, m_spatialIndexCellSize, bottom)
+             && (right >= left) && (bottom >= top)
+             && (static_cast<float>(right - left + 1) * static_cast<float>(bottom - top + 1) <= maxSpatialIndexCellsPerWidget))
+            {
+                entry.inGrid = true;
+                entry.left = left;
+                entry.top = top;
+                entry.right = right;
+                entry.bottom = bottom;
+
+                for (int x = left; x <= right; ++x)
+                {
+                    for (int y = top; y <= bottom; ++y)
+                        m_spatialIndexCells[getSpatialIndexCellKey(x, y)].push_back(index);
+                }
+            }
+        }
+
+        if (!entry.inGrid)
+            m_spatialIndexUngriddedWidgets.push_back(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::draw(BackendRenderTarget& target, RenderStates states) const
     {
         for (const auto& widget : m_widgets)
@@ -1429,41 +2085,41 @@ namespace tgui
         {
             if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image") || (pair.first == U"Icon"))
             {
-                if (pair.second->value.empty() || pair.second->value.equalIgnoreCase(U"none") || pair.second->value.equalIgnoreCase(U"null") || pair.second->value.equalIgnoreCase(U"nullptr"))
+                if (pair.second->getValue().empty() || pair.second->getValue().equalIgnoreCase(U"none") || pair.second->getValue().equalIgnoreCase(U"null") || pair.second->getValue().equalIgnoreCase(U"nullptr"))
                     continue;
 
                 // Skip absolute paths
-                if (pair.second->value[0] != '"')
+                if (pair.second->getValue()[0] != '"')
                 {
                 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[0] == '/') || (pair.second->value[0] == '\\') || ((pair.second->value.size() > 1) && (pair.second->value[1] == ':')))
+                    if ((pair.second->getValue()[0] == '/') || (pair.second->getValue()[0] == '\\') || ((pair.second->getValue().size() > 1) && (pair.second->getValue()[1] == ':')))
                 #else
-                    if (pair.second->value[0] == '/')
+                    if (pair.second->getValue()[0] == '/')
                 #endif
                         continue;
                 }
                 else // The filename is between quotes
                 {
-                    if (pair.second->value.size() <= 1)
+                    if (pair.second->getValue().size() <= 1)
                         continue;
 
                 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[1] == '/') || (pair.second->value[1] == '\\') || ((pair.second->value.size() > 2) && (pair.second->value[2] == ':')))
+                    if ((pair.second->getValue()[1] == '/') || (pair.second->getValue()[1] == '\\') || ((pair.second->getValue().size() > 2) && (pair.second->getValue()[2] == ':')))
                 #else
-                    if (pair.second->value[1] == '/')
+                    if (pair.second->getValue()[1] == '/')
                 #endif
                         continue;
                 }
 
                 String filename;
-                if (pair.second->value[0] != '"')
-                    filename = pair.second->value;
+                if (pair.second->getValue()[0] != '"')
+                    filename = pair.second->getValue();
                 else
                 {
                     // The filename is surrounded by quotes, with optional options behind it
-                    const auto endQuotePos = pair.second->value.find('"', 1);
+                    const auto endQuotePos = pair.second->getValue().find('"', 1);
                     TGUI_ASSERT(endQuotePos != String::npos, "End quote must exist in Container::injectFormFilePath, DataIO could not accept the value otherwise");
-                    filename = pair.second->value.substr(1, endQuotePos - 1);
+                    filename = pair.second->getValue().substr(1, endQuotePos - 1);
                 }
 
                 // If this image already appeared in the form file, then we already know whether it exists or not,
@@ -1493,10 +2149,10 @@ namespace tgui
 
                 // Insert the path into the filename.
                 // We can't just deserialize the value to get rid of the quotes as it may contain things behind the filename.
-                if (pair.second->value[0] != '"')
-                    pair.second->value = path + '/' + pair.second->value;
+                if (pair.second->getValue()[0] != '"')
+                    pair.second->setValue(path + '/' + pair.second->getValue());
                 else // The filename is between quotes
-                    pair.second->value = '"' + path + '/' + pair.second->value.substr(1);
+                    pair.second->setValue('"' + path + '/' + pair.second->getValue().substr(1));
             }
         }
 
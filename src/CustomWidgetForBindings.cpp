@@ -122,6 +122,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isUpdateTimeRequired() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> CustomWidgetForBindings::getTimeUntilNextUpdate() const
+    {
+        return Duration{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
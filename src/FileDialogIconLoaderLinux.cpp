@@ -28,9 +28,11 @@
 
 #if defined(TGUI_SYSTEM_LINUX)
 
+#include <unordered_map>
 #include <fstream>
 #include <atomic>
 #include <thread>
+#include <mutex>
 #include <cstdlib> // getenv
 #include <dlfcn.h> // dlopen, dlsym, dlclose
 
@@ -58,6 +60,27 @@
 
 namespace tgui
 {
+    // Tables that are loaded in the background by the first file dialog and are then shared with all other dialogs
+    struct FileDialogIconLookupTables
+    {
+        std::map<String, std::vector<String>> extensionToMimeMap;
+        std::map<String, String> mimeToIconMap;
+        std::map<String, Filesystem::Path> iconNameToIconPathMap;
+
+        // Icons that were already looked up for a MIME type. The first icon name is the one that matches the MIME type
+        // exactly, the second one is a more generic icon for the category. Names are empty when there is no such icon.
+        std::unordered_map<String, std::pair<String, String>> mimeTypeIcons;
+        std::mutex mimeTypeIconsMutex;
+    };
+
+    namespace
+    {
+        std::shared_ptr<FileDialogIconLookupTables> sharedLookupTables;
+        std::mutex sharedLookupTablesMutex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     class FileDialogIconLoaderLinux : public FileDialogIconLoader
     {
     public:
@@ -65,6 +88,7 @@ namespace tgui
         ~FileDialogIconLoaderLinux();
 
         bool update() override;
+        bool isLoading() const override;
         bool supportsSystemIcons() const override;
         bool hasGenericIcons() const override;
         Texture getGenericFileIcon(const Filesystem::FileInfo& file) override;
@@ -78,6 +102,7 @@ namespace tgui
         void readGlobFile();
         void preloadLookupTables();
         void loadFileIcons();
+        std::pair<String, String> getMimeTypeIcons(const String& mimeType);
 
     private:
         bool m_lookupTablesLoaded = false;
@@ -89,9 +114,7 @@ namespace tgui
         decltype(&magic_close) m_magicCloseFunc = nullptr;
 
         std::vector<String> m_dataDirs;
-        std::map<String, std::vector<String>> m_extensionToMimeMap;
-        std::map<String, String> m_mimeToIconMap;
-        std::map<String, Filesystem::Path> m_iconNameToIconPathMap;
+        std::shared_ptr<FileDialogIconLookupTables> m_lookupTables;
 
         std::map<String, Texture> m_iconCache;
 
@@ -146,6 +169,18 @@ namespace tgui
 
         initMagic();
 
+        // If the lookup tables were already loaded by a previous dialog then we can use them immediately
+        {
+            std::lock_guard<std::mutex> lock(sharedLookupTablesMutex);
+            if (sharedLookupTables)
+            {
+                m_lookupTables = sharedLookupTables;
+                m_lookupTablesLoaded = true;
+                return;
+            }
+        }
+
+        m_lookupTables = std::make_shared<FileDialogIconLookupTables>();
         m_preloadLookupTablesThreadStarted = true;
         m_preloadLookupTablesThread = std::thread(&FileDialogIconLoaderLinux::preloadLookupTables, this);
     }
@@ -182,11 +217,21 @@ namespace tgui
                 m_preloadLookupTablesThreadStarted = false; // We no longer need to check the thread again
                 m_preloadLookupTablesThread.join();
 
-                if (m_iconNameToIconPathMap.empty())
+                if (m_lookupTables->iconNameToIconPathMap.empty())
                     return false; // The thread has finished but it failed so nothing was loaded
 
                 m_lookupTablesLoaded = true;
 
+                // Share the tables with dialogs that are created later. If another dialog finished loading them first then
+                // we use those tables instead, so that all dialogs share the icons that are looked up per MIME type.
+                {
+                    std::lock_guard<std::mutex> lock(sharedLookupTablesMutex);
+                    if (sharedLookupTables)
+                        m_lookupTables = sharedLookupTables;
+                    else
+                        sharedLookupTables = m_lookupTables;
+                }
+
                 // If icons were already requested then immediately start handling the request
                 if (!m_files.empty())
                 {
@@ -214,6 +259,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialogIconLoaderLinux::isLoading() const
+    {
+        return m_preloadLookupTablesThreadStarted || m_loadFileIconsThreadStarted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool FileDialogIconLoaderLinux::supportsSystemIcons() const
     {
         return true;
@@ -230,21 +282,21 @@ namespace tgui
 
     Texture FileDialogIconLoaderLinux::getGenericFileIcon(const Filesystem::FileInfo& file)
     {
-        auto pathIt = m_iconNameToIconPathMap.end();
+        auto pathIt = m_lookupTables->iconNameToIconPathMap.end();
         if (file.directory)
         {
-            pathIt = m_iconNameToIconPathMap.find(U"folder");
-            if (pathIt == m_iconNameToIconPathMap.end())
-                pathIt = m_iconNameToIconPathMap.find(U"inode-directory");
+            pathIt = m_lookupTables->iconNameToIconPathMap.find(U"folder");
+            if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
+                pathIt = m_lookupTables->iconNameToIconPathMap.find(U"inode-directory");
         }
         else
         {
-            pathIt = m_iconNameToIconPathMap.find("text-x-generic");
-            if (pathIt == m_iconNameToIconPathMap.end())
-                pathIt = m_iconNameToIconPathMap.find("text-plain");
+            pathIt = m_lookupTables->iconNameToIconPathMap.find("text-x-generic");
+            if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
+                pathIt = m_lookupTables->iconNameToIconPathMap.find("text-plain");
         }
 
-        if (pathIt == m_iconNameToIconPathMap.end())
+        if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
             return {}; // No generic icon exists
 
         // If the icon is already cached then we don't have to load it again.
@@ -389,8 +441,8 @@ namespace tgui
             if (colonPos == std::string::npos)
                 continue;
 
-            // No mutex needed, m_mimeToIconMap is not accessed by main thread until loading is complete
-            m_mimeToIconMap[line.substr(0, colonPos)] = line.substr(colonPos + 1);
+            // No mutex needed, m_lookupTables->mimeToIconMap is not accessed by main thread until loading is complete
+            m_lookupTables->mimeToIconMap[line.substr(0, colonPos)] = line.substr(colonPos + 1);
         }
     }
 
@@ -474,18 +526,18 @@ namespace tgui
                 {
                     const String category = iconName.substr(0, firstDashPos);
                     if (category != U"x")
-                        m_mimeToIconMap[category + '/' + iconName.substr(firstDashPos + 1)] = iconName;
+                        m_lookupTables->mimeToIconMap[category + '/' + iconName.substr(firstDashPos + 1)] = iconName;
                 }
             }
         }
 
         // Store the icons that had the highest priority (those with lower priorities have already been overwritten).
-        // No mutex is needed, m_iconNameToIconPathMap is not accessed by main thread until loading is complete
+        // No mutex is needed, m_lookupTables->iconNameToIconPathMap is not accessed by main thread until loading is complete
         for (const auto& entry : foundIcons)
         {
             const String& iconName = entry.first;
             const Filesystem::Path& iconPath = entry.second.first;
-            m_iconNameToIconPathMap[iconName] = iconPath;
+            m_lookupTables->iconNameToIconPathMap[iconName] = iconPath;
         }
     }
 
@@ -549,7 +601,7 @@ namespace tgui
             if ((patternPart->length() < 3) || ((*patternPart)[0] != '*') || ((*patternPart)[1] != '.'))
                 continue;
 
-            m_extensionToMimeMap[patternPart->substr(2)].push_back(*mimePart);
+            m_lookupTables->extensionToMimeMap[patternPart->substr(2)].push_back(*mimePart);
         }
     }
 
@@ -599,8 +651,8 @@ namespace tgui
             auto pos = file.filename.find('.');
             while ((pos != String::npos) && (pos + 1 < file.filename.length()))
             {
-                const auto extIt = m_extensionToMimeMap.find(file.filename.substr(pos + 1).toLower());
-                if (extIt != m_extensionToMimeMap.end())
+                const auto extIt = m_lookupTables->extensionToMimeMap.find(file.filename.substr(pos + 1).toLower());
+                if (extIt != m_lookupTables->extensionToMimeMap.end())
                 {
                     mimeTypesBasedOnGlob = extIt->second;
                     break;
@@ -609,16 +661,13 @@ namespace tgui
                 pos = file.filename.find('.', pos + 1);
             }
 
-            auto pathIt = m_iconNameToIconPathMap.end();
+            String iconName;
 
             // If there is a single glob match then we use that one
             if (mimeTypesBasedOnGlob.size() == 1)
             {
                 firstMimeMatch = mimeTypesBasedOnGlob[0];
-
-                const auto mimeIt = m_mimeToIconMap.find(mimeTypesBasedOnGlob[0]);
-                if (mimeIt != m_mimeToIconMap.end())
-                    pathIt = m_iconNameToIconPathMap.find(mimeIt->second);
+                iconName = getMimeTypeIcons(mimeTypesBasedOnGlob[0]).first;
             }
 
             // If there are none or multipe glob matches then find out which icon to load based on the MIME type of the file
@@ -630,71 +679,49 @@ namespace tgui
                 if (firstMimeMatch.empty())
                     firstMimeMatch = mimeTypeFromMagic;
 
-                const auto mimeIt = m_mimeToIconMap.find(mimeTypeFromMagic);
-                if (mimeIt != m_mimeToIconMap.end())
-                    pathIt = m_iconNameToIconPathMap.find(mimeIt->second);
+                String magicIconName = getMimeTypeIcons(mimeTypeFromMagic).first;
+                if (!magicIconName.empty())
+                    iconName = std::move(magicIconName);
             }
 
             // If no match is found on mime type and there were multiple glob matches then just select the first match
-            if ((pathIt == m_iconNameToIconPathMap.end()) && (mimeTypesBasedOnGlob.size() > 1))
+            if (iconName.empty() && (mimeTypesBasedOnGlob.size() > 1))
             {
                 for (const auto& mimeType : mimeTypesBasedOnGlob)
                 {
                     if (firstMimeMatch.empty())
                         firstMimeMatch = mimeType;
 
-                    const auto mimeIt = m_mimeToIconMap.find(mimeType);
-                    if (mimeIt == m_mimeToIconMap.end())
-                        continue;
-
-                    pathIt = m_iconNameToIconPathMap.find(mimeIt->second);
-                    if (pathIt != m_iconNameToIconPathMap.end())
+                    iconName = getMimeTypeIcons(mimeType).first;
+                    if (!iconName.empty())
                         break;
                 }
             }
 
             // If no exact mime type could be found then try to use a generic one based on the category
-            if ((pathIt == m_iconNameToIconPathMap.end()) && !firstMimeMatch.empty())
-            {
-                const auto slashPos = firstMimeMatch.find('/');
-                if (slashPos != String::npos)
-                {
-                    const String iconName = firstMimeMatch.substr(0, slashPos) + U"-x-generic";
-                    pathIt = m_iconNameToIconPathMap.find(iconName);
-                }
+            if (iconName.empty() && !firstMimeMatch.empty())
+                iconName = getMimeTypeIcons(firstMimeMatch).second;
 
-                if (pathIt == m_iconNameToIconPathMap.end())
-                {
-                    // Executables are sometimes identified as "application/x-sharedlib". If there is no icon for such type then just use an
-                    // icon for executables for files with such type.
-                    if (firstMimeMatch == "application/x-sharedlib")
-                        pathIt = m_iconNameToIconPathMap.find(U"application-x-executable");
-
-                    // Executables were detected by libmagic as application/x-pie-executable, but this didn't exist in my /usr/share/mime.
-                    // So if we couldn't find anything then at least don't show a text icon if "executable" is literally in the MIME type name.
-                    else if (firstMimeMatch.find(U"exec") != String::npos)
-                        pathIt = m_iconNameToIconPathMap.find(U"application-x-executable");
-                }
-            }
+            auto pathIt = iconName.empty() ? m_lookupTables->iconNameToIconPathMap.end() : m_lookupTables->iconNameToIconPathMap.find(iconName);
 
             // If the icon can't be found then fall back to some hardcoded generic icons which hopefully will be found
-            if (pathIt == m_iconNameToIconPathMap.end())
+            if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
             {
                 if (file.directory)
                 {
-                    pathIt = m_iconNameToIconPathMap.find(U"folder");
-                    if (pathIt == m_iconNameToIconPathMap.end())
-                        pathIt = m_iconNameToIconPathMap.find(U"inode-directory");
+                    pathIt = m_lookupTables->iconNameToIconPathMap.find(U"folder");
+                    if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
+                        pathIt = m_lookupTables->iconNameToIconPathMap.find(U"inode-directory");
                 }
                 else
                 {
-                    pathIt = m_iconNameToIconPathMap.find("text-x-generic");
-                    if (pathIt == m_iconNameToIconPathMap.end())
-                        pathIt = m_iconNameToIconPathMap.find("text-plain");
+                    pathIt = m_lookupTables->iconNameToIconPathMap.find("text-x-generic");
+                    if (pathIt == m_lookupTables->iconNameToIconPathMap.end())
+                        pathIt = m_lookupTables->iconNameToIconPathMap.find("text-plain");
                 }
             }
 
-            if (pathIt != m_iconNameToIconPathMap.end())
+            if (pathIt != m_lookupTables->iconNameToIconPathMap.end())
                 m_fileIcons.emplace_back(pathIt->first, pathIt->second.asString());
             else
                 m_fileIcons.emplace_back("", ""); // We couldn't find any icon, so we can't provide a texture
@@ -704,6 +731,42 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Called within separate thread
+    std::pair<String, String> FileDialogIconLoaderLinux::getMimeTypeIcons(const String& mimeType)
+    {
+        // The result is remembered, so the tables only need to be searched once per MIME type
+        std::lock_guard<std::mutex> lock(m_lookupTables->mimeTypeIconsMutex);
+        const auto cachedIt = m_lookupTables->mimeTypeIcons.find(mimeType);
+        if (cachedIt != m_lookupTables->mimeTypeIcons.end())
+            return cachedIt->second;
+
+        const auto& iconPaths = m_lookupTables->iconNameToIconPathMap;
+        std::pair<String, String> icons;
+
+        const auto mimeIt = m_lookupTables->mimeToIconMap.find(mimeType);
+        if ((mimeIt != m_lookupTables->mimeToIconMap.end()) && (iconPaths.find(mimeIt->second) != iconPaths.end()))
+            icons.first = mimeIt->second;
+
+        const auto slashPos = mimeType.find('/');
+        if ((slashPos != String::npos) && (iconPaths.find(mimeType.substr(0, slashPos) + U"-x-generic") != iconPaths.end()))
+            icons.second = mimeType.substr(0, slashPos) + U"-x-generic";
+
+        if (icons.second.empty() && (iconPaths.find(U"application-x-executable") != iconPaths.end()))
+        {
+            // Executables are sometimes identified as "application/x-sharedlib". If there is no icon for such type then just use an
+            // icon for executables for files with such type.
+            // Executables were detected by libmagic as application/x-pie-executable, but this didn't exist in my /usr/share/mime.
+            // So if we couldn't find anything then at least don't show a text icon if "executable" is literally in the MIME type name.
+            if ((mimeType == U"application/x-sharedlib") || (mimeType.find(U"exec") != String::npos))
+                icons.second = U"application-x-executable";
+        }
+
+        m_lookupTables->mimeTypeIcons[mimeType] = icons;
+        return icons;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 #endif // TGUI_SYSTEM_LINUX
@@ -76,6 +76,7 @@ namespace tgui
         ~FileDialogIconLoaderWindows();
 
         bool update() override;
+        bool isLoading() const override;
         bool supportsSystemIcons() const override;
         bool hasGenericIcons() const override;
         Texture getGenericFileIcon(const Filesystem::FileInfo& file) override;
@@ -234,6 +235,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialogIconLoaderWindows::isLoading() const
+    {
+        return m_threadStarted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool FileDialogIconLoaderWindows::supportsSystemIcons() const
     {
         return true;
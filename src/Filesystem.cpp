@@ -27,6 +27,15 @@
 #include <TGUI/Global.hpp>
 
 #include <cstdlib> // getenv
+#include <algorithm>
+#include <mutex>
+#include <map>
+#include <memory>
+
+#if defined(__linux__)
+    #include <sys/inotify.h> // inotify_init1, inotify_add_watch, inotify_rm_watch
+    #include <unistd.h> // read, close
+#endif
 
 #if !defined(TGUI_SYSTEM_WINDOWS)
     #include <unistd.h> // getuid
@@ -34,6 +43,7 @@
 #endif
 
 #if !defined(TGUI_USE_STD_FILESYSTEM) && !defined(TGUI_SYSTEM_WINDOWS)
+    #include <sys/stat.h> // stat
     #include <errno.h> // errno
     #include <unistd.h> // getcwd
 #endif
@@ -42,10 +52,11 @@
     #if defined(TGUI_SYSTEM_WINDOWS)
         #include <TGUI/extlibs/IncludeWindows.hpp>
     #else
+        #include <fcntl.h> // fstatat
         #include <sys/types.h> // stat
-        #include <sys/stat.h> // stat
+        #include <sys/stat.h> // fstatat
         #include <unistd.h> // getcwd
-        #include <dirent.h> // opendir, readdir, closedir
+        #include <dirent.h> // opendir, readdir, closedir, dirfd
     #endif
 #endif
 
@@ -68,6 +79,188 @@ namespace tgui
     }
 #endif
 
+    namespace
+    {
+        // Maximum amount of directories that are kept in the directory listing cache
+        const std::size_t MAX_CACHED_DIRECTORIES = 32;
+
+        struct CachedDirectory
+        {
+            std::vector<Filesystem::FileInfo> files;
+            bool valid = false; // False while the directory is still being listed or when it was changed afterwards
+            std::uint64_t generation = 0; // Increased each time the directory changes
+            std::uint64_t lastUsed = 0;
+            std::int64_t modificationTime = 0; // Only used when inotify isn't available
+            int watchDescriptor = -1;
+        };
+
+        struct DirectoryListingCache
+        {
+            ~DirectoryListingCache()
+            {
+#if defined(__linux__)
+                if (inotifyFd >= 0)
+                    close(inotifyFd);
+#endif
+            }
+
+            std::mutex mutex;
+            std::map<String, CachedDirectory> directories;
+            std::uint64_t useCounter = 0;
+            int inotifyFd = -1;
+            bool inotifyInitialized = false;
+        };
+
+        // The cache is shared with every listing that is busy storing its result, so that a listing that only finishes while
+        // the program is exiting (e.g. in a thread of a FileDialog) never accesses a cache that was already destroyed.
+        std::shared_ptr<DirectoryListingCache> getDirectoryListingCache()
+        {
+            static const auto cache = std::make_shared<DirectoryListingCache>();
+            return cache;
+        }
+
+        std::int64_t getDirectoryModificationTime(const Filesystem::Path& path)
+        {
+#ifdef TGUI_USE_STD_FILESYSTEM
+            std::error_code errorCode;
+            const auto time = std::filesystem::last_write_time(path, errorCode);
+            return errorCode ? 0 : static_cast<std::int64_t>(time.time_since_epoch().count());
+#elif defined(TGUI_SYSTEM_WINDOWS)
+            WIN32_FILE_ATTRIBUTE_DATA attributes;
+            if (!GetFileAttributesExW(path.asNativeString().c_str(), GetFileExInfoStandard, &attributes))
+                return 0;
+
+            return (static_cast<std::int64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+#else
+            struct stat statFileInfo;
+            if (stat(path.asNativeString().c_str(), &statFileInfo) != 0)
+                return 0;
+
+    #if defined(__linux__)
+            return static_cast<std::int64_t>(statFileInfo.st_mtim.tv_sec) * 1000000000 + statFileInfo.st_mtim.tv_nsec;
+    #elif defined(TGUI_SYSTEM_MACOS) || defined(TGUI_SYSTEM_IOS)
+            return static_cast<std::int64_t>(statFileInfo.st_mtimespec.tv_sec) * 1000000000 + statFileInfo.st_mtimespec.tv_nsec;
+    #else
+            return static_cast<std::int64_t>(statFileInfo.st_mtime);
+    #endif
+#endif
+        }
+
+        // Marks all directories that were changed since the last call as invalid. The mutex has to be locked by the caller.
+        void processDirectoryChanges(DirectoryListingCache& cache)
+        {
+#if defined(__linux__)
+            if (cache.inotifyFd < 0)
+                return;
+
+            alignas(struct inotify_event) char buffer[4096];
+            while (true)
+            {
+                const ssize_t length = read(cache.inotifyFd, buffer, sizeof(buffer));
+                if (length <= 0)
+                    break;
+
+                for (ssize_t i = 0; i < length; )
+                {
+                    const auto* event = reinterpret_cast<const struct inotify_event*>(&buffer[i]);
+                    i += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
+
+                    // If events were lost then we no longer know which directories are still valid
+                    const bool overflow = (event->mask & IN_Q_OVERFLOW) != 0;
+                    for (auto& pair : cache.directories)
+                    {
+                        CachedDirectory& directory = pair.second;
+                        if (overflow || (directory.watchDescriptor == event->wd))
+                        {
+                            directory.valid = false;
+                            ++directory.generation;
+                            if (event->mask & IN_IGNORED) // The watch was removed (e.g. because the directory was deleted)
+                                directory.watchDescriptor = -1;
+                        }
+                    }
+                }
+            }
+#else
+            (void)cache;
+#endif
+        }
+
+        // Removes the least recently used directories from the cache. The mutex has to be locked by the caller.
+        void limitDirectoryListingCacheSize(DirectoryListingCache& cache)
+        {
+            while (cache.directories.size() > MAX_CACHED_DIRECTORIES)
+            {
+                auto oldestIt = cache.directories.begin();
+                for (auto it = cache.directories.begin(); it != cache.directories.end(); ++it)
+                {
+                    if (it->second.lastUsed < oldestIt->second.lastUsed)
+                        oldestIt = it;
+                }
+
+#if defined(__linux__)
+                // Different paths may refer to the same directory, in which case they share the watch
+                const int watchDescriptor = oldestIt->second.watchDescriptor;
+                cache.directories.erase(oldestIt);
+                if ((watchDescriptor >= 0) && std::none_of(cache.directories.begin(), cache.directories.end(),
+                        [watchDescriptor](const auto& pair){ return pair.second.watchDescriptor == watchDescriptor; }))
+                {
+                    inotify_rm_watch(cache.inotifyFd, watchDescriptor);
+                }
+#else
+                cache.directories.erase(oldestIt);
+#endif
+            }
+        }
+
+        // Registers a directory that is about to be listed and returns its generation. Changes that occur while the directory
+        // is being listed will increase the generation, which prevents an outdated listing from being stored in the cache.
+        std::uint64_t beginCachingDirectory(DirectoryListingCache& cache, const Filesystem::Path& path)
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            processDirectoryChanges(cache);
+
+            CachedDirectory& directory = cache.directories[path.asString()];
+            directory.lastUsed = ++cache.useCounter;
+
+#if defined(__linux__)
+            if (!cache.inotifyInitialized)
+            {
+                cache.inotifyInitialized = true;
+                cache.inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            }
+
+            if ((cache.inotifyFd >= 0) && (directory.watchDescriptor < 0))
+            {
+                directory.watchDescriptor = inotify_add_watch(cache.inotifyFd, path.asNativeString().c_str(),
+                    IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+            }
+
+            if (directory.watchDescriptor < 0)
+                directory.modificationTime = getDirectoryModificationTime(path);
+#else
+            directory.modificationTime = getDirectoryModificationTime(path);
+#endif
+
+            limitDirectoryListingCacheSize(cache);
+            return directory.generation;
+        }
+
+        // Stores the listed files in the cache, unless the directory was changed since beginCachingDirectory was called
+        void finishCachingDirectory(DirectoryListingCache& cache, const Filesystem::Path& path, std::uint64_t generation,
+                                    std::vector<Filesystem::FileInfo>&& files)
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            processDirectoryChanges(cache);
+
+            const auto it = cache.directories.find(path.asString());
+            if ((it == cache.directories.end()) || (it->second.generation != generation))
+                return;
+
+            it->second.files = std::move(files);
+            it->second.valid = true;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Filesystem::Path::Path(const String& path)
@@ -473,77 +666,177 @@ namespace tgui
     std::vector<Filesystem::FileInfo> Filesystem::listFilesInDirectory(const Path& path)
     {
         std::vector<FileInfo> fileList;
+        listFilesInDirectory(path, [&fileList](FileInfo&& fileInfo){ fileList.push_back(std::move(fileInfo)); return true; });
+        return fileList;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Filesystem::listFilesInDirectory(const Path& path, const std::function<bool(FileInfo&&)>& callback, bool directoriesOnly, bool updateCache)
+    {
+        if (updateCache && !directoriesOnly)
+        {
+            // List the files while keeping a copy of them, which is only stored in the cache when the listing wasn't aborted
+            const auto cache = getDirectoryListingCache();
+            const std::uint64_t generation = beginCachingDirectory(*cache, path);
+            std::vector<FileInfo> fileList;
+            const bool completed = listFilesInDirectory(path, [&fileList,&callback](FileInfo&& fileInfo){
+                fileList.push_back(fileInfo);
+                return callback(std::move(fileInfo));
+            });
+
+            if (completed)
+                finishCachingDirectory(*cache, path, generation, std::move(fileList));
+
+            return completed;
+        }
 
 #ifdef TGUI_USE_STD_FILESYSTEM_FILE_TIME
         std::error_code errorCode;
         for (const auto& entry: std::filesystem::directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, errorCode))
         {
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
+            FileInfo fileInfo;
+            fileInfo.directory = entry.is_directory(errorCode);
+            if (directoriesOnly && !fileInfo.directory)
+                continue;
+
             fileInfo.filename = entry.path().filename().generic_u32string();
             fileInfo.path = Path(entry.path());
-            fileInfo.directory = entry.is_directory(errorCode);
             fileInfo.modificationTime = std::chrono::system_clock::to_time_t(std::chrono::clock_cast<std::chrono::system_clock>(entry.last_write_time(errorCode)));
             if (!fileInfo.directory)
                 fileInfo.fileSize = entry.file_size(errorCode);
+
+            if (!callback(std::move(fileInfo)))
+                return false;
         }
 #elif defined(TGUI_SYSTEM_WINDOWS)
         WIN32_FIND_DATAW entry;
         HANDLE FileHandle = FindFirstFileW((path.asNativeString() + L"\\*").c_str(), &entry);
         if (FileHandle == INVALID_HANDLE_VALUE)
-            return fileList;
+            return true;
 
         do
         {
+            const bool directory = (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+            if (directoriesOnly && !directory)
+                continue;
+
             String filename = entry.cFileName;
             if ((filename == U".") || (filename == U".."))
                 continue;
 
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
+            FileInfo fileInfo;
             fileInfo.filename = filename;
             fileInfo.path = path / filename;
-            fileInfo.directory = (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+            fileInfo.directory = directory;
 
             fileInfo.modificationTime = FileTimeToUnixTime(entry.ftLastWriteTime);
             if (!fileInfo.directory)
                 fileInfo.fileSize = (entry.nFileSizeHigh * (static_cast<decltype(fileInfo.fileSize)>(MAXDWORD) + 1)) + entry.nFileSizeLow;
 
+            if (!callback(std::move(fileInfo)))
+            {
+                FindClose(FileHandle);
+                return false;
+            }
         } while (FindNextFileW(FileHandle, &entry) != 0);
 
         FindClose(FileHandle);
 #else
         DIR* dir = opendir(path.asNativeString().c_str());
         if (!dir)
-            return fileList;
+            return true;
+
+        // The stat calls are made relative to the opened directory, so that the full path doesn't have to be resolved each time
+        const int dirFd = dirfd(dir);
 
         struct dirent* entry = nullptr;
         while ((entry = readdir(dir)) != NULL)
         {
-            const String filename(entry->d_name);
-            if ((filename == ".") || (filename == ".."))
+            const char* name = entry->d_name;
+            if ((name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0'))))
                 continue;
 
-            const Path filePath = path / filename;
+    #ifdef DT_UNKNOWN
+            // Regular files don't need to be stat'ed when we are only interested in directories.
+            // Symbolic links and filesystems that don't report the type still have to be checked.
+            if (directoriesOnly && (entry->d_type != DT_UNKNOWN) && (entry->d_type != DT_DIR) && (entry->d_type != DT_LNK))
+                continue;
+    #endif
 
             struct stat statFileInfo;
-            if (stat(filePath.asNativeString().c_str(), &statFileInfo) != 0)
+            if (fstatat(dirFd, name, &statFileInfo, 0) != 0)
                 continue;
 
             if (statFileInfo.st_size < 0)
                 continue;
 
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
-            fileInfo.filename = filename;
-            fileInfo.path = filePath;
+            FileInfo fileInfo;
             fileInfo.directory = (statFileInfo.st_mode & S_IFDIR);
+            if (directoriesOnly && !fileInfo.directory)
+                continue;
+
+            fileInfo.filename = name;
+            fileInfo.path = path / fileInfo.filename;
             fileInfo.modificationTime = statFileInfo.st_mtime;
             if (!fileInfo.directory)
                 fileInfo.fileSize = static_cast<decltype(fileInfo.fileSize)>(statFileInfo.st_size);
+
+            if (!callback(std::move(fileInfo)))
+            {
+                closedir(dir);
+                return false;
+            }
         }
 
         closedir(dir);
 #endif
 
-        return fileList;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Filesystem::getCachedFilesInDirectory(const Path& path, std::vector<FileInfo>& files)
+    {
+        const auto cachePtr = getDirectoryListingCache();
+        DirectoryListingCache& cache = *cachePtr;
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        processDirectoryChanges(cache);
+
+        const auto it = cache.directories.find(path.asString());
+        if ((it == cache.directories.end()) || !it->second.valid)
+            return false;
+
+        // Without inotify we can only check whether the directory has been modified since we listed it
+        if ((it->second.watchDescriptor < 0) && (it->second.modificationTime != getDirectoryModificationTime(path)))
+        {
+            it->second.valid = false;
+            return false;
+        }
+
+        it->second.lastUsed = ++cache.useCounter;
+        files = it->second.files;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Filesystem::clearDirectoryListingCache()
+    {
+        const auto cachePtr = getDirectoryListingCache();
+        DirectoryListingCache& cache = *cachePtr;
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+#if defined(__linux__)
+        for (const auto& pair : cache.directories)
+        {
+            if (pair.second.watchDescriptor >= 0)
+                inotify_rm_watch(cache.inotifyFd, pair.second.watchDescriptor);
+        }
+#endif
+
+        cache.directories.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,10 +27,49 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
 
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Entry in the stack of the depth-first search that sorts the layouts of a pass by their dependencies
+        struct LayoutSortEntry
+        {
+            Layout* layout;
+            std::size_t firstDependent; // Index in the dependents buffer of the first dependent of this layout
+            std::size_t nextDependent; // Index in the dependents buffer of the next dependent to visit
+        };
+
+        // Keeps track of which connected layouts still need to be recalculated.
+        // The vectors are only cleared between passes, so that recalculating layouts doesn't allocate memory once they have grown.
+        struct LayoutUpdateState
+        {
+            unsigned int deferDepth = 0;
+            bool processing = false;
+            std::vector<Layout*> scheduledRoots; // Layouts that have their m_updateScheduled flag set
+            std::vector<Layout*> outdatedRoots; // Layouts that were scheduled when the current pass started
+            std::vector<Layout*> passOrder; // Layouts that are recalculated in the current pass, sorted by their dependencies
+            std::vector<LayoutSortEntry> sortStack;
+            std::vector<Layout*> dependents; // Dependents of the layouts in sortStack, stored in the same order as the stack
+        };
+
+        LayoutUpdateState& getLayoutUpdateState()
+        {
+            static LayoutUpdateState state;
+            return state;
+        }
+
+        // Maximum amount of times the outdated layouts are recalculated before giving up, to prevent an infinite loop
+        const unsigned int maxLayoutPasses = 100;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     static std::pair<String, String> parseMinMaxExpresssion(const String& expression)
     {
         unsigned int bracketCount = 0;
@@ -80,14 +119,13 @@ namespace tgui
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
                 {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
+                    m_steps.push_back({Operation::BindingString, 0, nullptr, "&.innersize"});
                 }
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(expression.substr(0, expression.length()-1).toFloat() / 100.f),
-                                   std::make_unique<Layout>("&.innersize")};
+                                   Layout{expression.substr(0, expression.length()-1).toFloat() / 100.f},
+                                   Layout{"&.innersize"}};
                 }
             }
             else
@@ -111,20 +149,19 @@ namespace tgui
                  || (partAfterDot == U"size") || (partAfterDot == U"innersize"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    m_steps.push_back({Operation::BindingString, 0, nullptr, expression});
                 }
                 else if (partAfterDot == U"right")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + U"left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + U"width")};
+                                   Layout{expression.substr(0, expression.size()-5) + U"left"},
+                                   Layout{expression.substr(0, expression.size()-5) + U"width"}};
                 }
                 else if (partAfterDot == U"bottom")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + U"top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + U"height")};
+                                   Layout{expression.substr(0, expression.size()-6) + U"top"},
+                                   Layout{expression.substr(0, expression.size()-6) + U"height"}};
                 }
                 else // Constant value
                 {
@@ -184,13 +221,13 @@ namespace tgui
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
+                            *this = Layout{Operation::Minimum, Layout{minSubExpressions.first}, Layout{minSubExpressions.second}};
                             return;
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
+                            *this = Layout{Operation::Maximum, Layout{maxSubExpressions.first}, Layout{maxSubExpressions.second}};
                             return;
                         }
                         else // The brackets form a sub-expression
@@ -241,9 +278,7 @@ namespace tgui
                 auto nextOperandIt = operandIt;
                 std::advance(nextOperandIt, 1);
 
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                (*operandIt) = Layout{operators[i], *operandIt, *nextOperandIt};
 
                 operands.erase(nextOperandIt);
             }
@@ -265,7 +300,7 @@ namespace tgui
                 TGUI_ASSERT(nextOperandIt != operands.end(), "Second operand not found in plus or minus operation");
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                if (operandIt->isConstant() && nextOperandIt->isConstant() && (operandIt->m_value == 0))
                 {
                     if (operators[i] == Operation::Minus)
                         nextOperandIt->m_value = -nextOperandIt->m_value;
@@ -274,9 +309,7 @@ namespace tgui
                 }
                 else // Normal addition or subtraction
                 {
-                    *operandIt = Layout{operators[i],
-                                        std::make_unique<Layout>(*operandIt),
-                                        std::make_unique<Layout>(*nextOperandIt)};
+                    *operandIt = Layout{operators[i], *operandIt, *nextOperandIt};
                 }
 
                 operands.erase(nextOperandIt);
@@ -289,93 +322,74 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    Layout::Layout(Operation operation, Widget* boundWidget)
     {
-        TGUI_ASSERT(m_boundWidget != nullptr, "Bound widget passed to Layout constructor can't be a nullptr");
-        TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-               || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
+        TGUI_ASSERT(boundWidget != nullptr, "Bound widget passed to Layout constructor can't be a nullptr");
+        TGUI_ASSERT((operation == Operation::BindingPosX) || (operation == Operation::BindingPosY)
+               || (operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight),
             "Layout constructor with bound widget must be called with an operation that involves the widget"
         );
 
-        if (m_operation == Operation::BindingPosX)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingPosY)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
-        resetPointers();
-        recalculateValue();
+        m_steps.push_back({operation, 0, boundWidget, {}});
+        bindLayout();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand)
     {
-        TGUI_ASSERT(m_leftOperand != nullptr, "Left operand in layout constructor can't be a nullptr");
-        TGUI_ASSERT(m_rightOperand != nullptr, "Right operand in layout constructor can't be a nullptr");
+        TGUI_ASSERT((operation == Operation::Plus) || (operation == Operation::Minus)
+               || (operation == Operation::Multiplies) || (operation == Operation::Divides)
+               || (operation == Operation::Minimum) || (operation == Operation::Maximum),
+            "Layout constructor with two operands must be called with a mathematical operation"
+        );
+
+        m_steps.reserve(std::max<std::size_t>(leftOperand.m_steps.size(), 1) + std::max<std::size_t>(rightOperand.m_steps.size(), 1) + 1);
+        appendSteps(leftOperand);
+        appendSteps(rightOperand);
+        m_steps.push_back({operation, 0, nullptr, {}});
 
-        resetPointers();
-        recalculateValue();
+        bindLayout();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {nullptr},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString},
-        m_connectedWidgetCallback{nullptr}
+        m_value                  {other.m_value},
+        m_steps                  {other.m_steps},
+        m_connectedWidgetCallback{nullptr},
+        m_connectedWidget        {nullptr}
     {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
+        // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+        for (auto& step : m_steps)
+        {
+            if (!step.boundString.empty())
+            {
+                step.operation = Operation::BindingString;
+                step.widget = nullptr;
+            }
+        }
 
-        resetPointers();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)},
-        m_connectedWidgetCallback{std::move(m_connectedWidgetCallback)}
+        m_value                  {other.m_value},
+        m_connectedWidgetCallback{nullptr},
+        m_connectedWidget        {nullptr}
     {
-        resetPointers();
+        // The widgets have to be told that the other layout no longer binds them before the steps are taken from it
+        other.unbindLayout();
+        m_steps = std::move(other.m_steps);
+        other.m_steps.clear();
+
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,19 +401,21 @@ namespace tgui
             unbindLayout();
 
             m_value           = other.m_value;
-            m_parent          = nullptr;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
+            m_steps           = other.m_steps;
             m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
 
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
+            // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+            for (auto& step : m_steps)
+            {
+                if (!step.boundString.empty())
+                {
+                    step.operation = Operation::BindingString;
+                    step.widget = nullptr;
+                }
+            }
 
-            resetPointers();
+            bindLayout();
         }
 
         return *this;
@@ -412,17 +428,15 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
-            m_connectedWidgetCallback = std::move(m_connectedWidgetCallback);
+            m_value           = other.m_value;
+            m_steps           = std::move(other.m_steps);
+            m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
+            other.m_steps.clear();
 
-            resetPointers();
+            bindLayout();
         }
 
         return *this;
@@ -433,124 +447,156 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::replaceValue(const Layout& value)
-    {
-        // Copy the layout, but keep the original parent
-        const auto oldParent = m_parent;
-        *this = value;
-        m_parent = oldParent;
-
-        // Inform the parent that the value of the layout has changed
-        if (m_parent)
-            m_parent->recalculateValue();
+        // Make sure a layout pass won't try to recalculate this layout after it has been destroyed
+        if (m_updateScheduled)
+        {
+            auto& scheduledRoots = getLayoutUpdateState().scheduledRoots;
+            scheduledRoots.erase(std::remove(scheduledRoots.begin(), scheduledRoots.end(), this), scheduledRoots.end());
+        }
+        if (m_updatePending)
+        {
+            auto& passOrder = getLayoutUpdateState().passOrder;
+            std::replace(passOrder.begin(), passOrder.end(), this, static_cast<Layout*>(nullptr));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (m_steps.empty())
             return String::fromNumber(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
+
+        // Find where the right operand of each operation starts, the left operand ends right before it
+        std::vector<std::size_t> rightOperandStarts(m_steps.size(), 0);
+        std::vector<std::size_t> operandStarts;
+        for (std::size_t i = 0; i < m_steps.size(); ++i)
         {
-            return U"min(" + m_leftOperand->toString() + U", " + m_rightOperand->toString() + U")";
+            const Operation operation = m_steps[i].operation;
+            if ((operation == Operation::Plus) || (operation == Operation::Minus) || (operation == Operation::Multiplies)
+             || (operation == Operation::Divides) || (operation == Operation::Minimum) || (operation == Operation::Maximum))
+            {
+                TGUI_ASSERT(operandStarts.size() >= 2, "Operation in layout requires two operands");
+                rightOperandStarts[i] = operandStarts.back();
+                operandStarts.pop_back();
+            }
+            else
+                operandStarts.push_back(i);
         }
-        else if (m_operation == Operation::Maximum)
+
+        return stepToString(m_steps.size() - 1, rightOperandStarts);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String Layout::stepToString(std::size_t stepIndex, const std::vector<std::size_t>& rightOperandStarts) const
+    {
+        const Step& step = m_steps[stepIndex];
+        if (step.operation == Operation::Value)
         {
-            return U"max(" + m_leftOperand->toString() + U", " + m_rightOperand->toString() + U")";
+            return String::fromNumber(step.value);
         }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
+        else if ((step.operation == Operation::Minimum) || (step.operation == Operation::Maximum)
+              || (step.operation == Operation::Plus) || (step.operation == Operation::Minus)
+              || (step.operation == Operation::Multiplies) || (step.operation == Operation::Divides))
         {
+            const std::size_t leftIndex = rightOperandStarts[stepIndex] - 1;
+            const std::size_t rightIndex = stepIndex - 1;
+
+            if (step.operation == Operation::Minimum)
+                return U"min(" + stepToString(leftIndex, rightOperandStarts) + U", " + stepToString(rightIndex, rightOperandStarts) + U")";
+            else if (step.operation == Operation::Maximum)
+                return U"max(" + stepToString(leftIndex, rightOperandStarts) + U", " + stepToString(rightIndex, rightOperandStarts) + U")";
+
             char operatorChar;
-            if (m_operation == Operation::Plus)
+            if (step.operation == Operation::Plus)
                 operatorChar = '+';
-            else if (m_operation == Operation::Minus)
+            else if (step.operation == Operation::Minus)
                 operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
+            else if (step.operation == Operation::Multiplies)
                 operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
+            else // if (step.operation == Operation::Divides)
                 operatorChar = '/';
 
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
+            // A percentage is stored as a multiplication of a constant with the inner size of the parent
+            auto isPercentage = [this,&rightOperandStarts](std::size_t index)
                 {
-                    if (!operand->m_leftOperand)
-                        return false;
-
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
+                    return (m_steps[index].operation == Operation::Multiplies)
+                        && (m_steps[rightOperandStarts[index] - 1].operation == Operation::Value)
+                        && (stepToString(index - 1, rightOperandStarts) == U"100%");
+                };
 
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == U"100%"))
+            auto subExpressionNeedsBrackets = [this,&isPercentage](std::size_t index)
+                {
+                    const Operation operation = m_steps[index].operation;
+                    if ((operation != Operation::Plus) && (operation != Operation::Minus)
+                     && (operation != Operation::Multiplies) && (operation != Operation::Divides))
                         return false;
 
-                    return true;
+                    return !isPercentage(index);
                 };
 
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return U"(" + m_leftOperand->toString() + U") " + operatorChar + U" (" + m_rightOperand->toString() + U")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return U"(" + m_leftOperand->toString() + U") " + operatorChar + U" " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + U" " + operatorChar + U" (" + m_rightOperand->toString() + U")";
+            if (subExpressionNeedsBrackets(leftIndex) && subExpressionNeedsBrackets(rightIndex))
+                return U"(" + stepToString(leftIndex, rightOperandStarts) + U") " + operatorChar + U" (" + stepToString(rightIndex, rightOperandStarts) + U")";
+            else if (subExpressionNeedsBrackets(leftIndex))
+                return U"(" + stepToString(leftIndex, rightOperandStarts) + U") " + operatorChar + U" " + stepToString(rightIndex, rightOperandStarts);
+            else if (subExpressionNeedsBrackets(rightIndex))
+                return stepToString(leftIndex, rightOperandStarts) + U" " + operatorChar + U" (" + stepToString(rightIndex, rightOperandStarts) + U")";
             else
             {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == U"100%"))
-                    return String::fromNumber(m_leftOperand->getValue() * 100) + '%';
+                if (isPercentage(stepIndex))
+                    return String::fromNumber(m_steps[leftIndex].value * 100) + '%';
                 else
-                    return m_leftOperand->toString() + U" " + operatorChar + U" " + m_rightOperand->toString();
+                    return stepToString(leftIndex, rightOperandStarts) + U" " + operatorChar + U" " + stepToString(rightIndex, rightOperandStarts);
             }
         }
         else
         {
-            if (m_boundString == "&.innersize")
+            if (step.boundString == "&.innersize")
                 return "100%";
 
             // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            if (!m_boundString.empty())
-                return m_boundString;
+            if (!step.boundString.empty())
+                return step.boundString;
             else
             {
-                if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                 || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                 || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                 || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight))
+                if ((step.operation == Operation::BindingPosX) || (step.operation == Operation::BindingPosY)
+                 || (step.operation == Operation::BindingLeft) || (step.operation == Operation::BindingTop)
+                 || (step.operation == Operation::BindingWidth) || (step.operation == Operation::BindingHeight)
+                 || (step.operation == Operation::BindingInnerWidth) || (step.operation == Operation::BindingInnerHeight))
                 {
-                    TGUI_ASSERT(m_boundWidget != nullptr, "There has to be a bound widget with this operation type");
-                    const String boundWidgetName = m_boundWidget->getWidgetName();
+                    TGUI_ASSERT(step.widget != nullptr, "There has to be a bound widget with this operation type");
+                    const String boundWidgetName = step.widget->getWidgetName();
                     if (boundWidgetName.empty())
                     {
                         TGUI_PRINT_WARNING("layout can't be correctly converted to string because the bound widget has no name");
                     }
 
-                    if (m_operation == Operation::BindingPosX)
+                    if (step.operation == Operation::BindingPosX)
                         return boundWidgetName + U".x";
-                    else if (m_operation == Operation::BindingPosY)
+                    else if (step.operation == Operation::BindingPosY)
                         return boundWidgetName + U".y";
-                    else if (m_operation == Operation::BindingLeft)
+                    else if (step.operation == Operation::BindingLeft)
                         return boundWidgetName + U".left";
-                    else if (m_operation == Operation::BindingTop)
+                    else if (step.operation == Operation::BindingTop)
                         return boundWidgetName + U".top";
-                    else if (m_operation == Operation::BindingWidth)
+                    else if (step.operation == Operation::BindingWidth)
                         return boundWidgetName + U".width";
-                    else if (m_operation == Operation::BindingHeight)
+                    else if (step.operation == Operation::BindingHeight)
                         return boundWidgetName + U".height";
-                    else if (m_operation == Operation::BindingInnerWidth)
+                    else if (step.operation == Operation::BindingInnerWidth)
                         return boundWidgetName + U".innerwidth";
                     else
                     {
-                        TGUI_ASSERT(m_operation == Operation::BindingInnerHeight, "Operation can't be anything other than BindingInnerHeight here");
+                        TGUI_ASSERT(step.operation == Operation::BindingInnerHeight, "Operation can't be anything other than BindingInnerHeight here");
                         return boundWidgetName + U".innerheight";
                     }
                 }
 
                 // The layout contains an empty string
-                TGUI_ASSERT(m_operation == Operation::BindingString, "All operation types should have been covered already");
-                return m_boundString;
+                TGUI_ASSERT(step.operation == Operation::BindingString, "All operation types should have been covered already");
+                return step.boundString;
             }
         }
     }
@@ -559,52 +605,62 @@ namespace tgui
 
     void Layout::unbindLayout()
     {
-        if (m_boundWidget)
+        for (const auto& step : m_steps)
         {
-            TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                   || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
+            if (!step.widget)
+                continue;
+
+            TGUI_ASSERT((step.operation == Operation::BindingPosX) || (step.operation == Operation::BindingPosY)
+                   || (step.operation == Operation::BindingLeft) || (step.operation == Operation::BindingTop)
+                   || (step.operation == Operation::BindingWidth) || (step.operation == Operation::BindingHeight)
+                   || (step.operation == Operation::BindingInnerWidth) || (step.operation == Operation::BindingInnerHeight),
                 "Layout with bound widget should have an operation that involves the widget"
             );
 
-            if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY) || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
+            if ((step.operation == Operation::BindingPosX) || (step.operation == Operation::BindingPosY) || (step.operation == Operation::BindingLeft) || (step.operation == Operation::BindingTop))
+                step.widget->unbindPositionLayout(this);
             else
-                m_boundWidget->unbindSizeLayout(this);
+                step.widget->unbindSizeLayout(this);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::bindLayout()
     {
-        if (m_leftOperand != nullptr)
+        for (const auto& step : m_steps)
         {
-            TGUI_ASSERT(m_rightOperand != nullptr, "If a left operand exists then there should also be a right operand");
+            if (!step.widget)
+                continue;
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
-        }
-
-        if (m_boundWidget)
-        {
-            TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                   || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
+            TGUI_ASSERT((step.operation == Operation::BindingPosX) || (step.operation == Operation::BindingPosY)
+                   || (step.operation == Operation::BindingLeft) || (step.operation == Operation::BindingTop)
+                   || (step.operation == Operation::BindingWidth) || (step.operation == Operation::BindingHeight)
+                   || (step.operation == Operation::BindingInnerWidth) || (step.operation == Operation::BindingInnerHeight),
                 "Layout with bound widget should have an operation that involves the widget"
             );
 
-            if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY) || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            // The widget keeps the layouts in a set, so binding the same widget in multiple steps doesn't add the layout twice
+            if ((step.operation == Operation::BindingPosX) || (step.operation == Operation::BindingPosY) || (step.operation == Operation::BindingLeft) || (step.operation == Operation::BindingTop))
+                step.widget->bindPositionLayout(this);
             else
-                m_boundWidget->bindSizeLayout(this);
+                step.widget->bindSizeLayout(this);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Layout::appendSteps(const Layout& operand)
+    {
+        // A constant has no steps, it becomes a single step when it is used as an operand
+        if (operand.m_steps.empty())
+            m_steps.push_back({Operation::Value, operand.m_value, nullptr, {}});
+        else
+            m_steps.insert(m_steps.end(), operand.m_steps.begin(), operand.m_steps.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
     {
         const float oldValue = m_value;
@@ -612,10 +668,20 @@ namespace tgui
         // No callbacks must be made while parsing, a single callback will be made when done if needed
         m_connectedWidgetCallback = nullptr;
 
-        parseBindingStringRecursive(widget, xAxis);
+        // Parse the string bindings even when the referred widget was already found. The widget may be added to a different parent
+        unbindLayout();
+        for (std::size_t i = 0; i < m_steps.size(); ++i)
+        {
+            if (!m_steps[i].boundString.empty())
+                parseBindingString(i, m_steps[i].boundString, widget, xAxis);
+        }
+        bindLayout();
+
+        m_value = calculateValue();
 
         // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
 
         if (m_value != oldValue)
         {
@@ -626,198 +692,395 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::unbindWidget(Widget* widget)
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        bool stepsChanged = false;
+        for (auto& step : m_steps)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            if (step.widget != widget)
+                continue;
+
+            // A string binding keeps its last value until the string can be parsed again
+            step.widget = nullptr;
+            if (!step.boundString.empty())
+                step.operation = Operation::BindingString;
+            else
+            {
+                step.value = 0;
+                step.operation = Operation::Value;
+            }
+
+            stepsChanged = true;
         }
 
-        recalculateValue();
+        if (stepsChanged)
+            recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Layout::recalculateValue()
     {
-        const float oldValue = m_value;
+        // Layouts that are connected to a widget are recalculated by a layout pass, so that they can be recalculated only once
+        // after all widgets on which they depend have changed.
+        if (isConnected())
+        {
+            scheduleUpdate(this);
+            return;
+        }
+
+        m_value = calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        switch (m_operation)
+    float Layout::calculateValue()
+    {
+        if (m_steps.empty())
+            return m_value;
+
+        // Layouts are small enough to be evaluated without allocating memory for the stack, unless they are deeply nested.
+        // The stack never holds more values than there are steps.
+        std::array<float, 16> fixedStack;
+        std::vector<float> dynamicStack;
+        float* stack = fixedStack.data();
+        if (m_steps.size() > fixedStack.size())
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingPosX:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingPosY:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
+            dynamicStack.resize(m_steps.size());
+            stack = dynamicStack.data();
+        }
+
+        std::size_t stackSize = 0;
+        for (auto& step : m_steps)
+        {
+            float result;
+            switch (step.operation)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
-            }
-            case Operation::BindingInnerHeight:
+                case Operation::Plus:
+                    stackSize -= 2;
+                    result = stack[stackSize] + stack[stackSize + 1];
+                    break;
+                case Operation::Minus:
+                    stackSize -= 2;
+                    result = stack[stackSize] - stack[stackSize + 1];
+                    break;
+                case Operation::Multiplies:
+                    stackSize -= 2;
+                    result = stack[stackSize] * stack[stackSize + 1];
+                    break;
+                case Operation::Divides:
+                    stackSize -= 2;
+                    if (stack[stackSize + 1] != 0)
+                        result = stack[stackSize] / stack[stackSize + 1];
+                    else
+                        result = 0;
+                    break;
+                case Operation::Minimum:
+                    stackSize -= 2;
+                    result = std::min(stack[stackSize], stack[stackSize + 1]);
+                    break;
+                case Operation::Maximum:
+                    stackSize -= 2;
+                    result = std::max(stack[stackSize], stack[stackSize + 1]);
+                    break;
+                case Operation::BindingPosX:
+                    result = step.widget->getPosition().x;
+                    break;
+                case Operation::BindingPosY:
+                    result = step.widget->getPosition().y;
+                    break;
+                case Operation::BindingLeft:
+                    result = step.widget->getPosition().x - (step.widget->getOrigin().x * step.widget->getSize().x);
+                    break;
+                case Operation::BindingTop:
+                    result = step.widget->getPosition().y - (step.widget->getOrigin().y * step.widget->getSize().y);
+                    break;
+                case Operation::BindingWidth:
+                    result = step.widget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    result = step.widget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth:
+                    result = step.widget->isContainer() ? static_cast<const Container*>(step.widget)->getInnerSize().x : step.value;
+                    break;
+                case Operation::BindingInnerHeight:
+                    result = step.widget->isContainer() ? static_cast<const Container*>(step.widget)->getInnerSize().y : step.value;
+                    break;
+                case Operation::Value:
+                case Operation::BindingString:
+                default:
+                    // The string of a BindingString should have already been parsed by now. Passing here either means something
+                    // is wrong with the string or the layout was not connected to a widget with a parent yet.
+                    result = step.value;
+                    break;
+            };
+
+            // The value of a binding is remembered, it is still used when the widget is unbound
+            step.value = result;
+            stack[stackSize++] = result;
+        }
+
+        TGUI_ASSERT(stackSize == 1, "Layout steps should reduce to a single value");
+        return stack[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::getDependentRoots(std::vector<Layout*>& dependents) const
+    {
+        const Widget* widget = m_connectedWidget;
+        if (!widget)
+            return;
+
+        const auto addDependents = [this,&dependents](const std::unordered_set<Layout*>& boundLayouts){
+            for (Layout* layout : boundLayouts)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
+                if (layout->isConnected() && (layout != this))
+                    dependents.push_back(layout);
             }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
         };
 
-        if (m_value != oldValue)
+        // A change in position only affects layouts that bind the position, while a change in size also affects the layouts
+        // that bind the left or top of the widget (as the origin is relative to the size).
+        addDependents(widget->m_boundPositionLayouts);
+        if ((this != &widget->m_position.x) && (this != &widget->m_position.y))
+            addDependents(widget->m_boundSizeLayouts);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::scheduleUpdate(Layout* root)
+    {
+        auto& state = getLayoutUpdateState();
+
+        // Nothing has to be done if the layout is still going to be recalculated in the pass that is currently being executed
+        if (root->m_updatePending)
+            return;
+
+        if (!root->m_updateScheduled)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            root->m_updateScheduled = true;
+            state.scheduledRoots.push_back(root);
+        }
+
+        if ((state.deferDepth == 0) && !state.processing)
+            processScheduledUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Marks the update state as busy while a pass is executed. If a callback throws an exception then the layouts that
+    // weren't recalculated yet are scheduled again, so that they are recalculated by the next pass.
+    struct Layout::UpdatePassGuard
+    {
+        UpdatePassGuard()
+        {
+            getLayoutUpdateState().processing = true;
+        }
+
+        ~UpdatePassGuard()
+        {
+            auto& state = getLayoutUpdateState();
+            for (Layout* layout : state.passOrder)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                if (!layout || !layout->m_updatePending)
+                    continue;
+
+                layout->m_updatePending = false;
+                if (!layout->m_updateScheduled)
+                {
+                    layout->m_updateScheduled = true;
+                    state.scheduledRoots.push_back(layout);
+                }
             }
+
+            state.passOrder.clear();
+            state.processing = false;
         }
-    }
+
+        UpdatePassGuard(const UpdatePassGuard&) = delete;
+        UpdatePassGuard& operator=(const UpdatePassGuard&) = delete;
+    };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout* Layout::getLeftOperand() const
+    void Layout::processScheduledUpdates()
     {
-        return m_leftOperand ? m_leftOperand.get() : nullptr;
+        const UpdatePassGuard guard;
+        auto& state = getLayoutUpdateState();
+
+        bool cycleDetected = false;
+        unsigned int passCount = 0;
+        while (!state.scheduledRoots.empty())
+        {
+            // Recalculating the layouts normally takes a single pass, but callbacks (e.g. when a widget changes its own size when
+            // its position changes) may cause layouts to become outdated again after they were recalculated.
+            if (++passCount > maxLayoutPasses)
+            {
+                TGUI_PRINT_WARNING("layouts keep changing after " << maxLayoutPasses << " passes, there is probably a circular dependency between widgets.");
+                for (Layout* root : state.scheduledRoots)
+                    root->m_updateScheduled = false;
+                state.scheduledRoots.clear();
+                break;
+            }
+
+            state.outdatedRoots.swap(state.scheduledRoots);
+            for (Layout* root : state.outdatedRoots)
+                root->m_updateScheduled = false;
+
+            // Sort the outdated layouts and all layouts that depend on them so that every layout comes after the layouts
+            // on which it depends. This is done with an iterative depth-first search, the reverse post-order is the sorted order.
+            // The dependents of the layouts on the stack are stored in a single buffer, the dependents of the layout on top
+            // of the stack are always at the end of the buffer.
+            for (Layout* outdatedRoot : state.outdatedRoots)
+            {
+                if (outdatedRoot->m_updateVisitState != VisitState::Unvisited)
+                    continue;
+
+                outdatedRoot->m_updateVisitState = VisitState::OnStack;
+                state.sortStack.push_back({outdatedRoot, state.dependents.size(), state.dependents.size()});
+                outdatedRoot->getDependentRoots(state.dependents);
+                while (!state.sortStack.empty())
+                {
+                    LayoutSortEntry& entry = state.sortStack.back();
+                    if (entry.nextDependent < state.dependents.size())
+                    {
+                        Layout* dependent = state.dependents[entry.nextDependent++];
+                        if (dependent->m_updateVisitState == VisitState::Unvisited)
+                        {
+                            dependent->m_updateVisitState = VisitState::OnStack;
+                            state.sortStack.push_back({dependent, state.dependents.size(), state.dependents.size()});
+                            dependent->getDependentRoots(state.dependents);
+                        }
+                        else if ((dependent->m_updateVisitState == VisitState::OnStack) && !cycleDetected)
+                        {
+                            TGUI_PRINT_WARNING("circular dependency between layouts, the layouts will not be updated correctly.");
+                            cycleDetected = true;
+                        }
+                    }
+                    else
+                    {
+                        entry.layout->m_updateVisitState = VisitState::Sorted;
+                        entry.layout->m_updatePending = true;
+                        state.passOrder.push_back(entry.layout);
+                        state.dependents.resize(entry.firstDependent);
+                        state.sortStack.pop_back();
+                    }
+                }
+            }
+            state.outdatedRoots.clear();
+
+            // The layouts can be sorted again in the next pass
+            for (Layout* root : state.passOrder)
+                root->m_updateVisitState = VisitState::Unvisited;
+
+            std::reverse(state.passOrder.begin(), state.passOrder.end());
+
+            // The vector may be altered while looping over it (a layout that gets destroyed is replaced by a nullptr)
+            for (std::size_t i = 0; i < state.passOrder.size(); ++i)
+            {
+                Layout* root = state.passOrder[i];
+                if (!root)
+                    continue;
+
+                root->m_updatePending = false;
+
+                const float oldValue = root->m_value;
+                root->m_value = root->calculateValue();
+                if ((root->m_value != oldValue) && root->m_connectedWidgetCallback)
+                    root->m_connectedWidgetCallback();
+            }
+
+            state.passOrder.clear();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout* Layout::getRightOperand() const
+    void Layout::beginDeferredUpdates()
     {
-        return m_rightOperand ? m_rightOperand.get() : nullptr;
+        auto& state = getLayoutUpdateState();
+        ++state.deferDepth;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    void Layout::endDeferredUpdates()
     {
-        if (m_leftOperand)
-        {
-            TGUI_ASSERT(m_rightOperand != nullptr, "If a left operand exists then there should also be a right operand");
+        auto& state = getLayoutUpdateState();
+        TGUI_ASSERT(state.deferDepth > 0, "Layout::endDeferredUpdates called without matching call to beginDeferredUpdates");
+        --state.deferDepth;
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
-        }
-
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+        if ((state.deferDepth == 0) && !state.processing)
+            processScheduledUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const String& expression, Widget* widget, bool xAxis)
+    void Layout::parseBindingString(std::size_t stepIndex, const String& expression, Widget* widget, bool xAxis)
     {
+        Step& step = m_steps[stepIndex];
         if (expression == "x")
         {
-            m_operation = Operation::BindingPosX;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingPosX;
+            step.widget = widget;
         }
         else if (expression == "y")
         {
-            m_operation = Operation::BindingPosY;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingPosY;
+            step.widget = widget;
         }
         else if (expression == "left")
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingLeft;
+            step.widget = widget;
         }
         else if (expression == "top")
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingTop;
+            step.widget = widget;
         }
         else if (expression == "w" || expression == "width")
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingWidth;
+            step.widget = widget;
         }
         else if (expression == "h" || expression == "height")
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingHeight;
+            step.widget = widget;
         }
         else if (expression == "iw" || expression == "innerwidth")
         {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingInnerWidth;
+            step.widget = widget;
         }
         else if (expression == "ih" || expression == "innerheight")
         {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
+            step.operation = Operation::BindingInnerHeight;
+            step.widget = widget;
         }
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString(stepIndex, "width", widget, xAxis);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString(stepIndex, "height", widget, xAxis);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString(stepIndex, "innerwidth", widget, xAxis);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString(stepIndex, "innerheight", widget, xAxis);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString(stepIndex, "x", widget, xAxis);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString(stepIndex, "y", widget, xAxis);
         }
         else
         {
@@ -828,7 +1091,7 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(stepIndex, expression.substr(dotPos+1), widget->getParent(), xAxis);
 
                     // If there is no parent yet then patiently wait until the widget is added to its parent
                     return;
@@ -843,7 +1106,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (widgets[i]->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(stepIndex, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
 
@@ -854,7 +1117,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (widgets[i]->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(stepIndex, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
                     else // If there is no parent yet then patiently wait until the widget is added to its parent
@@ -866,9 +1129,6 @@ namespace tgui
             TGUI_PRINT_WARNING("failed to find bound widget in expression '" << expression << "'.");
             return;
         }
-
-        resetPointers();
-        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -876,35 +1136,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1015,8 +1275,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1024,8 +1284,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1074,14 +1334,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,60 +24,23 @@
 
 
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Global.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Utf.hpp>
 
-#include <cctype>
 #include <algorithm>
+#include <cstring>
+#include <cstdint>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
-    for (;;) \
-    { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
-            break; \
-        \
-        if (stream.peek() == '/') \
-        { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
-            else \
-                return "Unexpected '/' found."; \
-            \
-            continue; \
-        } \
-        break; \
-    } \
+    if (!skipWhitespaceAndComments(input)) \
+        return "Unexpected '/' found."; \
     \
-    if (stream.peek() == EOF) \
+    if (input.pos == input.end) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -91,77 +54,159 @@ namespace tgui
 {
     namespace
     {
+        /// The input is read directly from memory, the characters are only copied once they are stored in a node
+        struct InputBuffer
+        {
+            const char* begin;
+            const char* pos;
+            const char* end;
+            std::string scratch; // Reused for values that can't be copied from the input in one piece
+        };
+
         // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        String parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String sectionName);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isSpace(char c)
+        {
+            return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\v') || (c == '\f');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String toString(const char* first, const char* last)
+        {
+            // Most values only contain ASCII characters, which don't need to be decoded
+            if (std::all_of(first, last, [](char c){ return static_cast<unsigned char>(c) < 0x80; }))
+                return String{std::u32string(first, last)};
+            else
+                return String{utf::convertUtf8toUtf32(first, last)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Moves the position to the character behind the end of the line
+        void skipLineComment(InputBuffer& input)
+        {
+            const void* newline = std::memchr(input.pos, '\n', static_cast<std::size_t>(input.end - input.pos));
+            input.pos = newline ? static_cast<const char*>(newline) + 1 : input.end;
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        // Moves the position behind the "*/" that closes the comment, the position has to be placed behind the opening "/*"
+        void skipBlockComment(InputBuffer& input)
         {
-            String word = "";
-            while (stream.peek() != EOF)
+            while (input.pos != input.end)
             {
-                char c = static_cast<char>(stream.peek());
-                if (c == '\r')
+                const void* star = std::memchr(input.pos, '*', static_cast<std::size_t>(input.end - input.pos));
+                if (!star)
+                    break;
+
+                input.pos = static_cast<const char*>(star) + 1;
+                if ((input.pos != input.end) && (*input.pos == '/'))
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    ++input.pos;
+                    return;
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
-                {
-                    stream.read(&c, 1);
+            }
 
-                    if ((c == '/') && (stream.peek() == '/'))
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
-                            }
-                        }
-                    }
-                    else if ((c == '/') && (stream.peek() == '*'))
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '*')
-                            {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    else if (c == '"')
+            input.pos = input.end;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Moves the position behind the closing quote, the position has to be placed behind the opening quote
+        void skipQuotedString(InputBuffer& input)
+        {
+            bool backslash = false;
+            while (input.pos != input.end)
+            {
+                const char c = *input.pos++;
+                if ((c == '"') && !backslash)
+                    break;
+
+                backslash = ((c == '\\') && !backslash);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns false when a slash was found that doesn't start a comment
+        bool skipWhitespaceAndComments(InputBuffer& input)
+        {
+            while (input.pos != input.end)
+            {
+                if (isSpace(*input.pos))
+                    ++input.pos;
+                else if (*input.pos == '/')
+                {
+                    ++input.pos;
+                    if ((input.pos != input.end) && (*input.pos == '/'))
+                        skipLineComment(input);
+                    else if ((input.pos != input.end) && (*input.pos == '*'))
                     {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
+                        ++input.pos;
+                        skipBlockComment(input);
                     }
                     else
-                        word.push_back(c);
+                        return false;
                 }
                 else
-                    return word;
+                    break;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String readWord(InputBuffer& input)
+        {
+            // The word is only copied to the scratch buffer when it contains a comment
+            input.scratch.clear();
+            const char* runStart = input.pos;
+            const auto finishWord = [&input,&runStart](const char* runEnd){
+                if (input.scratch.empty())
+                    return toString(runStart, runEnd);
+
+                input.scratch.append(runStart, runEnd);
+                return toString(input.scratch.data(), input.scratch.data() + input.scratch.size());
+            };
+
+            while (input.pos != input.end)
+            {
+                const char c = *input.pos;
+                if (c == '\r')
+                {
+                    ++input.pos;
+                    return finishWord(input.pos - 1);
+                }
+                else if (isSpace(c) || (c == '=') || (c == ';') || (c == '{') || (c == '}'))
+                    return finishWord(input.pos);
+
+                ++input.pos;
+                if ((c == '/') && (input.pos != input.end) && (*input.pos == '/'))
+                {
+                    const char* runEnd = input.pos - 1;
+                    skipLineComment(input);
+                    if (input.pos[-1] != '\n')
+                        break;
+
+                    TGUI_ASSERT((runEnd != runStart) || !input.scratch.empty(), "There is no known case in which you can pass here "
+                                                                                "with an empty word (comment would have been skipped earlier)");
+                    return finishWord(runEnd);
+                }
+                else if ((c == '/') && (input.pos != input.end) && (*input.pos == '*'))
+                {
+                    input.scratch.append(runStart, input.pos - 1);
+                    ++input.pos;
+                    skipBlockComment(input);
+                    runStart = input.pos;
+                }
+                else if (c == '"')
+                    skipQuotedString(input);
             }
 
             return "";
@@ -169,259 +214,228 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
+        // Reads a value up to the ';' or '}' that ends it. Comments are removed and whitespace is collapsed into a single space.
+        // The line is stored in the scratch buffer of the input. False is returned when no value could be read.
+        bool readLine(InputBuffer& input)
         {
-            std::string line;
+            std::string& line = input.scratch;
+            line.clear();
+
+            const char* runStart = input.pos;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (input.pos != input.end)
             {
-                char c = static_cast<char>(stream.peek());
-
+                const char c = *input.pos;
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    ++input.pos;
+                    if ((input.pos != input.end) && (*input.pos == '/'))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
+                        line.append(runStart, input.pos - 1);
+                        skipLineComment(input);
+                        runStart = input.pos;
                     }
-                    else if (stream.peek() == '*')
+                    else if ((input.pos != input.end) && (*input.pos == '*'))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
+                        line.append(runStart, input.pos - 1);
+                        ++input.pos;
+                        skipBlockComment(input);
+                        runStart = input.pos;
                     }
                     else // The slash is part of the value
-                    {
                         whitespaceFound = false;
-                        line.push_back(c);
-                    }
-
-                    continue;
                 }
-
-                if (c == '"')
+                else if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
-
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
-
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
-                        return "";
-
-                    c = static_cast<char>(stream.peek());
+                    ++input.pos;
+                    skipQuotedString(input);
+                    whitespaceFound = false;
                 }
-
-                if ((c == '=') || (c == '{'))
-                    return "";
+                else if ((c == '=') || (c == '{'))
+                    return false;
                 else if ((c == ';') || (c == '}'))
                 {
+                    line.append(runStart, input.pos);
+
                     // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
+                    while (!line.empty() && (line.back() == ' '))
+                        line.pop_back();
+
+                    return true;
                 }
-                else if (::isspace(c))
+                else if (isSpace(c))
                 {
-                    stream.read(&c, 1);
-                    if (!whitespaceFound)
+                    // A single space can remain part of the run, other whitespace has to be replaced
+                    if (whitespaceFound || (c != ' '))
                     {
-                        whitespaceFound = true;
-                        line.push_back(' ');
+                        line.append(runStart, input.pos);
+                        if (!whitespaceFound)
+                            line.push_back(' ');
+
+                        runStart = input.pos + 1;
                     }
+
+                    whitespaceFound = true;
+                    ++input.pos;
                 }
                 else
                 {
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    ++input.pos;
                 }
             }
 
-            return "";
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Splits a value of the form "[a, b, c]" in its trimmed elements
+        void readValueList(const std::string& line, std::vector<String>& valueList)
+        {
+            if (line.size() < 3)
+                return;
+
+            const char* const listEnd = line.data() + line.size() - 1;
+            const char* elementStart = line.data() + 1;
+            const char* pos = elementStart;
+            for (;;)
+            {
+                if ((pos == listEnd) || (*pos == ','))
+                {
+                    const char* first = elementStart;
+                    const char* last = pos;
+                    while ((first != last) && isSpace(*first))
+                        ++first;
+                    while ((last != first) && isSpace(last[-1]))
+                        --last;
+
+                    valueList.push_back(toString(first, last));
+                    if (pos == listEnd)
+                        break;
+
+                    elementStart = ++pos;
+                }
+                else if (*pos == '"')
+                {
+                    ++pos;
+                    bool backslash = false;
+                    while (pos != listEnd)
+                    {
+                        const char c = *pos++;
+                        if ((c == '"') && !backslash)
+                            break;
+
+                        backslash = ((c == '\\') && !backslash);
+                    }
+                }
+                else
+                    ++pos;
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
+        String parseKeyValue(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String key)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the assignment symbol and the whitespace behind it
+            ++input.pos;
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (*input.pos == '{')
+                return parseSection(input, node, std::move(key));
 
             // Read the value
-            String line = readLine(stream).trim();
-            if (!line.empty())
+            if (readLine(input) && !input.scratch.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (*input.pos == ';')
+                    ++input.pos;
 
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
+                valueNode->setValue(toString(input.scratch.data(), input.scratch.data() + input.scratch.size()));
 
                 // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                const std::string& line = input.scratch;
+                if ((line.size() >= 2) && (line.front() == '[') && (line.back() == ']'))
                 {
                     valueNode->listNode = true;
-                    if (line.size() >= 3)
-                    {
-                        valueNode->valueList.push_back("");
-
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
-                        {
-                            if (line[i] == ',')
-                            {
-                                i++;
-                                valueNode->valueList.back() = valueNode->valueList.back().trim();
-                                valueNode->valueList.push_back("");
-                            }
-                            else if (line[i] == '"')
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-                                i++;
-
-                                bool backslash = false;
-                                while (i < line.size()-1)
-                                {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
-
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
-                                }
-                            }
-                            else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-                                i++;
-                            }
-                        }
-
-                        valueNode->valueList.back() = valueNode->valueList.back().trim();
-                    }
+                    readValueList(line, valueNode->valueList);
                 }
 
-                node->propertyValuePairs[key] = std::move(valueNode);
+                node->propertyValuePairs[std::move(key)] = std::move(valueNode);
                 return "";
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.pos == input.end)
                     return "Found EOF while trying to read a value.";
+                else if (*input.pos == '=')
+                    return "Found '=' while trying to read a value.";
+                else if (*input.pos == '{')
+                    return "Found '{' while trying to read a value.";
                 else
-                {
-                    chr = static_cast<char>(stream.peek());
-                    if (chr == '=')
-                        return "Found '=' while trying to read a value.";
-                    else if (chr == '{')
-                        return "Found '{' while trying to read a value.";
-                    else
-                        return "Found empty value.";
-                }
+                    return "Found empty value.";
             }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            sectionNode->name = std::move(sectionName);
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the brace
+            ++input.pos;
 
-            while (stream.peek() != EOF)
+            while (input.pos != input.end)
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                String word = readWord(stream);
-                if (word == "")
+                String word = readWord(input);
+                if (word.empty())
                 {
-                    if (stream.peek() == EOF)
+                    if (input.pos == input.end)
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (*input.pos == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        ++input.pos;
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (*input.pos == ';')
+                            ++input.pos;
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (*input.pos != '{')
+                        return "Expected property or nested section name, found '" + String(1, *input.pos) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (*input.pos == '{')
                 {
-                    const String error = parseSection(stream, sectionNode, word);
+                    const String error = parseSection(input, sectionNode, std::move(word));
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (*input.pos == '=')
                 {
-                    const String error = parseKeyValue(stream, sectionNode, word);
+                    const String error = parseKeyValue(input, sectionNode, std::move(word));
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{' or '=', found '" + String(1, *input.pos) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -429,29 +443,462 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        String parseRootSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            String word = readWord(stream);
-            if (word == "")
+            String word = readWord(input);
+            if (word.empty())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (*input.pos != '{')
+                    return "Expected section name, found '" + String(1, *input.pos) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+            if (*input.pos == '{')
+                return parseSection(input, root, std::move(word));
+            else if (*input.pos == '=')
+                return parseKeyValue(input, root, std::move(word));
             else
-                return "Expected '{' or '=', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{' or '=', found '" + String(1, *input.pos) + "' instead.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The binary format starts with a byte that can't occur at the start of a text file, followed by the format version
+        const char binaryMagic[] = {'\0', 'T', 'G', 'U', 'I', 'B', 'I', 'N'};
+        const std::uint32_t binaryVersion = 2;
+
+        // Maximum amount of nested sections that the binary parser accepts
+        const unsigned int maxBinaryNestingDepth = 256;
+
+        // Each value is stored as a record that starts with one of these tags, which determines how the rest of it is stored
+        enum class BinaryValueTag : std::uint8_t
+        {
+            Text,    //!< Value that is stored as it was written in the text file
+            List,    //!< Value that is a list, followed by the amount of list values and the values themselves
+            String,  //!< String without quotes or escape sequences
+            Number,  //!< Float
+            Bool,    //!< Single byte that is either 0 or 1
+            Color,   //!< Notation of the color (ColorNotation), followed by red, green, blue and alpha bytes
+            Outline  //!< Left, top, right and bottom as floats
+        };
+
+        // Notations in which colors can be stored in binary form, other notations are stored as text
+        enum class ColorNotation : std::uint8_t
+        {
+            Hex,  //!< "#RRGGBB" or "#RRGGBBAA" with uppercase digits, the alpha is only written when it isn't 255
+            Rgb,  //!< "rgb(r, g, b)"
+            Rgba  //!< "rgba(r, g, b, a)"
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String colorToString(const Color& color, ColorNotation notation)
+        {
+            if (notation == ColorNotation::Hex)
+            {
+                const char hexDigits[] = "0123456789ABCDEF";
+                std::string str = "#";
+                const unsigned char components[] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+                for (std::size_t i = 0; i < ((color.getAlpha() < 255) ? 4u : 3u); ++i)
+                {
+                    str.push_back(hexDigits[components[i] / 16]);
+                    str.push_back(hexDigits[components[i] % 16]);
+                }
+                return String(str);
+            }
+
+            String str = (notation == ColorNotation::Rgb) ? U"rgb(" : U"rgba(";
+            str += String::fromNumber(static_cast<unsigned int>(color.getRed())) + U", "
+                 + String::fromNumber(static_cast<unsigned int>(color.getGreen())) + U", "
+                 + String::fromNumber(static_cast<unsigned int>(color.getBlue()));
+            if (notation == ColorNotation::Rgba)
+                str += U", " + String::fromNumber(static_cast<unsigned int>(color.getAlpha()));
+            return str + U")";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns in which notation the color was written, or false if it wasn't written in one of the supported notations
+        bool findColorNotation(const Color& color, const String& value, ColorNotation& notation)
+        {
+            for (const auto possibleNotation : {ColorNotation::Hex, ColorNotation::Rgb, ColorNotation::Rgba})
+            {
+                if (colorToString(color, possibleNotation) == value)
+                {
+                    notation = possibleNotation;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Recognizes the type of a value from its syntax. A value is only given a type when converting it back to a string
+        // results in the same value, so that the parser can recreate the string without losing anything.
+        ObjectConverter deserializeRecognizableValue(const String& value)
+        {
+            if (value.empty())
+                return {};
+
+            if ((value == U"true") || (value == U"false"))
+                return {value == U"true"};
+
+            float number;
+            if (value.attemptToFloat(number) && (String::fromNumber(number) == value))
+                return {number};
+
+            try
+            {
+                if ((value[0] == '#') || value.startsWith(U"rgb"))
+                {
+                    ObjectConverter color = Deserializer::deserialize(ObjectConverter::Type::Color, value);
+                    ColorNotation notation;
+                    if (findColorNotation(color.getColor(), value, notation))
+                        return color;
+                    else
+                        return {};
+                }
+
+                if (value[0] == '(')
+                {
+                    const Outline outline = Deserializer::deserialize(ObjectConverter::Type::Outline, value).getOutline();
+                    const Outline absoluteOutline{outline.getLeft(), outline.getTop(), outline.getRight(), outline.getBottom()};
+                    if (absoluteOutline.toString() == value)
+                        return {absoluteOutline};
+                    else
+                        return {};
+                }
+
+                ObjectConverter str = Deserializer::deserialize(ObjectConverter::Type::String, value);
+                if (Serializer::serialize(ObjectConverter{str}) == value)
+                    return str;
+            }
+            catch (const Exception&)
+            {
+            }
+
+            return {};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Numbers are always stored in little-endian byte order, so that the data can be loaded on any platform
+        void writeBinary(std::stringstream& stream, std::uint32_t value)
+        {
+            const char bytes[] = {static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+                                  static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF)};
+            stream.write(bytes, sizeof(bytes));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        void writeBinary(std::stringstream& stream, std::uint8_t value)
+        {
+            stream.put(static_cast<char>(value));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinary(std::stringstream& stream, float value)
+        {
+            static_assert(sizeof(float) == sizeof(std::uint32_t), "Float has to be 32-bit to be stored in binary format");
+
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            writeBinary(stream, bits);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinary(std::stringstream& stream, const String& str)
+        {
+            const std::string utf8 = str.toStdString();
+            writeBinary(stream, static_cast<std::uint32_t>(utf8.length()));
+            stream.write(utf8.data(), static_cast<std::streamsize>(utf8.length()));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinary(std::stringstream& stream, const DataIO::ValueNode& valueNode)
+        {
+            if (valueNode.listNode)
+            {
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::List));
+                writeBinary(stream, valueNode.getValue());
+                writeBinary(stream, static_cast<std::uint32_t>(valueNode.valueList.size()));
+                for (const auto& listValue : valueNode.valueList)
+                    writeBinary(stream, listValue);
+                return;
+            }
+
+            ObjectConverter typedValue = deserializeRecognizableValue(valueNode.getValue());
+            switch (typedValue.getType())
+            {
+            case ObjectConverter::Type::String:
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::String));
+                writeBinary(stream, typedValue.getString());
+                break;
+            case ObjectConverter::Type::Number:
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::Number));
+                writeBinary(stream, typedValue.getNumber());
+                break;
+            case ObjectConverter::Type::Bool:
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::Bool));
+                writeBinary(stream, static_cast<std::uint8_t>(typedValue.getBool() ? 1 : 0));
+                break;
+            case ObjectConverter::Type::Color:
+            {
+                const Color& color = typedValue.getColor();
+                ColorNotation notation = ColorNotation::Hex;
+                findColorNotation(color, valueNode.getValue(), notation);
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::Color));
+                writeBinary(stream, static_cast<std::uint8_t>(notation));
+                writeBinary(stream, color.getRed());
+                writeBinary(stream, color.getGreen());
+                writeBinary(stream, color.getBlue());
+                writeBinary(stream, color.getAlpha());
+                break;
+            }
+            case ObjectConverter::Type::Outline:
+            {
+                const Outline& outline = typedValue.getOutline();
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::Outline));
+                writeBinary(stream, outline.getLeft());
+                writeBinary(stream, outline.getTop());
+                writeBinary(stream, outline.getRight());
+                writeBinary(stream, outline.getBottom());
+                break;
+            }
+            default:
+                writeBinary(stream, static_cast<std::uint8_t>(BinaryValueTag::Text));
+                writeBinary(stream, valueNode.getValue());
+                break;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinary(std::stringstream& stream, const DataIO::Node& node)
+        {
+            writeBinary(stream, node.name);
+
+            writeBinary(stream, static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writeBinary(stream, pair.first);
+                writeBinary(stream, *pair.second);
+            }
+
+            // Nested sections are stored as child nodes
+            writeBinary(stream, static_cast<std::uint32_t>(node.children.size()));
+            for (const auto& child : node.children)
+                writeBinary(stream, *child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct BinaryInput
+        {
+            const char* pos;
+            const char* end;
+
+            void checkRemaining(std::size_t size) const
+            {
+                if (static_cast<std::size_t>(end - pos) < size)
+                    throw Exception{"Error while parsing binary input. Unexpected end of data."};
+            }
+
+            std::uint8_t readUint8()
+            {
+                checkRemaining(sizeof(std::uint8_t));
+                return static_cast<std::uint8_t>(*pos++);
+            }
+
+            std::uint32_t readUint32()
+            {
+                checkRemaining(sizeof(std::uint32_t));
+
+                const auto* bytes = reinterpret_cast<const unsigned char*>(pos);
+                pos += sizeof(std::uint32_t);
+                return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                     | (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+            }
+
+            float readFloat()
+            {
+                const std::uint32_t bits = readUint32();
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            String readString()
+            {
+                const std::size_t length = readUint32();
+                checkRemaining(length);
+
+                pos += length;
+                return toString(pos - length, pos);
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Functions that create the string of a typed value from the binary format when the string is requested
+        String stringValueToString(ObjectConverter value)
+        {
+            return Serializer::serialize(std::move(value));
+        }
+
+        String numberValueToString(ObjectConverter value)
+        {
+            return String::fromNumber(value.getNumber());
+        }
+
+        String boolValueToString(ObjectConverter value)
+        {
+            return value.getBool() ? U"true" : U"false";
+        }
+
+        String hexColorValueToString(ObjectConverter value)
+        {
+            return colorToString(value.getColor(), ColorNotation::Hex);
+        }
+
+        String rgbColorValueToString(ObjectConverter value)
+        {
+            return colorToString(value.getColor(), ColorNotation::Rgb);
+        }
+
+        String rgbaColorValueToString(ObjectConverter value)
+        {
+            return colorToString(value.getColor(), ColorNotation::Rgba);
+        }
+
+        String outlineValueToString(ObjectConverter value)
+        {
+            return value.getOutline().toString();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Typed values are only stored as deserialized value, the string is created when some code asks for it
+        void readBinary(BinaryInput& input, DataIO::ValueNode& valueNode)
+        {
+            switch (static_cast<BinaryValueTag>(input.readUint8()))
+            {
+            case BinaryValueTag::Text:
+                valueNode.setValue(input.readString());
+                break;
+            case BinaryValueTag::List:
+            {
+                valueNode.setValue(input.readString());
+                valueNode.listNode = true;
+
+                const std::uint32_t listSize = input.readUint32();
+                valueNode.valueList.reserve(std::min<std::size_t>(listSize, static_cast<std::size_t>(input.end - input.pos)));
+                for (std::uint32_t i = 0; i < listSize; ++i)
+                    valueNode.valueList.push_back(input.readString());
+                break;
+            }
+            case BinaryValueTag::String:
+                valueNode.setDeserializedValue(input.readString(), stringValueToString);
+                break;
+            case BinaryValueTag::Number:
+                valueNode.setDeserializedValue(input.readFloat(), numberValueToString);
+                break;
+            case BinaryValueTag::Bool:
+                valueNode.setDeserializedValue(input.readUint8() != 0, boolValueToString);
+                break;
+            case BinaryValueTag::Color:
+            {
+                const auto notation = static_cast<ColorNotation>(input.readUint8());
+                String (*colorValueToString)(ObjectConverter);
+                if (notation == ColorNotation::Hex)
+                    colorValueToString = hexColorValueToString;
+                else if (notation == ColorNotation::Rgb)
+                    colorValueToString = rgbColorValueToString;
+                else if (notation == ColorNotation::Rgba)
+                    colorValueToString = rgbaColorValueToString;
+                else
+                    throw Exception{"Error while parsing binary input. Unknown color notation."};
+
+                const std::uint8_t red = input.readUint8();
+                const std::uint8_t green = input.readUint8();
+                const std::uint8_t blue = input.readUint8();
+                const std::uint8_t alpha = input.readUint8();
+                valueNode.setDeserializedValue(Color{red, green, blue, alpha}, colorValueToString);
+                break;
+            }
+            case BinaryValueTag::Outline:
+            {
+                const float left = input.readFloat();
+                const float top = input.readFloat();
+                const float right = input.readFloat();
+                const float bottom = input.readFloat();
+                valueNode.setDeserializedValue(Outline{left, top, right, bottom}, outlineValueToString);
+                break;
+            }
+            default:
+                throw Exception{"Error while parsing binary input. Unknown value type."};
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The depth is limited because the data may come from an untrusted file and each nested section needs stack space
+        void readBinary(BinaryInput& input, DataIO::Node& node, unsigned int depth)
+        {
+            if (depth > maxBinaryNestingDepth)
+                throw Exception{"Error while parsing binary input. Sections are nested too deeply."};
+
+            node.name = input.readString();
+
+            const std::uint32_t propertyCount = input.readUint32();
+            for (std::uint32_t i = 0; i < propertyCount; ++i)
+            {
+                String key = input.readString();
+
+                auto valueNode = std::make_unique<DataIO::ValueNode>();
+                readBinary(input, *valueNode);
+
+                // The properties were written in sorted order, so they can be appended at the back of the map
+                node.propertyValuePairs.emplace_hint(node.propertyValuePairs.end(), std::move(key), std::move(valueNode));
+            }
+
+            const std::uint32_t childCount = input.readUint32();
+            for (std::uint32_t i = 0; i < childCount; ++i)
+            {
+                auto child = std::make_unique<DataIO::Node>();
+                child->parent = &node;
+                readBinary(input, *child, depth + 1);
+                node.children.push_back(std::move(child));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> parseBinary(const char* data, std::size_t size)
+        {
+            BinaryInput input{data + sizeof(binaryMagic), data + size};
+            const std::uint32_t version = input.readUint32();
+            if (version != binaryVersion)
+                throw Exception{"Error while parsing binary input. Unsupported version (" + String::fromNumber(version) + ")."};
+
+            auto root = std::make_unique<DataIO::Node>();
+            readBinary(input, *root, 0);
+            if (input.pos != input.end)
+                throw Exception{"Error while parsing binary input. Unexpected data behind the root node."};
+
+            return root;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector<String> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
         {
             std::vector<String> output;
@@ -463,7 +910,7 @@ namespace tgui
             if (!node->propertyValuePairs.empty())
             {
                 for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                    output.emplace_back("    " + pair.first + " = " + pair.second->getValue() + ";");
             }
 
             if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
@@ -495,25 +942,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const String& DataIO::ValueNode::getValue() const
+    {
+        if (m_valueToString)
+        {
+            m_value = m_valueToString(m_deserializedValue);
+            m_valueToString = nullptr;
+        }
+
+        return m_value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::ValueNode::setValue(String value)
+    {
+        m_value = std::move(value);
+        m_deserializedValue = {};
+        m_valueToString = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::ValueNode::setDeserializedValue(ObjectConverter value, String (*valueToString)(ObjectConverter))
+    {
+        m_deserializedValue = std::move(value);
+        m_valueToString = valueToString;
+        m_value.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
+        const auto position = stream.tellg();
+        if (position == std::stringstream::pos_type(-1))
+            return std::make_unique<Node>();
+
+        const std::string contents = stream.str();
+        const auto offset = std::min(static_cast<std::size_t>(position), contents.size());
+
+        // Leave the stream in the same state as when all characters would have been read from it
+        stream.seekg(0, std::ios_base::end);
+        stream.setstate(std::ios_base::eofbit);
+
+        return parse(contents.data() + offset, contents.size() - offset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
+    {
+        if (isBinary(data, size))
+            return parseBinary(data, size);
+
         auto root = std::make_unique<Node>();
 
-        String error;
-        while (stream.peek() != EOF)
+        InputBuffer input{data, data, data + size, {}};
+        while (input.pos != input.end)
         {
-            error = parseRootSection(stream, root);
+            const String error = parseRootSection(input, root);
             if (!error.empty())
             {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    String str = stream.str();
-                    auto position = static_cast<std::iterator_traits<String::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, U'\n') + 1;
-                    throw Exception{"Error while parsing input at line " + String::fromNumber(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
+                // The line and column are only calculated when they are needed to report the error
+                const std::size_t lineNumber = static_cast<std::size_t>(std::count(input.begin, input.pos, '\n')) + 1;
+                const char* lineStart = input.pos;
+                while ((lineStart != input.begin) && (lineStart[-1] != '\n'))
+                    --lineStart;
+
+                // Continuation bytes of UTF-8 characters don't count as a separate column
+                const auto isCharacterStart = [](char c){ return (static_cast<unsigned char>(c) & 0xC0) != 0x80; };
+                const std::size_t column = static_cast<std::size_t>(std::count_if(lineStart, input.pos, isCharacterStart)) + 1;
+                throw Exception{"Error while parsing input at line " + String::fromNumber(lineNumber)
+                                + ", column " + String::fromNumber(column) + ". " + error};
             }
         }
 
@@ -522,10 +1023,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool DataIO::isBinary(const char* data, std::size_t size)
+    {
+        return (size >= sizeof(binaryMagic)) && (std::memcmp(data, binaryMagic, sizeof(binaryMagic)) == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        stream.write(binaryMagic, sizeof(binaryMagic));
+        writeBinary(stream, binaryVersion);
+        writeBinary(stream, *rootNode);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value << ";" << std::endl;
+            stream << pair.first << " = " << pair.second->getValue() << ";" << std::endl;
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
             stream << std::endl;
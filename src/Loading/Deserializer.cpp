@@ -30,11 +30,17 @@
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Global.hpp>
 #include <cstdint>
+#include <set>
 
 namespace tgui
 {
     namespace
     {
+        // Types for which setFunction was called, values of these types are always deserialized from their string
+        std::set<ObjectConverter::Type> replacedDeserializers;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         unsigned char hexToDec(char32_t c)
         {
             TGUI_ASSERT((c >= U'0' && c <= U'9') || (c >= U'a' && c <= U'f'), "hexToDec must be called with digit or lowercase hex character");
@@ -430,8 +436,8 @@ namespace tgui
 
         ObjectConverter deserializeRendererData(const String& renderer)
         {
-            std::stringstream ss{renderer.toStdString()};
-            auto node = DataIO::parse(ss);
+            const std::string rendererStr = renderer.toStdString();
+            auto node = DataIO::parse(rendererStr.data(), rendererStr.size());
 
             // The root node should contain exactly one child which is the node we need
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
@@ -439,7 +445,7 @@ namespace tgui
 
             auto rendererData = RendererData::create();
             for (const auto& pair : node->propertyValuePairs)
-                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->getValue()); // Did not compile with VS2015 Update 2 when using braces
 
             for (const auto& child : node->children)
             {
@@ -479,9 +485,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ObjectConverter Deserializer::deserialize(ObjectConverter::Type type, const DataIO::ValueNode& node)
+    {
+        if (replacedDeserializers.find(type) == replacedDeserializers.end())
+        {
+            const ObjectConverter::Type deserializedType = node.getDeserializedValue().getType();
+            if (deserializedType == type)
+                return node.getDeserializedValue();
+
+            // A single number is also a valid outline
+            if ((type == ObjectConverter::Type::Outline) && (deserializedType == ObjectConverter::Type::Number))
+                return Outline{ObjectConverter{node.getDeserializedValue()}.getNumber()};
+        }
+
+        return deserialize(type, node.getValue());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Deserializer::setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer)
     {
         m_deserializers[type] = deserializer;
+        replacedDeserializers.insert(type);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
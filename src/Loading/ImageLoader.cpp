@@ -24,8 +24,20 @@
 
 
 #include <TGUI/Loading/ImageLoader.hpp>
+#include <TGUI/Filesystem.hpp>
 #include <TGUI/Global.hpp>
 
+#if defined(TGUI_SYSTEM_WINDOWS)
+    #include <TGUI/extlibs/IncludeWindows.hpp>
+#endif
+
+#include <algorithm>
+#include <cstring> // memcpy
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <new>
+
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
 #   pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -49,6 +61,39 @@
 #   pragma warning(disable: 4505) // Unreferenced local function
 #endif
 
+// The decoded image is allocated with new[], so that it can be returned as a unique_ptr without copying it
+#define STBI_MALLOC(size) tgui::stbiMalloc(size)
+#define STBI_REALLOC_SIZED(ptr, oldSize, newSize) tgui::stbiReallocSized(ptr, oldSize, newSize)
+#define STBI_FREE(ptr) tgui::stbiFree(ptr)
+
+namespace tgui
+{
+    namespace
+    {
+        void* stbiMalloc(std::size_t size)
+        {
+            return new(std::nothrow) std::uint8_t[size];
+        }
+
+        void stbiFree(void* ptr)
+        {
+            delete[] static_cast<std::uint8_t*>(ptr);
+        }
+
+        void* stbiReallocSized(void* ptr, std::size_t oldSize, std::size_t newSize)
+        {
+            void* newPtr = stbiMalloc(newSize);
+            if (newPtr && ptr)
+            {
+                std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+                stbiFree(ptr);
+            }
+
+            return newPtr;
+        }
+    }
+}
+
 #define STBI_NO_STDIO
 #define STB_IMAGE_STATIC
 #define STBI_WINDOWS_UTF8
@@ -61,12 +106,186 @@
     #pragma warning(pop)
 #endif
 
-#include <cstring> // memcpy
-
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Header of a file in the disk cache, followed by the RGBA pixels
+        struct CachedImageHeader
+        {
+            char magic[8];
+            std::uint64_t sourceSize;
+            std::uint64_t sourceHash;
+            std::uint32_t width;
+            std::uint32_t height;
+        };
+
+        const char cachedImageMagic[8] = {'T', 'G', 'U', 'I', 'I', 'M', 'G', '1'};
+
+        const std::uint8_t ktx2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+        // Size of the identifier, header and index of a KTX2 file, after which the level index starts
+        const std::size_t ktx2LevelIndexOffset = 80;
+
+        // The cache directory can be changed on the main thread while images are decoded in the background
+        std::mutex diskCacheMutex;
+        String diskCacheDirectory;
+
+        // 64-bit FNV-1a hash of the encoded image, used to find the decoded version in the disk cache
+        std::uint64_t hashImageData(const std::uint8_t* data, std::size_t dataSize)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (std::size_t i = 0; i < dataSize; ++i)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+
+        FILE* openFile(const String& filename, bool write)
+        {
+#if defined(TGUI_SYSTEM_WINDOWS) // _wfopen_s is supported by MSVC and MinGW-w64
+            FILE* file = nullptr;
+            if (_wfopen_s(&file, filename.toWideString().c_str(), write ? L"wb" : L"rb") != 0)
+                return nullptr;
+            return file;
+#else
+            return fopen(filename.toStdString().c_str(), write ? "wb" : "rb");
+#endif
+        }
+
+        String getCachedImageFilename(const String& directory, std::uint64_t hash)
+        {
+            char name[17];
+            std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+            return (Filesystem::Path(directory) / (String(name) + ".tgui-image")).asString();
+        }
+
+        // Moves the file to its final name, replacing a file that might already be there
+        bool replaceFile(const String& oldFilename, const String& newFilename)
+        {
+#if defined(TGUI_SYSTEM_WINDOWS) // std::rename fails on Windows when the target already exists
+            return MoveFileExW(oldFilename.toWideString().c_str(), newFilename.toWideString().c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            return std::rename(oldFilename.toStdString().c_str(), newFilename.toStdString().c_str()) == 0;
+#endif
+        }
+
+        void removeFile(const String& filename)
+        {
+#if defined(TGUI_SYSTEM_WINDOWS)
+            DeleteFileW(filename.toWideString().c_str());
+#else
+            std::remove(filename.toStdString().c_str());
+#endif
+        }
+
+        std::unique_ptr<std::uint8_t[]> readCachedImage(const String& filename, std::size_t sourceSize, std::uint64_t sourceHash, Vector2u& imageSize)
+        {
+            FILE* file = openFile(filename, false);
+            if (!file)
+                return nullptr;
+
+            fseek(file, 0, SEEK_END);
+            const long bytesInFile = ftell(file);
+            fseek(file, 0, SEEK_SET);
+
+            // The pixels are read directly into the buffer that is returned. Nothing is allocated unless the file is exactly
+            // as large as the header claims, so that a truncated or corrupted cache file can't cause a huge allocation.
+            std::unique_ptr<std::uint8_t[]> pixels;
+            CachedImageHeader header;
+            if ((bytesInFile > 0) && (bytesInFile != std::numeric_limits<long>::max())
+             && (fread(&header, sizeof(header), 1, file) == 1)
+             && (std::memcmp(header.magic, cachedImageMagic, sizeof(cachedImageMagic)) == 0)
+             && (header.sourceSize == sourceSize) && (header.sourceHash == sourceHash)
+             && (header.width > 0) && (header.height > 0)
+             && (header.width <= STBI_MAX_DIMENSIONS) && (header.height <= STBI_MAX_DIMENSIONS))
+            {
+                const std::uint64_t pixelDataSize = static_cast<std::uint64_t>(header.width) * header.height * 4;
+                if ((pixelDataSize == static_cast<std::uint64_t>(bytesInFile) - sizeof(header))
+                 && (pixelDataSize <= std::numeric_limits<std::size_t>::max()))
+                {
+                    pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(pixelDataSize));
+                    if (fread(pixels.get(), 1, static_cast<std::size_t>(pixelDataSize), file) == pixelDataSize)
+                        imageSize = {header.width, header.height};
+                    else
+                        pixels = nullptr;
+                }
+            }
+
+            fclose(file);
+            return pixels;
+        }
+
+        void writeCachedImage(const String& filename, std::size_t sourceSize, std::uint64_t sourceHash, Vector2u imageSize, const std::uint8_t* pixels)
+        {
+            // The file is written under a temporary name first, so that a partially written file is never read
+            const String tempFilename = filename + ".tmp";
+            FILE* file = openFile(tempFilename, true);
+            if (!file)
+                return;
+
+            CachedImageHeader header;
+            std::memcpy(header.magic, cachedImageMagic, sizeof(cachedImageMagic));
+            header.sourceSize = sourceSize;
+            header.sourceHash = sourceHash;
+            header.width = imageSize.x;
+            header.height = imageSize.y;
+
+            const std::size_t pixelDataSize = static_cast<std::size_t>(imageSize.x) * imageSize.y * 4;
+            const bool written = (fwrite(&header, sizeof(header), 1, file) == 1) && (fwrite(pixels, 1, pixelDataSize, file) == pixelDataSize);
+            fclose(file);
+
+            if (!written || !replaceFile(tempFilename, filename))
+                removeFile(tempFilename);
+        }
+
+        // KTX2 files are always little-endian
+        std::uint64_t readLittleEndian(const std::uint8_t* data, unsigned int byteCount)
+        {
+            std::uint64_t value = 0;
+            for (unsigned int i = 0; i < byteCount; ++i)
+                value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+
+            return value;
+        }
+
+        // The sRGB variants are treated the same as the UNORM formats, just like the pixels of a png aren't linearized either
+        bool getCompressedFormatFromVulkan(std::uint64_t vkFormat, BackendTexture::CompressedFormat& format)
+        {
+            switch (vkFormat)
+            {
+                case 131: case 132: format = BackendTexture::CompressedFormat::BC1_RGB;    return true; // VK_FORMAT_BC1_RGB_*_BLOCK
+                case 133: case 134: format = BackendTexture::CompressedFormat::BC1_RGBA;   return true; // VK_FORMAT_BC1_RGBA_*_BLOCK
+                case 135: case 136: format = BackendTexture::CompressedFormat::BC2;        return true; // VK_FORMAT_BC2_*_BLOCK
+                case 137: case 138: format = BackendTexture::CompressedFormat::BC3;        return true; // VK_FORMAT_BC3_*_BLOCK
+                case 145: case 146: format = BackendTexture::CompressedFormat::BC7;        return true; // VK_FORMAT_BC7_*_BLOCK
+                case 147: case 148: format = BackendTexture::CompressedFormat::ETC2_RGB;   return true; // VK_FORMAT_ETC2_R8G8B8_*_BLOCK
+                case 149: case 150: format = BackendTexture::CompressedFormat::ETC2_RGBA1; return true; // VK_FORMAT_ETC2_R8G8B8A1_*_BLOCK
+                case 151: case 152: format = BackendTexture::CompressedFormat::ETC2_RGBA;  return true; // VK_FORMAT_ETC2_R8G8B8A8_*_BLOCK
+                default: return false;
+            }
+        }
+
+        std::size_t getCompressedBlockSize(BackendTexture::CompressedFormat format)
+        {
+            switch (format)
+            {
+                case BackendTexture::CompressedFormat::BC1_RGB:
+                case BackendTexture::CompressedFormat::BC1_RGBA:
+                case BackendTexture::CompressedFormat::ETC2_RGB:
+                case BackendTexture::CompressedFormat::ETC2_RGBA1:
+                    return 8;
+                default:
+                    return 16;
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
@@ -83,27 +302,113 @@ namespace tgui
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize)
     {
-        std::unique_ptr<std::uint8_t[]> pixelData = nullptr;
+        String cacheDirectory;
+        {
+            std::lock_guard<std::mutex> lock(diskCacheMutex);
+            cacheDirectory = diskCacheDirectory;
+        }
+
+        std::uint64_t hash = 0;
+        String cachedImageFilename;
+        if (!cacheDirectory.empty())
+        {
+            hash = hashImageData(data, dataSize);
+            cachedImageFilename = getCachedImageFilename(cacheDirectory, hash);
+
+            auto cachedPixels = readCachedImage(cachedImageFilename, dataSize, hash, imageSize);
+            if (cachedPixels)
+                return cachedPixels;
+        }
 
         int imgWidth;
         int imgHeight;
         int imgChannels;
-        stbi_uc* buffer = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4);
-        if (!buffer)
-            return pixelData;
+        std::unique_ptr<std::uint8_t[]> pixelData{stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4)};
+        if (!pixelData || (imgWidth <= 0) || (imgHeight <= 0))
+            return nullptr;
+
+        imageSize.x = static_cast<unsigned int>(imgWidth);
+        imageSize.y = static_cast<unsigned int>(imgHeight);
+
+        if (!cachedImageFilename.empty())
+            writeCachedImage(cachedImageFilename, dataSize, hash, imageSize, pixelData.get());
+
+        return pixelData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ImageLoader::isCompressedTexture(const std::uint8_t* data, std::size_t dataSize)
+    {
+        return (dataSize >= sizeof(ktx2Identifier)) && (std::memcmp(data, ktx2Identifier, sizeof(ktx2Identifier)) == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ImageLoader::loadCompressedFromMemory(const std::uint8_t* data, std::size_t dataSize, BackendTexture::CompressedImage& image)
+    {
+        if (!isCompressedTexture(data, dataSize) || (dataSize < ktx2LevelIndexOffset))
+            return false;
+
+        BackendTexture::CompressedFormat format;
+        if (!getCompressedFormatFromVulkan(readLittleEndian(data + 12, 4), format))
+            return false;
+
+        const std::uint64_t width = readLittleEndian(data + 20, 4);
+        const std::uint64_t height = readLittleEndian(data + 24, 4);
+        const std::uint64_t depth = readLittleEndian(data + 28, 4);
+        const std::uint64_t layerCount = readLittleEndian(data + 32, 4);
+        const std::uint64_t faceCount = readLittleEndian(data + 36, 4);
+        const std::uint64_t supercompressionScheme = readLittleEndian(data + 44, 4);
+        if ((width == 0) || (height == 0) || (depth != 0) || (layerCount > 1) || (faceCount != 1) || (supercompressionScheme != 0))
+            return false;
+
+        // A level count of 0 requests mipmaps to be generated, which isn't possible for compressed data
+        const std::uint64_t levelCount = std::max<std::uint64_t>(1, readLittleEndian(data + 40, 4));
+        if ((levelCount > 32) || (dataSize < ktx2LevelIndexOffset + levelCount * 24))
+            return false;
+
+        const std::size_t blockSize = getCompressedBlockSize(format);
 
-        if ((imgWidth > 0) && (imgHeight > 0))
+        std::vector<BackendTexture::CompressedImage::Level> levels;
+        levels.reserve(static_cast<std::size_t>(levelCount));
+        for (std::size_t level = 0; level < levelCount; ++level)
         {
-            const std::size_t pixelDataSize = static_cast<std::size_t>(4 * imgWidth * imgHeight);
-            pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
-            std::memcpy(pixelData.get(), buffer, pixelDataSize);
+            const std::uint64_t byteOffset = readLittleEndian(data + ktx2LevelIndexOffset + level * 24, 8);
+            const std::uint64_t byteLength = readLittleEndian(data + ktx2LevelIndexOffset + level * 24 + 8, 8);
 
-            imageSize.x = static_cast<unsigned int>(imgWidth);
-            imageSize.y = static_cast<unsigned int>(imgHeight);
+            const std::uint64_t levelWidth = std::max<std::uint64_t>(1, width >> level);
+            const std::uint64_t levelHeight = std::max<std::uint64_t>(1, height >> level);
+            const std::uint64_t expectedLength = ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * blockSize;
+            if ((byteLength != expectedLength) || (byteOffset > dataSize) || (byteLength > dataSize - byteOffset))
+                return false;
+
+            levels.push_back({data + byteOffset, static_cast<std::size_t>(byteLength)});
         }
 
-        stbi_image_free(buffer);
-        return pixelData;
+        image.format = format;
+        image.size = {static_cast<unsigned int>(width), static_cast<unsigned int>(height)};
+        image.levels = std::move(levels);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::setDiskCacheDirectory(const String& directory)
+    {
+        if (!directory.empty() && !Filesystem::directoryExists(directory))
+            Filesystem::createDirectory(directory);
+
+        std::lock_guard<std::mutex> lock(diskCacheMutex);
+        diskCacheDirectory = directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ImageLoader::getDiskCacheDirectory()
+    {
+        std::lock_guard<std::mutex> lock(diskCacheMutex);
+        return diskCacheDirectory;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,9 +276,15 @@ namespace tgui
                 String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    node->children.push_back(DataIO::parse(ss));
-                    node->children.back()->name = pair.first;
+                    const std::string rendererStr = ObjectConverter{pair.second}.getString().toStdString();
+                    auto rendererRootNode = DataIO::parse(rendererStr.data(), rendererStr.size());
+
+                    // If there are braces around the renderer string, then the child node is the one we need
+                    if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
+                        rendererRootNode = std::move(rendererRootNode->children[0]);
+
+                    rendererRootNode->name = pair.first;
+                    node->children.push_back(std::move(rendererRootNode));
                 }
                 else
                 {
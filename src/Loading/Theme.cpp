@@ -33,6 +33,27 @@ namespace tgui
 {
     namespace
     {
+        // Copies the properties that were loaded from the theme loader. The copy shares the values with the loader until
+        // the properties are changed. Nested renderers are the exception, the loader shares them between all themes so they
+        // are replaced by a new renderer to make sure that changing them won't affect other themes.
+        PropertyValueMap copyThemeProperties(const PropertyValueMap& properties)
+        {
+            PropertyValueMap copiedProperties = properties;
+            for (const auto& pair : properties)
+            {
+                if (pair.second.getType() != ObjectConverter::Type::RendererData)
+                    continue;
+
+                auto rendererData = RendererData::create();
+                rendererData->propertyValuePairs = copyThemeProperties(ObjectConverter{pair.second}.getRenderer()->propertyValuePairs);
+                copiedProperties[pair.first] = ObjectConverter{rendererData};
+            }
+
+            return copiedProperties;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         struct DefaultTheme : public Theme
         {
             DefaultTheme()
@@ -337,60 +358,47 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
-
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
-
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<String, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            const PropertyValueMap oldPropertyValuePairs = std::move(renderer->propertyValuePairs);
+            renderer->propertyValuePairs = copyThemeProperties(*m_themeLoader->loadProperties(m_primary, pair.first));
+
+            // Find all changed properties, both new ones and old ones that were now reset to their default value
+            std::vector<String> changedProperties;
+            const PropertyValueMap& newPropertyValuePairs = renderer->propertyValuePairs;
+            auto oldIt = oldPropertyValuePairs.begin();
+            auto newIt = newPropertyValuePairs.begin();
+            while (oldIt != oldPropertyValuePairs.end() && newIt != newPropertyValuePairs.end())
             {
                 if (oldIt->first < newIt->first)
                 {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
+                    changedProperties.push_back(oldIt->first);
                     ++oldIt;
                 }
-                else
+                else if (newIt->first < oldIt->first)
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                    changedProperties.push_back(newIt->first);
+                    ++newIt;
                 }
-            }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
-
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
+                else
+                {
+                    if (oldIt->second != newIt->second)
+                        changedProperties.push_back(newIt->first);
 
-                ++newIt;
+                    ++oldIt;
+                    ++newIt;
+                }
             }
+            for (; oldIt != oldPropertyValuePairs.end(); ++oldIt)
+                changedProperties.push_back(oldIt->first);
+            for (; newIt != newPropertyValuePairs.end(); ++newIt)
+                changedProperties.push_back(newIt->first);
+
+            // Tell the widgets that were using this renderer about all the updated properties at once
+            if (!changedProperties.empty())
+                renderer->notifyObservers(changedProperties);
         }
     }
 
@@ -403,12 +411,10 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[id] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto& rendererData = m_renderers[id];
+        rendererData = RendererData::create();
+        rendererData->propertyValuePairs = copyThemeProperties(*m_themeLoader->loadProperties(m_primary, id));
+        return rendererData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -425,11 +431,9 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, id))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto& rendererData = m_renderers[id];
+        rendererData->propertyValuePairs = copyThemeProperties(*m_themeLoader->loadProperties(m_primary, id));
+        return rendererData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <sstream>
@@ -39,9 +40,62 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Converts a value from the theme file to the value that is stored in the cache.
+        // Most properties are kept as strings as their type is only known when a renderer accesses them. Values for which
+        // the type is obvious from their syntax are deserialized already, so that this only has to happen once per file.
+        ObjectConverter createCachedValue(const DataIO::ValueNode& valueNode)
+        {
+            // Colors that were already deserialized by the binary parser don't have to be parsed again
+            if (valueNode.getDeserializedValue().getType() == ObjectConverter::Type::Color)
+                return valueNode.getDeserializedValue();
+
+            const String& value = valueNode.getValue();
+            if (value.empty())
+                return ObjectConverter{value};
+
+            if (value[0] == '{')
+                return Deserializer::deserialize(ObjectConverter::Type::RendererData, value);
+
+            if ((value[0] == '#') || value.startsWithIgnoreCase(U"rgb"))
+            {
+                // Invalid colors will only be reported when the renderer actually tries to use the value
+                try
+                {
+                    return Deserializer::deserialize(ObjectConverter::Type::Color, value);
+                }
+                catch (const Exception&)
+                {
+                    return ObjectConverter{value};
+                }
+            }
+
+            return ObjectConverter{value};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The map is filled before creating the PropertyValueMap from it, so that copies of the cached properties can share them
+        std::shared_ptr<RendererData> createCachedRendererData(const DataIO::Node& node)
+        {
+            std::map<String, ObjectConverter> properties;
+            for (const auto& pair : node.propertyValuePairs)
+                properties[pair.first] = createCachedValue(*pair.second);
+
+            for (const auto& nestedProperty : node.children)
+                properties[nestedProperty->name] = ObjectConverter{createCachedRendererData(*nestedProperty)};
+
+            auto rendererData = std::make_shared<RendererData>();
+            rendererData->propertyValuePairs = PropertyValueMap{std::move(properties)};
+            return rendererData;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<String, std::map<String, std::map<String, String>>> DefaultThemeLoader::m_propertiesCache;
+    std::unordered_map<String, std::unordered_map<String, std::shared_ptr<const PropertyValueMap>>> DefaultThemeLoader::m_deserializedPropertiesCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,37 +105,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<const PropertyValueMap> BaseThemeLoader::loadProperties(const String& primary, const String& secondary)
+    {
+        auto properties = std::make_shared<PropertyValueMap>();
+        for (const auto& property : load(primary, secondary))
+            (*properties)[property.first] = ObjectConverter(property.second);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BaseThemeLoader::injectThemePath(const std::unique_ptr<DataIO::Node>& node, const String& path) const
     {
         for (const auto& pair : node->propertyValuePairs)
         {
             if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image") || (pair.first == U"Icon"))
             {
-                if (pair.second->value.empty() || pair.second->value.equalIgnoreCase(U"none") || pair.second->value.equalIgnoreCase(U"null") || pair.second->value.equalIgnoreCase(U"nullptr"))
+                if (pair.second->getValue().empty() || pair.second->getValue().equalIgnoreCase(U"none") || pair.second->getValue().equalIgnoreCase(U"null") || pair.second->getValue().equalIgnoreCase(U"nullptr"))
                     continue;
 
                 // Insert the path into the filename unless the filename is already an absolute path.
                 // We can't just deserialize the value to get rid of the quotes as it may contain things behind the filename.
-                if (pair.second->value[0] != '"')
+                if (pair.second->getValue()[0] != '"')
                 {
                 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[0] != '/') && (pair.second->value[0] != '\\') && ((pair.second->value.size() <= 1) || (pair.second->value[1] != ':')))
+                    if ((pair.second->getValue()[0] != '/') && (pair.second->getValue()[0] != '\\') && ((pair.second->getValue().size() <= 1) || (pair.second->getValue()[1] != ':')))
                 #else
-                    if (pair.second->value[0] != '/')
+                    if (pair.second->getValue()[0] != '/')
                 #endif
-                        pair.second->value = path + pair.second->value;
+                        pair.second->setValue(path + pair.second->getValue());
                 }
                 else // The filename is between quotes
                 {
-                    if (pair.second->value.size() <= 1)
+                    if (pair.second->getValue().size() <= 1)
                         continue;
 
                 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[1] != '/') && (pair.second->value[1] != '\\') && ((pair.second->value.size() <= 2) || (pair.second->value[2] != ':')))
+                    if ((pair.second->getValue()[1] != '/') && (pair.second->getValue()[1] != '\\') && ((pair.second->getValue().size() <= 2) || (pair.second->getValue()[2] != ':')))
                 #else
-                    if (pair.second->value[1] != '/')
+                    if (pair.second->getValue()[1] != '/')
                 #endif
-                        pair.second->value = '"' + path + pair.second->value.substr(1);
+                        pair.second->setValue('"' + path + pair.second->getValue().substr(1));
                 }
             }
         }
@@ -97,9 +162,9 @@ namespace tgui
         for (const auto& pair : node->propertyValuePairs)
         {
             // Check if this property is a reference to another section
-            if (!pair.second->value.empty() && (pair.second->value[0] == '&'))
+            if (!pair.second->getValue().empty() && (pair.second->getValue()[0] == '&'))
             {
-                const String name = Deserializer::deserialize(ObjectConverter::Type::String, pair.second->value.substr(1)).getString();
+                const String name = Deserializer::deserialize(ObjectConverter::Type::String, pair.second->getValue().substr(1)).getString();
                 const auto sectionsIt = sections.find(name);
                 if (sectionsIt == sections.end())
                     throw Exception{"Undefined reference to '" + name + "' encountered."};
@@ -110,7 +175,7 @@ namespace tgui
                 // Make a copy of the section
                 std::stringstream ss;
                 DataIO::emit(sectionsIt->second, ss);
-                pair.second->value = "{\n" + ss.str() + "}";
+                pair.second->setValue("{\n" + ss.str() + "}");
             }
         }
 
@@ -128,10 +193,13 @@ namespace tgui
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            m_deserializedPropertiesCache.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
+            m_deserializedPropertiesCache.clear();
         }
     }
 
@@ -163,20 +231,30 @@ namespace tgui
             // Resolve references to sections
             resolveReferences(sections, root);
 
-            // Cache all propery value pairs
+            // Cache all propery value pairs, both as strings and as values that can be copied directly into a renderer
+            auto& fileCache = m_propertiesCache[filename];
+            auto& deserializedFileCache = m_deserializedPropertiesCache[filename];
+            deserializedFileCache.reserve(sections.size());
             for (const auto& section : sections)
             {
                 const auto& child = section.second;
-                const String& name = section.first;
+                auto& sectionCache = fileCache[section.first];
+                std::map<String, ObjectConverter> properties;
                 for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][pair.first] = pair.second->value;
+                {
+                    sectionCache[pair.first] = pair.second->getValue();
+                    properties[pair.first] = createCachedValue(*pair.second);
+                }
 
                 for (const auto& nestedProperty : child.get()->children)
                 {
                     std::stringstream ss;
                     DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][nestedProperty->name] = "{\n" + ss.str() + "}";
+                    sectionCache[nestedProperty->name] = "{\n" + ss.str() + "}";
+                    properties[nestedProperty->name] = ObjectConverter{createCachedRendererData(*nestedProperty)};
                 }
+
+                deserializedFileCache[section.first] = std::make_shared<PropertyValueMap>(std::move(properties));
             }
         }
     }
@@ -191,10 +269,34 @@ namespace tgui
         if (filename.empty())
             return m_propertiesCache[""][section];
 
-        if (m_propertiesCache[filename].find(section) == m_propertiesCache[filename].end())
+        auto& fileCache = m_propertiesCache[filename];
+        const auto sectionIt = fileCache.find(section);
+        if (sectionIt == fileCache.end())
             throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
 
-        return m_propertiesCache[filename][section];
+        return sectionIt->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const PropertyValueMap> DefaultThemeLoader::loadProperties(const String& filename, const String& section)
+    {
+        preload(filename);
+
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename.empty())
+            return std::make_shared<PropertyValueMap>();
+
+        const auto fileIt = m_deserializedPropertiesCache.find(filename);
+        if (fileIt != m_deserializedPropertiesCache.end())
+        {
+            const auto sectionIt = fileIt->second.find(section);
+            if (sectionIt != fileIt->second.end())
+                return sectionIt->second;
+        }
+
+        // Derived classes may have added the section to m_propertiesCache themselves
+        return BaseThemeLoader::loadProperties(filename, section);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,7 +306,10 @@ namespace tgui
         if (filename.empty())
             return true;
         else
-            return m_propertiesCache[filename].find(section) != m_propertiesCache[filename].end();
+        {
+            const auto fileIt = m_propertiesCache.find(filename);
+            return (fileIt != m_propertiesCache.end()) && (fileIt->second.find(section) != fileIt->second.end());
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,10 +334,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{"Failed to open theme file '" + fullFilename + "'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), fileSize);
-
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(reinterpret_cast<const char*>(fileContents.get()), fileSize);
 
         String resourcePath;
         auto slashPos = filename.find_last_of("/\\");
@@ -0,0 +1,359 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PropertyValueMap.hpp>
+#include <TGUI/Utf.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Compares the property name with a UTF-8 string without having to construct a String from it
+        bool isSamePropertyName(const String& name, const char* utf8Name)
+        {
+            auto it = name.begin();
+            for (const char* c = utf8Name; *c != '\0'; ++c, ++it)
+            {
+                if (static_cast<unsigned char>(*c) >= 0x80)
+                    return name == String(utf8Name);
+
+                if ((it == name.end()) || (*it != static_cast<char32_t>(*c)))
+                    return false;
+            }
+
+            return it == name.end();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId getPropertyId(const String& name)
+    {
+        PropertyId hash = priv::propertyIdOffsetBasis;
+        std::string utf8Char;
+        for (const char32_t c : name)
+        {
+            if (c < 0x80)
+                hash = (hash ^ static_cast<unsigned char>(c)) * priv::propertyIdPrime;
+            else
+            {
+                utf8Char.clear();
+                utf::encodeCharUtf8(c, utf8Char);
+                for (const char byte : utf8Char)
+                    hash = (hash ^ static_cast<unsigned char>(byte)) * priv::propertyIdPrime;
+            }
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap() :
+        m_storage{getEmptyStorage()}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap(std::map<String, ObjectConverter> pairs) :
+        m_storage{std::make_shared<Storage>()}
+    {
+        m_storage->pairs = std::move(pairs);
+        m_storage->rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap(std::initializer_list<value_type> pairs) :
+        m_storage{std::make_shared<Storage>()}
+    {
+        m_storage->pairs = pairs;
+        m_storage->rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap(const PropertyValueMap& other)
+    {
+        copyFrom(other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap(PropertyValueMap&& other) noexcept :
+        m_storage{std::move(other.m_storage)},
+        m_writeAccessGiven{other.m_writeAccessGiven}
+    {
+        other.m_storage = getEmptyStorage();
+        other.m_writeAccessGiven = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap& PropertyValueMap::operator=(const PropertyValueMap& other)
+    {
+        if (this != &other)
+            copyFrom(other);
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap& PropertyValueMap::operator=(PropertyValueMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_storage = std::move(other.m_storage);
+            m_writeAccessGiven = other.m_writeAccessGiven;
+            other.m_storage = getEmptyStorage();
+            other.m_writeAccessGiven = false;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyValueMap::operator[](const String& property)
+    {
+        detach();
+
+        const PropertyId id = getPropertyId(property);
+        std::size_t pos = findIndexPosition(id);
+        auto& index = m_storage->index;
+        for (std::size_t i = pos; (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (index[i].it->first == property)
+                return index[i].it->second;
+        }
+
+        const auto it = m_storage->pairs.emplace(property, ObjectConverter{}).first;
+        index.insert(index.begin() + static_cast<std::ptrdiff_t>(pos), {id, it});
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::find(const String& property)
+    {
+        detach();
+
+        const PropertyId id = getPropertyId(property);
+        const auto& index = m_storage->index;
+        for (std::size_t i = findIndexPosition(id); (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (index[i].it->first == property)
+                return index[i].it;
+        }
+
+        return m_storage->pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::const_iterator PropertyValueMap::find(const String& property) const
+    {
+        const PropertyId id = getPropertyId(property);
+        const auto& index = m_storage->index;
+        for (std::size_t i = findIndexPosition(id); (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (index[i].it->first == property)
+                return index[i].it;
+        }
+
+        return m_storage->pairs.cend();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::find(PropertyId id, const char* property)
+    {
+        detach();
+
+        const auto& index = m_storage->index;
+        for (std::size_t i = findIndexPosition(id); (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (isSamePropertyName(index[i].it->first, property))
+                return index[i].it;
+        }
+
+        return m_storage->pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::const_iterator PropertyValueMap::find(PropertyId id, const char* property) const
+    {
+        const auto& index = m_storage->index;
+        for (std::size_t i = findIndexPosition(id); (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (isSamePropertyName(index[i].it->first, property))
+                return index[i].it;
+        }
+
+        return m_storage->pairs.cend();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::count(const String& property) const
+    {
+        return (find(property) != end()) ? 1 : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::erase(const String& property)
+    {
+        const auto it = find(property);
+        if (it == m_storage->pairs.end())
+            return 0;
+
+        erase(it);
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::erase(const_iterator it)
+    {
+        // The iterator may have been obtained with a const function while the properties were still shared with other maps
+        if (m_storage.use_count() > 1)
+            it = find(it->first);
+        else
+            detach();
+
+        const PropertyId id = getPropertyId(it->first);
+        auto& index = m_storage->index;
+        for (std::size_t i = findIndexPosition(id); (i < index.size()) && (index[i].id == id); ++i)
+        {
+            if (index[i].it == it)
+            {
+                index.erase(index.begin() + static_cast<std::ptrdiff_t>(i));
+                break;
+            }
+        }
+
+        return m_storage->pairs.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::clear()
+    {
+        m_storage = getEmptyStorage();
+        m_writeAccessGiven = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::begin()
+    {
+        detach();
+        return m_storage->pairs.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::end()
+    {
+        detach();
+        return m_storage->pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::findIndexPosition(PropertyId id) const
+    {
+        const auto& index = m_storage->index;
+        const auto it = std::lower_bound(index.begin(), index.end(), id,
+            [](const IndexEntry& entry, PropertyId value){ return entry.id < value; });
+        return static_cast<std::size_t>(it - index.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<PropertyValueMap::Storage>& PropertyValueMap::getEmptyStorage()
+    {
+        // Empty maps share the same storage, so that they don't need to allocate anything
+        static const std::shared_ptr<Storage> emptyStorage = std::make_shared<Storage>();
+        return emptyStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::detach()
+    {
+        if (m_storage.use_count() > 1)
+        {
+            auto storage = std::make_shared<Storage>();
+            storage->pairs = m_storage->pairs;
+            storage->rebuildIndex();
+            m_storage = std::move(storage);
+        }
+
+        m_writeAccessGiven = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::copyFrom(const PropertyValueMap& other)
+    {
+        if (other.m_writeAccessGiven)
+        {
+            auto storage = std::make_shared<Storage>();
+            storage->pairs = other.m_storage->pairs;
+            storage->rebuildIndex();
+            m_storage = std::move(storage);
+        }
+        else
+            m_storage = other.m_storage;
+
+        m_writeAccessGiven = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::Storage::rebuildIndex()
+    {
+        index.clear();
+        index.reserve(pairs.size());
+        for (auto it = pairs.begin(); it != pairs.end(); ++it)
+            index.push_back({getPropertyId(it->first), it});
+
+        std::sort(index.begin(), index.end(), [](const IndexEntry& left, const IndexEntry& right){ return left.id < right.id; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,15 +41,15 @@ namespace tgui
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("SpaceBetweenWidgets");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter distance = getDeserializedProperty(getPropertyId("SpaceBetweenWidgets"), "SpaceBetweenWidgets", ObjectConverter::Type::Number);
+        if (distance.getType() != ObjectConverter::Type::None)
+            return distance.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("Padding");
-            if (it != m_data->propertyValuePairs.end())
+            ObjectConverter paddingValue = getDeserializedProperty(getPropertyId("Padding"), "Padding", ObjectConverter::Type::Outline);
+            if (paddingValue.getType() != ObjectConverter::Type::None)
             {
-                const Padding padding = it->second.getOutline();
+                const Padding padding = paddingValue.getOutline();
                 return std::max(std::min(padding.getLeft(), padding.getRight()), std::min(padding.getTop(), padding.getBottom()));
             }
             else
@@ -56,14 +56,14 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("TitleBarHeight");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter height = getDeserializedProperty(getPropertyId("TitleBarHeight"), "TitleBarHeight", ObjectConverter::Type::Number);
+        if (height.getType() != ObjectConverter::Type::None)
+            return height.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("TextureTitleBar");
-            if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
-                return static_cast<float>(it->second.getTexture().getImageSize().y);
+            const Texture& texture = getTextureTitleBar();
+            if (texture.getData())
+                return static_cast<float>(texture.getImageSize().y);
             else
                 return 20;
         }
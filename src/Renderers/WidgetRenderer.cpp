@@ -26,6 +26,8 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -45,20 +47,54 @@ namespace tgui
         rendererData->shared = false;
 
         for (const auto& pair : rendererNode->propertyValuePairs)
-            rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+            rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->getValue()); // Did not compile with VS2015 Update 2 when using braces
 
+        // Nested renderers are created directly from their nodes instead of having to parse them again later
         for (const auto& nestedProperty : rendererNode->children)
-        {
-            std::stringstream ss;
-            DataIO::emit(nestedProperty, ss);
-            rendererData->propertyValuePairs[nestedProperty->name] = {String("{\n" + ss.str() + "}")};
-        }
+            rendererData->propertyValuePairs[nestedProperty->name] = {createFromDataIONode(nestedProperty.get())};
 
         return rendererData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RendererData::beginUpdate()
+    {
+        ++updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::endUpdate()
+    {
+        if ((updateDepth == 0) || (--updateDepth > 0))
+            return;
+
+        std::vector<String> properties;
+        properties.swap(changedProperties);
+        if (!properties.empty())
+            notifyObservers(properties);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::notifyObservers(const std::vector<String>& properties)
+    {
+        for (const auto& observer : observers)
+        {
+            const auto batchIt = batchObservers.find(observer.first);
+            if (batchIt != batchObservers.end())
+                batchIt->second(properties);
+            else
+            {
+                for (const auto& property : properties)
+                    observer.second(property);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,9 +129,9 @@ namespace tgui
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        ObjectConverter font = getDeserializedProperty(getPropertyId("Font"), "Font", ObjectConverter::Type::Font);
+        if (font.getType() != ObjectConverter::Type::None)
+            return font.getFont();
         else
             return {};
     }
@@ -111,9 +147,9 @@ namespace tgui
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
-        if (it != m_data->propertyValuePairs.end())
-            return static_cast<unsigned int>(it->second.getNumber());
+        ObjectConverter textSize = getDeserializedProperty(getPropertyId("TextSize"), "TextSize", ObjectConverter::Type::Number);
+        if (textSize.getType() != ObjectConverter::Type::None)
+            return static_cast<unsigned int>(textSize.getNumber());
         else
             return 0;
     }
@@ -122,11 +158,20 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const String& property, ObjectConverter&& value)
     {
-        if (m_data->propertyValuePairs[property] == value)
+        ObjectConverter& storedValue = m_data->propertyValuePairs[property];
+        if (storedValue == value)
             return;
 
-        const ObjectConverter oldValue = m_data->propertyValuePairs[property];
-        m_data->propertyValuePairs[property] = value;
+        if (m_data->updateDepth > 0)
+        {
+            storedValue = value;
+            if (std::find(m_data->changedProperties.begin(), m_data->changedProperties.end(), property) == m_data->changedProperties.end())
+                m_data->changedProperties.push_back(property);
+            return;
+        }
+
+        const ObjectConverter oldValue = storedValue;
+        storedValue = value;
 
         try
         {
@@ -144,8 +189,9 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const String& property) const
     {
-        auto it = m_data->propertyValuePairs.find(property);
-        if (it != m_data->propertyValuePairs.end())
+        const PropertyValueMap& pairs = m_data->propertyValuePairs;
+        auto it = pairs.find(property);
+        if (it != pairs.end())
             return it->second;
         else
             return {};
@@ -153,7 +199,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<String, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    ObjectConverter WidgetRenderer::getDeserializedProperty(PropertyId id, const char* property, ObjectConverter::Type type) const
+    {
+        const PropertyValueMap& pairs = m_data->propertyValuePairs;
+        const auto it = pairs.find(id, property);
+        if (it == pairs.end())
+            return {};
+
+        if ((it->second.getType() != ObjectConverter::Type::String) || (type == ObjectConverter::Type::String))
+            return it->second;
+
+        // Looking the property up through the non-const find gives the renderer data its own copy of the properties
+        ObjectConverter& value = m_data->propertyValuePairs.find(id, property)->second;
+        switch (type)
+        {
+        case ObjectConverter::Type::Font:
+            value.getFont();
+            break;
+        case ObjectConverter::Type::Color:
+            value.getColor();
+            break;
+        case ObjectConverter::Type::Outline:
+            value.getOutline();
+            break;
+        case ObjectConverter::Type::Bool:
+            value.getBool();
+            break;
+        case ObjectConverter::Type::Number:
+            value.getNumber();
+            break;
+        case ObjectConverter::Type::Texture:
+            value.getTexture();
+            break;
+        case ObjectConverter::Type::TextStyle:
+            value.getTextStyle();
+            break;
+        case ObjectConverter::Type::RendererData:
+            value.getRenderer();
+            break;
+        default:
+            break;
+        }
+
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const PropertyValueMap& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
@@ -167,9 +260,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(const String& property)>& function,
+                                   const std::function<void(const std::vector<String>& properties)>& batchFunction)
+    {
+        m_data->observers[id] = function;
+        m_data->batchObservers[id] = batchFunction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::unsubscribe(const void* id)
     {
         m_data->observers.erase(id);
+        m_data->batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +295,9 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->batchObservers = {};
+        data->changedProperties = {};
+        data->updateDepth = 0;
         return data;
     }
 
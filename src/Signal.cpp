@@ -27,6 +27,8 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +57,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -65,35 +67,118 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers || (id == 0))
+            return false;
+
+        auto& handlers = m_handlers->handlers;
+        const auto it = std::find_if(handlers.begin(), handlers.end(), [id](const Handler& handler){ return handler.id == id; });
+        if (it != handlers.end())
+        {
+            if (m_handlers->emitDepth > 0)
+            {
+                it->id = 0;
+                m_handlers->containsDisconnectedHandlers = true;
+            }
+            else
+                handlers.erase(it);
+
+            --m_handlers->connectedCount;
+            return true;
+        }
+
+        auto& pendingHandlers = m_handlers->pendingHandlers;
+        const auto pendingIt = std::find_if(pendingHandlers.begin(), pendingHandlers.end(), [id](const Handler& handler){ return handler.id == id; });
+        if (pendingIt != pendingHandlers.end())
+        {
+            pendingHandlers.erase(pendingIt);
+            --m_handlers->connectedCount;
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (!m_handlers)
+            return;
+
+        if (m_handlers->emitDepth > 0)
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.id = 0;
+
+            m_handlers->pendingHandlers.clear();
+            m_handlers->containsDisconnectedHandlers = true;
+        }
+        else
+            m_handlers->handlers.clear();
+
+        m_handlers->connectedCount = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!hasHandlers() || !m_enabled)
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
-            handler.second();
+        // The local copy of the shared pointer keeps the handlers alive in case the widget (and this signal) gets destroyed
+        // during a handler. The number of handlers is fixed beforehand, handlers connected during the emission aren't called.
+        const std::shared_ptr<HandlerList> handlerList = m_handlers;
+        const std::size_t handlerCount = handlerList->handlers.size();
+
+        ++handlerList->emitDepth;
+        for (std::size_t i = 0; i < handlerCount; ++i)
+        {
+            if (handlerList->handlers[i].id != 0)
+                handlerList->handlers[i].callback();
+        }
+        --handlerList->emitDepth;
+
+        if (handlerList->emitDepth == 0)
+        {
+            if (handlerList->containsDisconnectedHandlers)
+            {
+                handlerList->handlers.erase(std::remove_if(handlerList->handlers.begin(), handlerList->handlers.end(),
+                    [](const Handler& handler){ return handler.id == 0; }), handlerList->handlers.end());
+                handlerList->containsDisconnectedHandlers = false;
+            }
+
+            if (!handlerList->pendingHandlers.empty())
+            {
+                std::move(handlerList->pendingHandlers.begin(), handlerList->pendingHandlers.end(), std::back_inserter(handlerList->handlers));
+                handlerList->pendingHandlers.clear();
+            }
+        }
 
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int Signal::addHandler(std::function<void()> handler)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+
+        const auto id = ++m_lastSignalId;
+        if (m_handlers->emitDepth > 0)
+            m_handlers->pendingHandlers.push_back({id, std::move(handler)});
+        else
+            m_handlers->handlers.push_back({id, std::move(handler)});
+
+        ++m_handlers->connectedCount;
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Signal::getWidget()
     {
         return dereferenceParam<Widget*>(0)->shared_from_this();
@@ -103,7 +188,7 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&childWindow);
@@ -121,7 +206,7 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -134,7 +219,7 @@ namespace tgui
 
     bool SignalShowEffect::emit(const Widget* widget, ShowEffectType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -146,7 +231,7 @@ namespace tgui
 
     bool SignalAnimationType::emit(const Widget* widget, AnimationType type)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -157,7 +242,7 @@ namespace tgui
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&item);
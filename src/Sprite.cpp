@@ -26,7 +26,8 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Optional.hpp>
-#include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Timer.hpp>
 
 #include <cmath>
 
@@ -34,6 +35,31 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // When the size of an svg sprite changes again within this time, the resize is considered to still be in progress
+        Duration svgResizeSettleTime = std::chrono::milliseconds(150);
+
+        // How much a cached svg texture may differ in size from the sprite while it is being resized
+        const float svgResizeMaxDifference = 0.25f;
+
+        std::chrono::steady_clock::time_point svgRedrawTime;
+
+        // Makes sure that the screen gets redrawn after a resize has settled, so that the svg can be rasterized at its exact size.
+        // A single pending timer is enough: when it fires before all sprites have settled, they schedule a new redraw while drawn.
+        void scheduleSvgRedraw(std::chrono::steady_clock::time_point redrawTime)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if ((svgRedrawTime > now) && (svgRedrawTime <= redrawTime))
+                return;
+
+            svgRedrawTime = redrawTime;
+            Timer::scheduleCallback([]{}, std::chrono::duration_cast<std::chrono::nanoseconds>(redrawTime - now));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Sprite::Sprite(const Texture& texture)
     {
         setTexture(texture);
@@ -44,7 +70,9 @@ namespace tgui
     Sprite::Sprite(const Sprite& other) :
         m_size       (other.m_size),
         m_texture    (other.m_texture),
-        m_svgTexture (nullptr),
+        m_svgTexture (other.m_svgTexture),
+        m_svgTextureOutdated(other.m_svgTextureOutdated),
+        m_svgResizeTime(other.m_svgResizeTime),
         m_vertices   (other.m_vertices),
         m_indices    (other.m_indices),
         m_visibleRect(other.m_visibleRect),
@@ -54,8 +82,6 @@ namespace tgui
         m_position   (other.m_position),
         m_scalingType(other.m_scalingType)
     {
-        if (m_texture.getData() && m_texture.getData()->svgImage)
-            updateVertices();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +90,8 @@ namespace tgui
         m_size       (std::move(other.m_size)),
         m_texture    (std::move(other.m_texture)),
         m_svgTexture (std::move(other.m_svgTexture)),
+        m_svgTextureOutdated(std::move(other.m_svgTextureOutdated)),
+        m_svgResizeTime(std::move(other.m_svgResizeTime)),
         m_vertices   (std::move(other.m_vertices)),
         m_indices    (std::move(other.m_indices)),
         m_visibleRect(std::move(other.m_visibleRect)),
@@ -86,6 +114,8 @@ namespace tgui
             std::swap(m_size,        temp.m_size);
             std::swap(m_texture,     temp.m_texture);
             std::swap(m_svgTexture,  temp.m_svgTexture);
+            std::swap(m_svgTextureOutdated, temp.m_svgTextureOutdated);
+            std::swap(m_svgResizeTime, temp.m_svgResizeTime);
             std::swap(m_vertices,    temp.m_vertices);
             std::swap(m_indices,     temp.m_indices);
             std::swap(m_visibleRect, temp.m_visibleRect);
@@ -108,6 +138,8 @@ namespace tgui
             m_size        = std::move(other.m_size);
             m_texture     = std::move(other.m_texture);
             m_svgTexture  = std::move(other.m_svgTexture);
+            m_svgTextureOutdated = std::move(other.m_svgTextureOutdated);
+            m_svgResizeTime = std::move(other.m_svgResizeTime);
             m_vertices    = std::move(other.m_vertices);
             m_indices     = std::move(other.m_indices);
             m_visibleRect = std::move(other.m_visibleRect);
@@ -127,6 +159,8 @@ namespace tgui
     {
         m_texture = texture;
         m_vertexColor = m_texture.getColor();
+        m_svgTexture = nullptr;
+        m_svgTextureOutdated = false;
 
         if (isSet())
         {
@@ -352,6 +386,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::shared_ptr<BackendTexture>& Sprite::getSvgTexture() const
+    {
+        if (m_svgTextureOutdated)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (now - m_svgResizeTime >= std::chrono::nanoseconds(svgResizeSettleTime))
+            {
+                const Vector2u svgTextureSize{
+                    static_cast<unsigned int>(std::round(getSize().x)),
+                    static_cast<unsigned int>(std::round(getSize().y))};
+
+                m_svgTexture = TextureManager::getSvgTexture(m_texture.getData(), svgTextureSize);
+                m_svgTextureOutdated = false;
+            }
+            else
+                scheduleSvgRedraw(m_svgResizeTime + std::chrono::nanoseconds(svgResizeSettleTime));
+        }
+
+        return m_svgTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::setSvgResizeSettleTime(Duration settleTime)
+    {
+        svgResizeSettleTime = settleTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration Sprite::getSvgResizeSettleTime()
+    {
+        return svgResizeSettleTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::updateVertices()
     {
         // Figure out how the image is scaled best
@@ -360,14 +431,34 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = getBackend()->createTexture();
-
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            if (!m_svgTexture || (m_svgTexture->getSize() != svgTextureSize))
+            {
+                // While the size keeps changing, a cached texture with a nearby size is stretched instead of rasterizing
+                // the svg again for every intermediate size. The exact size is only rasterized once the resize settles.
+                const auto now = std::chrono::steady_clock::now();
+                std::shared_ptr<BackendTexture> svgTexture;
+                if (m_svgTexture && (now - m_svgResizeTime < std::chrono::nanoseconds(svgResizeSettleTime)))
+                    svgTexture = TextureManager::getNearbySvgTexture(m_texture.getData(), svgTextureSize, svgResizeMaxDifference);
+
+                if (svgTexture)
+                {
+                    m_svgTextureOutdated = (svgTexture->getSize() != svgTextureSize);
+                    if (m_svgTextureOutdated)
+                        scheduleSvgRedraw(now + std::chrono::nanoseconds(svgResizeSettleTime));
+                }
+                else
+                {
+                    svgTexture = TextureManager::getSvgTexture(m_texture.getData(), svgTextureSize);
+                    m_svgTextureOutdated = false;
+                }
+
+                m_svgTexture = std::move(svgTexture);
+                m_svgResizeTime = now;
+            }
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -201,7 +201,9 @@ namespace tgui
 
     bool SubwidgetContainer::updateTime(Duration elapsedTime)
     {
-        return m_container->updateTime(elapsedTime);
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        screenRefreshRequired |= m_container->updateTime(elapsedTime);
+        return screenRefreshRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
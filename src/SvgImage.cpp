@@ -33,10 +33,121 @@
 #define NANOSVGRAST_IMPLEMENTATION
 #include "TGUI/extlibs/nanosvg/nanosvgrast.h"
 
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <deque>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Images with less pixels than this are rasterized on the calling thread only, as splitting them isn't worth the overhead
+        const unsigned int minPixelsForParallelRasterization = 256 * 256;
+
+        // Bands are kept small enough that threads which finish early can help with the remaining ones
+        const unsigned int bandsPerThread = 2;
+        const unsigned int minBandHeight = 16;
+
+        // An image that is being rasterized in horizontal bands. The job lives on the stack of the thread that called
+        // SvgImage::rasterize, which only returns once all bands are finished, so workers never access a destroyed job.
+        struct RasterizeJob
+        {
+            NSVGimage* svg;
+            double scaleX;
+            double scaleY;
+            unsigned char* pixels;
+            unsigned int width;
+            unsigned int height;
+            unsigned int bandHeight;
+            unsigned int bandCount;
+            unsigned int nextBand = 0; // Protected by the pool mutex
+            unsigned int finishedBands = 0; // Protected by the pool mutex
+        };
+
+        // Data that is shared between the threads calling SvgImage::rasterize and the worker threads.
+        // The worker threads are detached and keep this object alive themselves, so it is never destroyed while they use it.
+        struct RasterizePool
+        {
+            std::mutex mutex;
+            std::condition_variable jobAvailable;
+            std::condition_variable bandFinished;
+            std::condition_variable workerStopped;
+            std::deque<RasterizeJob*> jobs; // Protected by the mutex, only contains jobs that still have unclaimed bands
+            unsigned int workers = 0; // Protected by the mutex
+            bool stopping = false; // Protected by the mutex, set while stopRasterizeThreads waits for the workers to quit
+        };
+
+        const std::shared_ptr<RasterizePool> rasterizePool = std::make_shared<RasterizePool>();
+
+        // Splitting the image only adds overhead when there are no other cores to rasterize the bands on, so by default
+        // images are only split when there are multiple hardware threads
+        std::atomic<unsigned int> maxRasterizeThreads{std::max(1u, std::min(8u, std::thread::hardware_concurrency()))};
+
+        void rasterizeBand(NSVGrasterizer* rasterizer, const RasterizeJob& job, unsigned int band)
+        {
+            const unsigned int top = band * job.bandHeight;
+            const unsigned int height = std::min(job.bandHeight, job.height - top);
+
+            // Each band is drawn as a separate image that is shifted upwards, so all bands together form the full image
+            nsvgRasterizeFull(rasterizer, job.svg, 0, -static_cast<double>(top), job.scaleX, job.scaleY,
+                              job.pixels + (static_cast<std::size_t>(top) * job.width * 4),
+                              static_cast<int>(job.width), static_cast<int>(height), static_cast<int>(job.width * 4));
+        }
+
+        // Claims the next band of the first job in the queue. The mutex must be locked when calling this function.
+        RasterizeJob* claimBand(RasterizePool& pool, unsigned int& band)
+        {
+            if (pool.jobs.empty())
+                return nullptr;
+
+            RasterizeJob* job = pool.jobs.front();
+            band = job->nextBand++;
+            if (job->nextBand == job->bandCount)
+                pool.jobs.pop_front();
+
+            return job;
+        }
+
+        void rasterizeInBackground(const std::shared_ptr<RasterizePool>& pool)
+        {
+            // Every worker has its own rasterizer, as it stores intermediate results
+            NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+
+            std::unique_lock<std::mutex> lock(pool->mutex);
+            while (true)
+            {
+                pool->jobAvailable.wait(lock, [&pool]{ return pool->stopping || !pool->jobs.empty(); });
+
+                // Jobs that are still in the queue are finished by the threads that are waiting for them
+                if (pool->stopping)
+                    break;
+
+                unsigned int band;
+                RasterizeJob* job = claimBand(*pool, band);
+
+                lock.unlock();
+                rasterizeBand(rasterizer, *job, band);
+                lock.lock();
+
+                if (++job->finishedBands == job->bandCount)
+                    pool->bandFinished.notify_all();
+            }
+
+            --pool->workers;
+            pool->workerStopped.notify_all();
+            lock.unlock();
+
+            nsvgDeleteRasterizer(rasterizer);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage(const String& filename)
@@ -89,12 +200,90 @@ namespace tgui
         const float scaleY = size.y / static_cast<float>(m_svg->height);
 
         auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeFull(m_rasterizer, m_svg, 0, 0, static_cast<double>(scaleX), static_cast<double>(scaleY), pixels.get(), size.x, size.y, size.x * 4);
+
+        RasterizeJob job;
+        job.svg = m_svg;
+        job.scaleX = static_cast<double>(scaleX);
+        job.scaleY = static_cast<double>(scaleY);
+        job.pixels = pixels.get();
+        job.width = size.x;
+        job.height = size.y;
+        job.bandHeight = size.y;
+        job.bandCount = 1;
+
+        const unsigned int threadCount = maxRasterizeThreads;
+        if ((threadCount > 1) && (size.x * size.y >= minPixelsForParallelRasterization))
+        {
+            job.bandCount = std::max(1u, std::min(threadCount * bandsPerThread, size.y / minBandHeight));
+            job.bandHeight = (size.y + job.bandCount - 1) / job.bandCount;
+            job.bandCount = (size.y + job.bandHeight - 1) / job.bandHeight;
+        }
+
+        if (job.bandCount == 1)
+        {
+            rasterizeBand(m_rasterizer, job, 0);
+            texture.load(size, std::move(pixels), true);
+            return;
+        }
+
+        // The calling thread rasterizes bands as well, so only threadCount-1 workers are needed
+        RasterizePool& pool = *rasterizePool;
+        std::unique_lock<std::mutex> lock(pool.mutex);
+        while (pool.workers + 1 < threadCount)
+        {
+            ++pool.workers;
+            const std::shared_ptr<RasterizePool> poolPtr = rasterizePool;
+            std::thread([poolPtr]{ rasterizeInBackground(poolPtr); }).detach();
+        }
+
+        pool.jobs.push_back(&job);
+        pool.jobAvailable.notify_all();
+
+        unsigned int band;
+        while (RasterizeJob* claimedJob = claimBand(pool, band))
+        {
+            lock.unlock();
+            rasterizeBand(m_rasterizer, *claimedJob, band);
+            lock.lock();
+
+            // The job might belong to another thread if several images are being rasterized at the same time
+            if ((++claimedJob->finishedBands == claimedJob->bandCount) && (claimedJob != &job))
+                pool.bandFinished.notify_all();
+        }
+
+        pool.bandFinished.wait(lock, [&job]{ return job.finishedBands == job.bandCount; });
+        lock.unlock();
 
         texture.load(size, std::move(pixels), true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setMaxRasterizeThreads(unsigned int threadCount)
+    {
+        maxRasterizeThreads = std::max(1u, threadCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int SvgImage::getMaxRasterizeThreads()
+    {
+        return maxRasterizeThreads;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::stopRasterizeThreads()
+    {
+        RasterizePool& pool = *rasterizePool;
+        std::unique_lock<std::mutex> lock(pool.mutex);
+        pool.stopping = true;
+        pool.jobAvailable.notify_all();
+        pool.workerStopped.wait(lock, [&pool]{ return pool.workers == 0; });
+        pool.stopping = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
 #include <algorithm>
 #include <vector>
 #include <cmath>
@@ -34,6 +35,20 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the index of the first whitespace character at or after the given index (or the length of the text)
+        std::size_t findWordEnd(const String& text, std::size_t index)
+        {
+            while ((index < text.length()) && !isWhitespace(text[index]))
+                ++index;
+
+            return index;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Text::Text() :
         m_backendText(getBackend()->createText())
     {
@@ -283,27 +298,41 @@ namespace tgui
         if (font == nullptr)
             return 0.0f;
 
+        const auto backendFont = font.getBackendFont();
         const bool bold = (textStyle & TextStyle::Bold) != 0;
 
         float width = 0.0f;
         char32_t prevChar = 0;
-        for (std::size_t i = 0; i < text.length(); ++i)
+        std::size_t i = 0;
+        while (i < text.length())
         {
-            float charWidth;
             const char32_t curChar = text[i];
             if (curChar == '\n')
                 break;
             else if (curChar == U'\r')
+            {
+                ++i;
                 continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
+            }
 
             const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
+            if ((curChar == U' ') || (curChar == U'\t'))
+            {
+                if (curChar == U'\t')
+                    width += kerning + font.getGlyph(' ', characterSize, bold).advance * 4.0f;
+                else
+                    width += kerning + font.getGlyph(curChar, characterSize, bold).advance;
 
-            width += charWidth + kerning;
-            prevChar = curChar;
+                prevChar = curChar;
+                ++i;
+            }
+            else // Measure an entire word at once, the font caches the widths of words
+            {
+                const std::size_t wordEnd = findWordEnd(text, i);
+                width += kerning + backendFont->getWordPrefixWidths(&text[i], wordEnd - i, characterSize, bold).back();
+                prevChar = text[wordEnd - 1];
+                i = wordEnd;
+            }
         }
 
         return width;
@@ -376,6 +405,8 @@ namespace tgui
         if (font == nullptr)
             return U"";
 
+        const auto backendFont = font.getBackendFont();
+
         String result;
         std::size_t index = 0;
         while (index < text.length())
@@ -385,10 +416,9 @@ namespace tgui
             // Find out how many characters we can get on this line
             float width = 0;
             char32_t prevChar = 0;
-            for (std::size_t i = index; i < text.length(); ++i)
+            while (index < text.length())
             {
-                float charWidth;
-                const char32_t curChar = text[i];
+                const char32_t curChar = text[index];
                 if (curChar == U'\n')
                 {
                     index++;
@@ -400,25 +430,41 @@ namespace tgui
                     index++;
                     continue;
                 }
-                else if (curChar == U'\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
                 const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
-                const bool isWhitespace = (curChar == U' ') || (curChar == U'\t');
-
-                // We add the character to the line, unless a non-whitespace character exceeds the line length.
-                // We don't break on whitespace characters because having a space at the beginning of the line looks wrong.
-                if ((maxWidth == 0) || isWhitespace || (width + charWidth + kerning <= maxWidth))
+                if ((curChar == U' ') || (curChar == U'\t'))
                 {
-                    width += kerning + charWidth;
+                    // We don't break on whitespace characters because having a space at the beginning of the line looks wrong
+                    if (curChar == U'\t')
+                        width += kerning + font.getGlyph(' ', textSize, bold).advance * 4;
+                    else
+                        width += kerning + font.getGlyph(curChar, textSize, bold).advance;
+
+                    prevChar = curChar;
                     index++;
+                    continue;
+                }
+
+                // Measure the entire word at once. The widths of words are cached by the font, so that wrapping the same text
+                // again with a different width doesn't require measuring all characters again.
+                const std::size_t wordEnd = findWordEnd(text, index);
+                const std::vector<float>& prefixWidths = backendFont->getWordPrefixWidths(&text[index], wordEnd - index, textSize, bold);
+                if ((maxWidth == 0) || (width + kerning + prefixWidths.back() <= maxWidth))
+                {
+                    width += kerning + prefixWidths.back();
+                    prevChar = text[wordEnd - 1];
+                    index = wordEnd;
                 }
                 else
-                    break;
+                {
+                    // Only the first part of the word still fits on this line
+                    std::size_t charsFitting = 0;
+                    while ((charsFitting < prefixWidths.size()) && (width + kerning + prefixWidths[charsFitting] <= maxWidth))
+                        charsFitting++;
 
-                prevChar = curChar;
+                    index += charsFitting;
+                    break;
+                }
             }
 
             // Every line contains at least one character
@@ -45,10 +45,9 @@
 
 namespace tgui
 {
-    bool Texture::m_defaultSmooth = true;
-
-    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
-    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = [](BackendTexture& backendTexture, const String& filename, bool smooth)
+    namespace
+    {
+        bool loadBackendTextureFromFile(BackendTexture& backendTexture, const String& filename, bool smooth)
         {
             Vector2u imageSize;
             auto pixelPtr = ImageLoader::loadFromFile(filename, imageSize);
@@ -56,7 +55,15 @@ namespace tgui
                 return false;
 
             return backendTexture.load(imageSize, std::move(pixelPtr), smooth);
-        };
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::m_defaultSmooth = true;
+
+    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
+    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = &loadBackendTextureFromFile;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -231,6 +238,20 @@ namespace tgui
         auto data = std::make_shared<TextureData>();
         data->backendTexture = getBackend()->createTexture();
 
+        if (ImageLoader::isCompressedTexture(fileData, fileDataSize))
+        {
+            BackendTexture::CompressedImage compressedImage;
+            if (!ImageLoader::loadCompressedFromMemory(fileData, fileDataSize, compressedImage))
+                throw Exception{"Failed to load compressed texture from provided memory location, the KTX2 file is invalid or has an unsupported format"};
+
+            if (!data->backendTexture->loadCompressed(compressedImage, smooth))
+                throw Exception{"Failed to load compressed texture, the format isn't supported by the backend renderer or graphics driver"};
+
+            m_id = "";
+            setTextureData(data, partRect, middleRect);
+            return;
+        }
+
         Vector2u imageSize;
         auto pixelPtr = ImageLoader::loadFromMemory(fileData, fileDataSize, imageSize);
         if (!pixelPtr)
@@ -270,6 +291,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::loadAsync(const String& id, const AsyncLoadedFunc& onLoaded, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        using TextureLoaderPtr = std::shared_ptr<TextureData>(*)(Texture&, const String&, bool);
+        using BackendTextureLoaderPtr = bool(*)(BackendTexture&, const String&, bool);
+        const auto* textureLoader = m_textureLoader.target<TextureLoaderPtr>();
+        const auto* backendTextureLoader = m_backendTextureLoader.target<BackendTextureLoaderPtr>();
+
+        // Only images that the default loaders would read from a file can be decoded in the background
+        const bool isSvg = ((id.length() > 4) && (id.substr(id.length() - 4, 4).equalIgnoreCase(".svg")));
+        if (id.empty() || isSvg
+         || !textureLoader || (*textureLoader != &TextureManager::getTexture)
+         || !backendTextureLoader || (*backendTextureLoader != &loadBackendTextureFromFile))
+        {
+            Texture texture;
+            try
+            {
+                texture.load(id, partRect, middleRect, smooth);
+            }
+            catch (const Exception&)
+            {
+                texture = Texture{};
+            }
+
+            onLoaded(texture);
+            return;
+        }
+
+#ifdef TGUI_SYSTEM_WINDOWS
+        const bool relativePath = ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')));
+#else
+        const bool relativePath = (id[0] != '/');
+#endif
+        const String filename = relativePath ? (getResourcePath() / id).asString() : id;
+
+        TextureManager::getTextureAsync(filename, smooth, [id,partRect,middleRect,onLoaded](std::shared_ptr<TextureData> data){
+            Texture texture;
+            if (data)
+            {
+                texture.m_id = id;
+                texture.m_copyCallback = &TextureManager::copyTexture;
+                texture.m_destructCallback = &TextureManager::removeTexture;
+                texture.setTextureData(data, partRect, middleRect);
+            }
+
+            onLoaded(texture);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const String& Texture::getId() const
     {
         return m_id;
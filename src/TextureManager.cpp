@@ -26,13 +26,154 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <condition_variable>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <deque>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    namespace
+    {
+        struct DecodedImage
+        {
+            String filename;
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels; // nullptr when decoding failed
+        };
+
+        // Data that is shared between the main thread and the worker threads that decode images.
+        // The worker threads are detached and keep this object alive themselves, so it is never destroyed while they use it.
+        struct AsyncDecodeQueue
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::condition_variable workerStopped;
+            std::deque<String> filesToDecode; // Protected by the mutex
+            std::vector<DecodedImage> decodedImages; // Protected by the mutex
+            unsigned int idleWorkers = 0; // Protected by the mutex
+            unsigned int workers = 0; // Protected by the mutex
+            bool stopping = false; // Protected by the mutex, set while stopAsyncLoads waits for the workers to quit
+        };
+
+        struct AsyncRequest
+        {
+            bool smooth;
+            std::function<void(std::shared_ptr<TextureData>)> callback;
+        };
+
+        const std::shared_ptr<AsyncDecodeQueue> asyncDecodeQueue = std::make_shared<AsyncDecodeQueue>();
+
+        // Only accessed on the main thread
+        std::unordered_map<String, std::vector<AsyncRequest>> asyncRequests;
+        std::deque<DecodedImage> imagesToUpload;
+        Duration asyncUploadTimeBudget = std::chrono::milliseconds(4);
+
+        struct SvgTextureCacheEntry
+        {
+            const TextureData* key;
+            std::weak_ptr<TextureData> data; // Used to detect that the svg was destroyed and a new one got the same address
+            Vector2u size;
+            std::shared_ptr<BackendTexture> texture;
+        };
+
+        // Rasterized svg images, ordered from most recently to least recently used.
+        // The index maps each svg to its entries in the list, there are usually only a few sizes per svg.
+        std::list<SvgTextureCacheEntry> svgTextureCache;
+        std::unordered_map<const TextureData*, std::vector<std::list<SvgTextureCacheEntry>::iterator>> svgTextureCacheIndex;
+        std::size_t svgTextureCacheSize = 128;
+
+        void removeSvgTextureCacheEntry(std::list<SvgTextureCacheEntry>::iterator entryIt)
+        {
+            const auto indexIt = svgTextureCacheIndex.find(entryIt->key);
+            if (indexIt != svgTextureCacheIndex.end())
+            {
+                auto& entries = indexIt->second;
+                entries.erase(std::remove(entries.begin(), entries.end(), entryIt), entries.end());
+                if (entries.empty())
+                    svgTextureCacheIndex.erase(indexIt);
+            }
+
+            svgTextureCache.erase(entryIt);
+        }
+
+        void removeSvgTextureCacheEntries(const TextureData* data)
+        {
+            const auto indexIt = svgTextureCacheIndex.find(data);
+            if (indexIt == svgTextureCacheIndex.end())
+                return;
+
+            for (const auto& entryIt : indexIt->second)
+                svgTextureCache.erase(entryIt);
+
+            svgTextureCacheIndex.erase(indexIt);
+        }
+
+        void shrinkSvgTextureCache()
+        {
+            // Sprites keep their own reference to the texture, so removing an entry never invalidates a texture that is in use
+            while (svgTextureCache.size() > svgTextureCacheSize)
+                removeSvgTextureCacheEntry(std::prev(svgTextureCache.end()));
+        }
+
+        // Returns the cached textures of the svg, or nullptr when it hasn't been rasterized yet
+        std::vector<std::list<SvgTextureCacheEntry>::iterator>* findSvgTextureCacheEntries(const std::shared_ptr<TextureData>& data)
+        {
+            const auto indexIt = svgTextureCacheIndex.find(data.get());
+            if (indexIt == svgTextureCacheIndex.end())
+                return nullptr;
+
+            // If the entries belong to an svg that no longer exists then they can't be reused
+            if (indexIt->second.front()->data.lock() != data)
+            {
+                removeSvgTextureCacheEntries(data.get());
+                return nullptr;
+            }
+
+            return &indexIt->second;
+        }
+
+        void decodeImagesInBackground(const std::shared_ptr<AsyncDecodeQueue>& queue)
+        {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+            while (true)
+            {
+                ++queue->idleWorkers;
+                queue->condition.wait(lock, [&queue]{ return queue->stopping || !queue->filesToDecode.empty(); });
+                --queue->idleWorkers;
+
+                if (queue->stopping)
+                {
+                    --queue->workers;
+                    queue->workerStopped.notify_all();
+                    return;
+                }
+
+                DecodedImage image;
+                image.filename = std::move(queue->filesToDecode.front());
+                queue->filesToDecode.pop_front();
+
+                lock.unlock();
+                image.pixels = ImageLoader::loadFromFile(image.filename, image.size);
+                lock.lock();
+
+                queue->decodedImages.push_back(std::move(image));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unordered_map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_map<const TextureData*, TextureDataHolder*> TextureManager::m_dataHolders;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,13 +220,19 @@ namespace tgui
         {
             data->svgImage.emplace(filename);
             if (data->svgImage->isSet())
+            {
+                m_dataHolders[data.get()] = &imageIt->second.back();
                 return data;
+            }
         }
         else // Not an svg
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
+            {
+                m_dataHolders[data.get()] = &imageIt->second.back();
                 return data;
+            }
         }
 
         // The image could not be loaded
@@ -99,52 +246,322 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
+    void TextureManager::getTextureAsync(const String& filename, bool smooth, const std::function<void(std::shared_ptr<TextureData>)>& callback)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        // Reuse the image if we already had it
+        const auto imageIt = m_imageMap.find(filename);
+        if (imageIt != m_imageMap.end())
         {
-            for (auto& data : dataHolder.second)
+            for (auto& dataHolder : imageIt->second)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                if (dataHolder.smooth == smooth)
                 {
-                    // The texture is now used at multiple places
-                    ++data.users;
+                    ++dataHolder.users;
+                    callback(dataHolder.data);
                     return;
                 }
             }
         }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        // If the image is already being loaded then the request only needs to wait for it
+        auto& requests = asyncRequests[filename];
+        requests.push_back({smooth, callback});
+        if (requests.size() > 1)
+            return;
+
+        const auto& queue = asyncDecodeQueue;
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->filesToDecode.push_back(filename);
+
+        // Start an extra worker thread when all existing ones are busy, up to one less than the amount of cores
+        const unsigned int maxWorkers = std::max(1u, std::min(4u, std::thread::hardware_concurrency() - 1));
+        if ((queue->idleWorkers == 0) && (queue->workers < maxWorkers))
+        {
+            ++queue->workers;
+            std::thread([queue]{ decodeImagesInBackground(queue); }).detach();
+        }
+        else
+            queue->condition.notify_one();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    bool TextureManager::processAsyncLoads()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        if (asyncRequests.empty())
+            return false;
+
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            std::lock_guard<std::mutex> lock(asyncDecodeQueue->mutex);
+            for (auto& image : asyncDecodeQueue->decodedImages)
+                imagesToUpload.push_back(std::move(image));
+
+            asyncDecodeQueue->decodedImages.clear();
+        }
+
+        const auto startTime = std::chrono::steady_clock::now();
+        bool texturesLoaded = false;
+        while (!imagesToUpload.empty())
+        {
+            if (texturesLoaded && (std::chrono::steady_clock::now() - startTime >= std::chrono::nanoseconds(asyncUploadTimeBudget)))
+                break;
+
+            DecodedImage image = std::move(imagesToUpload.front());
+            imagesToUpload.pop_front();
+
+            const auto requestsIt = asyncRequests.find(image.filename);
+            if (requestsIt == asyncRequests.end())
+                continue;
+
+            const std::vector<AsyncRequest> requests = std::move(requestsIt->second);
+            asyncRequests.erase(requestsIt);
+
+            // The same pixels are uploaded once for each smooth setting that was requested
+            const bool smoothRequested = std::any_of(requests.begin(), requests.end(), [](const AsyncRequest& request){ return request.smooth; });
+            const bool nonSmoothRequested = std::any_of(requests.begin(), requests.end(), [](const AsyncRequest& request){ return !request.smooth; });
+            std::shared_ptr<TextureData> smoothData;
+            std::shared_ptr<TextureData> nonSmoothData;
+            for (const bool smooth : {true, false})
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
+                if ((smooth && !smoothRequested) || (!smooth && !nonSmoothRequested))
+                    continue;
+
+                // The image might have been loaded synchronously while it was being decoded
+                std::shared_ptr<TextureData> data;
+                std::list<TextureDataHolder>& dataHolders = m_imageMap[image.filename];
+                for (auto& dataHolder : dataHolders)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
+                    if (dataHolder.smooth == smooth)
+                        data = dataHolder.data;
+                }
+
+                if (!data && image.pixels)
+                {
+                    std::unique_ptr<std::uint8_t[]> pixels;
+                    if (smooth && nonSmoothRequested)
                     {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
+                        const std::size_t pixelsSize = static_cast<std::size_t>(image.size.x) * image.size.y * 4;
+                        pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelsSize);
+                        std::memcpy(pixels.get(), image.pixels.get(), pixelsSize);
                     }
+                    else
+                        pixels = std::move(image.pixels);
 
-                    return;
+                    data = std::make_shared<TextureData>();
+                    data->backendTexture = getBackend()->createTexture();
+                    if (data->backendTexture->load(image.size, std::move(pixels), smooth))
+                    {
+                        TGUI_EMPLACE_BACK(dataHolder, dataHolders)
+                        dataHolder.filename = image.filename;
+                        dataHolder.smooth = smooth;
+                        dataHolder.data = data;
+                        m_dataHolders[data.get()] = &dataHolder;
+                    }
+                    else
+                        data = nullptr;
+                }
+
+                if (dataHolders.empty())
+                    m_imageMap.erase(image.filename);
+
+                if (smooth)
+                    smoothData = std::move(data);
+                else
+                    nonSmoothData = std::move(data);
+            }
+
+            // All users are counted before calling the callbacks, so that the data can't be removed while looping
+            for (const auto& request : requests)
+            {
+                const auto& data = request.smooth ? smoothData : nonSmoothData;
+                if (data)
+                    ++m_dataHolders[data.get()]->users;
+            }
+
+            for (const auto& request : requests)
+                request.callback(request.smooth ? smoothData : nonSmoothData);
+
+            texturesLoaded = true;
+        }
+
+        return texturesLoaded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::hasPendingAsyncLoads()
+    {
+        return !asyncRequests.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::stopAsyncLoads()
+    {
+        asyncRequests.clear();
+        imagesToUpload.clear();
+
+        const auto& queue = asyncDecodeQueue;
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        queue->filesToDecode.clear();
+        queue->stopping = true;
+        queue->condition.notify_all();
+        queue->workerStopped.wait(lock, [&queue]{ return queue->workers == 0; });
+        queue->stopping = false;
+
+        // Workers that were still decoding an image added it to the list before stopping
+        queue->decodedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncUploadTimeBudget(Duration budget)
+    {
+        asyncUploadTimeBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration TextureManager::getAsyncUploadTimeBudget()
+    {
+        return asyncUploadTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
+    {
+        const auto holderIt = m_dataHolders.find(textureDataToCopy.get());
+        if (holderIt == m_dataHolders.end())
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++holderIt->second->users;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        const auto holderIt = m_dataHolders.find(textureDataToRemove.get());
+        if (holderIt == m_dataHolders.end())
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        TextureDataHolder* dataHolder = holderIt->second;
+        if (--(dataHolder->users) > 0)
+            return;
+
+        m_dataHolders.erase(holderIt);
+
+        // There are at most a few entries per filename (one for each smooth setting), so searching the list is cheap
+        const auto imageIt = m_imageMap.find(dataHolder->filename);
+        TGUI_ASSERT(imageIt != m_imageMap.end(), "Texture data in TextureManager must belong to an image");
+        for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+        {
+            if (&*dataIt == dataHolder)
+            {
+                imageIt->second.erase(dataIt);
+                break;
+            }
+        }
+
+        if (imageIt->second.empty())
+            m_imageMap.erase(imageIt);
+
+        removeSvgTextureCacheEntries(textureDataToRemove.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> TextureManager::getSvgTexture(const std::shared_ptr<TextureData>& data, Vector2u size)
+    {
+        TGUI_ASSERT(data && data->svgImage, "TextureManager::getSvgTexture can only be called for svg images");
+
+        if (auto* entries = findSvgTextureCacheEntries(data))
+        {
+            for (const auto& entryIt : *entries)
+            {
+                if (entryIt->size == size)
+                {
+                    svgTextureCache.splice(svgTextureCache.begin(), svgTextureCache, entryIt);
+                    return entryIt->texture;
                 }
             }
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        auto texture = getBackend()->createTexture();
+        data->svgImage->rasterize(*texture, size);
+
+        svgTextureCache.push_front({data.get(), data, size, texture});
+        svgTextureCacheIndex[data.get()].push_back(svgTextureCache.begin());
+        shrinkSvgTextureCache();
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> TextureManager::getNearbySvgTexture(const std::shared_ptr<TextureData>& data, Vector2u size, float maxRelativeDifference)
+    {
+        auto* entries = findSvgTextureCacheEntries(data);
+        if (!entries)
+            return nullptr;
+
+        const auto getDifference = [](unsigned int a, unsigned int b){ return (a > b) ? (a - b) : (b - a); };
+        const float maxDifferenceX = static_cast<float>(size.x) * maxRelativeDifference;
+        const float maxDifferenceY = static_cast<float>(size.y) * maxRelativeDifference;
+
+        auto bestEntryIt = svgTextureCache.end();
+        unsigned int bestDifference = 0;
+        for (const auto& entryIt : *entries)
+        {
+            const unsigned int differenceX = getDifference(entryIt->size.x, size.x);
+            const unsigned int differenceY = getDifference(entryIt->size.y, size.y);
+            if ((static_cast<float>(differenceX) > maxDifferenceX) || (static_cast<float>(differenceY) > maxDifferenceY))
+                continue;
+
+            if ((bestEntryIt == svgTextureCache.end()) || (differenceX + differenceY < bestDifference))
+            {
+                bestEntryIt = entryIt;
+                bestDifference = differenceX + differenceY;
+            }
+        }
+
+        if (bestEntryIt == svgTextureCache.end())
+            return nullptr;
+
+        svgTextureCache.splice(svgTextureCache.begin(), svgTextureCache, bestEntryIt);
+        return bestEntryIt->texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setSvgTextureCacheSize(std::size_t maxTextures)
+    {
+        svgTextureCacheSize = maxTextures;
+        shrinkSvgTextureCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getSvgTextureCacheSize()
+    {
+        return svgTextureCacheSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::clearSvgTextureCache()
+    {
+        svgTextureCache.clear();
+        svgTextureCacheIndex.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getCachedSvgTexturesCount()
+    {
+        return svgTextureCache.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,11 +49,25 @@ namespace tgui
 
             return timer;
         }
+
+        // The standard heap functions create a max-heap, so the comparison is reversed to have the earliest deadline in front.
+        // Timers with the same deadline are triggered in the order in which they were scheduled.
+        template <typename QueueEntry>
+        bool compareQueueEntries(const QueueEntry& left, const QueueEntry& right)
+        {
+            if (left.deadline != right.deadline)
+                return left.deadline > right.deadline;
+            else
+                return left.id > right.id;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    std::vector<Timer::QueueEntry> Timer::m_queue;
+    std::size_t Timer::m_outdatedQueueEntries = 0;
+    std::uint64_t Timer::m_nextQueueEntryId = 1;
+    Duration Timer::m_totalElapsedTime;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,17 +118,8 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
-        {
-            if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
-            {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
-            }
-        }
+        if (m_enabled && !enabled)
+            unschedule();
 
         m_enabled = enabled;
         if (enabled)
@@ -146,31 +151,45 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        if (m_enabled)
+            schedule();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Timer::updateTime(Duration elapsedTime)
     {
-        if (m_activeTimers.empty())
-            return false;
+        m_totalElapsedTime += elapsedTime;
+
+        // Timers that are scheduled from within a callback (including the timer that is being triggered) are only handled
+        // in the next update. Because the newly scheduled entries have the highest ids and can't have a deadline in the past,
+        // they can only be at the front of the queue once all expired timers have been triggered.
+        const std::uint64_t firstNewQueueEntryId = m_nextQueueEntryId;
 
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        while (true)
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
+            removeOutdatedEntries();
+            if (m_queue.empty())
+                break;
+
+            if ((m_queue.front().deadline > m_totalElapsedTime) || (m_queue.front().id >= firstNewQueueEntryId))
+                break;
+
+            // The timer is kept alive while its callback is executed, even if the callback stops the timer
+            std::pop_heap(m_queue.begin(), m_queue.end(), compareQueueEntries<QueueEntry>);
+            const std::shared_ptr<Timer> timer = std::move(m_queue.back().timer);
+            m_queue.pop_back();
+            timer->m_queueEntryId = 0;
+
+            // The next call is scheduled before executing the callback, so that the callback can still stop or restart the timer
+            if (timer->m_repeats)
+                timer->schedule();
             else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
-
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
-            }
+                timer->m_enabled = false;
+
+            timerTriggered = true;
+            timer->m_callback();
         }
 
         return timerTriggered;
@@ -180,26 +199,76 @@ namespace tgui
 
     Optional<Duration> Timer::getNextScheduledTime()
     {
+        removeOutdatedEntries();
+
         // If there are no active timers then return an empty object
-        if (m_activeTimers.empty())
+        if (m_queue.empty())
             return Optional<Duration>();
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        if (m_queue.front().deadline > m_totalElapsedTime)
+            return m_queue.front().deadline - m_totalElapsedTime;
+        else
+            return Duration();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& entry : m_queue)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            if (entry.timer->m_queueEntryId == entry.id)
+                entry.timer->m_queueEntryId = 0;
         }
 
-        return minDuration;
+        m_queue.clear();
+        m_outdatedQueueEntries = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::schedule()
+    {
+        unschedule();
+
+        m_queueEntryId = m_nextQueueEntryId++;
+        m_queue.push_back({m_totalElapsedTime + m_interval, m_queueEntryId, shared_from_this()});
+        std::push_heap(m_queue.begin(), m_queue.end(), compareQueueEntries<QueueEntry>);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::unschedule()
     {
-        m_activeTimers.clear();
+        if (m_queueEntryId == 0)
+            return;
+
+        m_queueEntryId = 0;
+        ++m_outdatedQueueEntries;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::removeOutdatedEntries()
+    {
+        const auto isOutdated = [](const QueueEntry& entry){ return entry.timer->m_queueEntryId != entry.id; };
+
+        // When most of the queue consists of stopped or restarted timers then the whole queue is rebuilt,
+        // otherwise the outdated entries are only removed once they reach the front of the queue.
+        if ((m_outdatedQueueEntries > 16) && (m_outdatedQueueEntries > m_queue.size() / 2))
+        {
+            m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(), isOutdated), m_queue.end());
+            std::make_heap(m_queue.begin(), m_queue.end(), compareQueueEntries<QueueEntry>);
+            m_outdatedQueueEntries = 0;
+            return;
+        }
+
+        while (!m_queue.empty() && isOutdated(m_queue.front()))
+        {
+            std::pop_heap(m_queue.begin(), m_queue.end(), compareQueueEntries<QueueEntry>);
+            m_queue.pop_back();
+            --m_outdatedQueueEntries;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
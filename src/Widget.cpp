@@ -137,7 +137,7 @@ namespace tgui
         if (initRenderer)
         {
             m_renderer = aurora::makeCopied<WidgetRenderer>();
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
         }
     }
 
@@ -150,12 +150,15 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         SignalManager::getSignalManager()->remove(this);
+
+        if (m_parentGui)
+            m_parentGui->unregisterTimeUpdates(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +196,7 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +245,7 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
 
         other.m_renderer = nullptr;
 
@@ -281,6 +284,9 @@ namespace tgui
             m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
+            if (m_parentGui)
+                m_parentGui->unregisterTimeUpdates(this);
+
             m_parent               = nullptr;
             m_parentGui            = nullptr;
             m_mouseHover           = false;
@@ -302,7 +308,7 @@ namespace tgui
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
         }
 
         return *this;
@@ -339,6 +345,9 @@ namespace tgui
             m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
             m_visible              = std::move(other.m_visible);
+            if (m_parentGui)
+                m_parentGui->unregisterTimeUpdates(this);
+
             m_parent               = nullptr;
             m_parentGui            = nullptr;
             m_mouseHover           = std::move(other.m_mouseHover);
@@ -360,7 +369,7 @@ namespace tgui
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
 
             other.m_renderer = nullptr;
 
@@ -383,24 +392,27 @@ namespace tgui
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
         rendererData->shared = true;
 
         // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        std::vector<String> properties;
+        const PropertyValueMap& oldPropertyValuePairs = oldData->propertyValuePairs;
+        const PropertyValueMap& newPropertyValuePairs = rendererData->propertyValuePairs;
+        auto oldIt = oldPropertyValuePairs.begin();
+        auto newIt = newPropertyValuePairs.begin();
+        while (oldIt != oldPropertyValuePairs.end() && newIt != newPropertyValuePairs.end())
         {
             if (oldIt->first < newIt->first)
             {
                 // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
+                properties.push_back(oldIt->first);
                 ++oldIt;
             }
             else
             {
                 // Update changed and new properties
-                rendererChanged(newIt->first);
+                properties.push_back(newIt->first);
 
                 if (newIt->first < oldIt->first)
                     ++newIt;
@@ -411,16 +423,19 @@ namespace tgui
                 }
             }
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        while (oldIt != oldPropertyValuePairs.end())
         {
-            rendererChanged(oldIt->first);
+            properties.push_back(oldIt->first);
             ++oldIt;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        while (newIt != newPropertyValuePairs.end())
         {
-            rendererChanged(newIt->first);
+            properties.push_back(newIt->first);
             ++newIt;
         }
+
+        if (!properties.empty())
+            rendererPropertiesChanged(properties);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,7 +461,7 @@ namespace tgui
         {
             m_renderer->unsubscribe(this);
             m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
             m_renderer->getData()->shared = false;
         }
 
@@ -462,7 +477,7 @@ namespace tgui
         {
             m_renderer->unsubscribe(this);
             m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, m_rendererChangedCallback, m_rendererPropertiesChangedCallback);
             m_renderer->getData()->shared = false;
         }
 
@@ -473,15 +488,23 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
-        m_position = position;
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
+        // When called from the callback of the layout itself, the layout is already connected and up-to-date.
+        // Connecting it again would needlessly parse the binding strings and recalculate the other axis too early.
+        if (&position != &m_position)
+        {
+            m_position = position;
+            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
+            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
+        }
 
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
             for (auto& layout : m_boundPositionLayouts)
                 layout->recalculateValue();
         }
@@ -491,15 +514,21 @@ namespace tgui
 
     void Widget::setSize(const Layout2d& size)
     {
-        m_size = size;
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        if (&size != &m_size)
+        {
+            m_size = size;
+            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
+            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        }
 
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
             for (auto& layout : m_boundSizeLayouts)
                 layout->recalculateValue();
 
@@ -523,6 +552,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect Widget::getHitBounds() const
+    {
+        return {getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Widget::getAbsolutePosition() const
     {
         Vector2f pos = getPosition();
@@ -560,6 +596,9 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,6 +607,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,6 +618,9 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -594,6 +639,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -602,6 +650,9 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -727,6 +778,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestUpdateTime();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -847,6 +900,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestUpdateTime();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -859,6 +914,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Move); }
         ));
+
+        requestUpdateTime();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -871,6 +928,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Resize); }
         ));
+
+        requestUpdateTime();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1029,9 +1088,12 @@ namespace tgui
     {
         if (m_name != name)
         {
+            const String oldName = m_name;
             m_name = name;
             if (m_parent)
             {
+                m_parent->childWidgetRenamed(this, oldName);
+
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
             }
@@ -1118,7 +1180,11 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        BackendGui* const oldParentGui = m_parentGui;
         m_parentGui = parent ? parent->getParentGui() : nullptr;
+        if (m_parentGui != oldParentGui)
+            parentGuiChanged(oldParentGui);
+
         if (m_parent == parent)
             return;
 
@@ -1132,8 +1198,14 @@ namespace tgui
         else if (!m_parent)
             SignalManager::getSignalManager()->add(shared_from_this());
 
+        if (m_parent)
+            m_parent->childWidgetDetached(this);
+
         m_parent = parent;
 
+        if (m_parent)
+            m_parent->childWidgetAttached(this);
+
         // Give the layouts another chance to find widgets to which it refers
         if (parent)
         {
@@ -1164,6 +1236,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isUpdateTimeRequired() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Widget::getTimeUntilNextUpdate() const
+    {
+        if (!m_showAnimations.empty())
+            return Duration{};
+
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
         m_mouseDown = true;
@@ -1322,37 +1411,87 @@ namespace tgui
 
     void Widget::rendererChanged(const String& property)
     {
-        if ((property == "Opacity") || (property == "OpacityDisabled"))
+        switch (getPropertyId(property))
         {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
-            else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == "Font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = Font::getGlobalFont();
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
+                    m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+                else
+                    m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = Font::getGlobalFont();
+                break;
+            }
+
+            case getPropertyId("TextSize"):
+            {
+                if (getSharedRenderer()->getTextSize())
+                    m_textSizeCached = getSharedRenderer()->getTextSize();
+                else
+                    m_textSizeCached = m_textSize;
+
+                updateTextSize();
+                break;
+            }
+
+            case getPropertyId("TransparentTexture"):
+            {
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                break;
+            }
+
+            default:
+                throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
         }
-        else if (property == "TextSize")
-        {
-            if (getSharedRenderer()->getTextSize())
-                m_textSizeCached = getSharedRenderer()->getTextSize();
-            else
-                m_textSizeCached = m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            updateTextSize();
+    void Widget::rendererPropertiesChanged(const std::vector<String>& properties)
+    {
+        const auto finishPostponedSizeUpdate = [this]{
+            m_sizeUpdatesPostponed = false;
+            if (m_sizeUpdatePending)
+            {
+                m_sizeUpdatePending = false;
+                setSize(m_size);
+            }
+        };
+
+        m_sizeUpdatesPostponed = true;
+        try
+        {
+            for (const auto& property : properties)
+                rendererChanged(property);
         }
-        else if (property == "TransparentTexture")
+        catch (const Exception&)
         {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            finishPostponedSizeUpdate();
+            throw;
         }
+
+        finishPostponedSizeUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateSizeAfterRendererChange()
+    {
+        if (m_sizeUpdatesPostponed)
+            m_sizeUpdatePending = true;
         else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
+            setSize(m_size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1477,43 +1616,43 @@ namespace tgui
     void Widget::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
     {
         if (node->propertyValuePairs["Visible"])
-            setVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["Visible"]->value).getBool());
+            setVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["Visible"]).getBool());
         if (node->propertyValuePairs["Enabled"])
-            setEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["Enabled"]->value).getBool());
+            setEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["Enabled"]).getBool());
         if (node->propertyValuePairs["Position"])
-            setPosition(parseLayout(node->propertyValuePairs["Position"]->value));
+            setPosition(parseLayout(node->propertyValuePairs["Position"]->getValue()));
         if (node->propertyValuePairs["Size"])
-            setSize(parseLayout(node->propertyValuePairs["Size"]->value));
+            setSize(parseLayout(node->propertyValuePairs["Size"]->getValue()));
         if (node->propertyValuePairs["Origin"])
-            setOrigin(parseVector2f(node->propertyValuePairs["Origin"]->value));
+            setOrigin(parseVector2f(node->propertyValuePairs["Origin"]->getValue()));
         if (node->propertyValuePairs["Scale"])
         {
             if (node->propertyValuePairs["ScaleOrigin"])
-                setScale(parseVector2f(node->propertyValuePairs["Scale"]->value), parseVector2f(node->propertyValuePairs["ScaleOrigin"]->value));
+                setScale(parseVector2f(node->propertyValuePairs["Scale"]->getValue()), parseVector2f(node->propertyValuePairs["ScaleOrigin"]->getValue()));
             else
-                setScale(parseVector2f(node->propertyValuePairs["Scale"]->value));
+                setScale(parseVector2f(node->propertyValuePairs["Scale"]->getValue()));
         }
         if (node->propertyValuePairs["Rotation"])
         {
             if (node->propertyValuePairs["RotationOrigin"])
-                setRotation(node->propertyValuePairs["Rotation"]->value.toFloat(), parseVector2f(node->propertyValuePairs["RotationOrigin"]->value));
+                setRotation(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Rotation"]).getNumber(), parseVector2f(node->propertyValuePairs["RotationOrigin"]->getValue()));
             else
-                setRotation(node->propertyValuePairs["Rotation"]->value.toFloat());
+                setRotation(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Rotation"]).getNumber());
         }
         if (node->propertyValuePairs["UserData"])
         {
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-            m_userData = std::make_any<String>(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["UserData"]->value).getString());
+            m_userData = std::make_any<String>(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["UserData"]).getString());
 #else
-            m_userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["UserData"]->value).getString());
+            m_userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["UserData"]).getString());
 #endif
         }
         if (node->propertyValuePairs["TextSize"])
-            setTextSize(node->propertyValuePairs["TextSize"]->value.toInt());
+            setTextSize(node->propertyValuePairs["TextSize"]->getValue().toInt());
 
         if (node->propertyValuePairs["MouseCursor"])
         {
-            String cursorStr = node->propertyValuePairs["MouseCursor"]->value.trim();
+            String cursorStr = node->propertyValuePairs["MouseCursor"]->getValue().trim();
             if (cursorStr == "Text")
                 m_mouseCursor = Cursor::Type::Text;
             else if (cursorStr == "Hand")
@@ -1552,7 +1691,7 @@ namespace tgui
 
         if (node->propertyValuePairs["Renderer"])
         {
-            const String value = node->propertyValuePairs["Renderer"]->value;
+            const String value = node->propertyValuePairs["Renderer"]->getValue();
             if (value.empty() || (value[0] != '&'))
                 throw Exception{"Expected reference to renderer, did not find '&' character"};
 
@@ -1570,9 +1709,9 @@ namespace tgui
                 for (const auto& pair : childNode->propertyValuePairs)
                 {
                     if (pair.first == "InitialDelay")
-                        ToolTip::setInitialDelay(std::chrono::duration<float>(pair.second->value.toFloat()));
+                        ToolTip::setInitialDelay(std::chrono::duration<float>(Deserializer::deserialize(ObjectConverter::Type::Number, *pair.second).getNumber()));
                     else if (pair.first == "DistanceToMouse")
-                        ToolTip::setDistanceToMouse(Vector2f{pair.second->value});
+                        ToolTip::setDistanceToMouse(Vector2f{pair.second->getValue()});
                 }
 
                 if (!childNode->children.empty())
@@ -1633,9 +1772,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::requestUpdateTime()
+    {
+        if (m_parentGui)
+            m_parentGui->registerTimeUpdates(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration Widget::getTimeUntilTimerExpires(Duration timerDuration) const
+    {
+        if (!m_showAnimations.empty() || (m_animationTimeElapsed >= timerDuration))
+            return Duration{};
+
+        return timerDuration - m_animationTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::parentGuiChanged(BackendGui* oldParentGui)
+    {
+        if (oldParentGui)
+            oldParentGui->unregisterTimeUpdates(this);
+
+        // If the widget requested time updates before it was part of the gui then the new gui has to take over
+        if (m_parentGui && isUpdateTimeRequired())
+            m_parentGui->registerTimeUpdates(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const String& property)
     {
+        const FloatRect oldHitBounds = m_parent ? getHitBounds() : FloatRect{};
+
         rendererChanged(property);
+
+        // A container with a spatial index has to know when a renderer property changes the area where the widget can be clicked
+        if (m_parent && (getHitBounds() != oldHitBounds))
+            m_parent->childWidgetBoundsChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererPropertiesChangedCallback(const std::vector<String>& properties)
+    {
+        const FloatRect oldHitBounds = m_parent ? getHitBounds() : FloatRect{};
+
+        rendererPropertiesChanged(properties);
+
+        if (m_parent && (getHitBounds() != oldHitBounds))
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -185,13 +185,20 @@ namespace tgui
 
     void BitmapButton::rendererChanged(const String& property)
     {
-        if ((property == "Opacity") || (property == "OpacityDisabled"))
+        switch (getPropertyId(property))
         {
-            Button::rendererChanged(property);
-            m_imageComponent->setOpacity(m_opacityCached);
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Button::rendererChanged(property);
+                m_imageComponent->setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Button::rendererChanged(property);
+                break;
         }
-        else
-            Button::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,9 +218,9 @@ namespace tgui
         Button::load(node, renderers);
 
         if (node->propertyValuePairs["Image"])
-            setImage(Deserializer::deserialize(ObjectConverter::Type::Texture, node->propertyValuePairs["Image"]->value).getTexture());
+            setImage(Deserializer::deserialize(ObjectConverter::Type::Texture, *node->propertyValuePairs["Image"]).getTexture());
         if (node->propertyValuePairs["ImageScaling"])
-            setImageScaling(Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["ImageScaling"]->value).getNumber());
+            setImageScaling(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["ImageScaling"]).getNumber());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,21 +140,37 @@ namespace tgui
 
     void BoxLayout::rendererChanged(const String& property)
     {
-        if (property == "SpaceBetweenWidgets")
+        switch (getPropertyId(property))
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case getPropertyId("SpaceBetweenWidgets"):
+            {
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+
+            case getPropertyId("Padding"):
+            {
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else if (property == "Padding")
-        {
-            Group::rendererChanged(property);
+    }
 
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else
-            Group::rendererChanged(property);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BoxLayout::canLoadWidgetsLazily() const
+    {
+        // The layout needs all child widgets to position them
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
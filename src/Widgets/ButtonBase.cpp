@@ -297,118 +297,215 @@ namespace tgui
 
     void ButtonBase::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            background.borders = getSharedRenderer()->getBorders();
-            updateSize();
+            case getPropertyId("Borders"):
+            {
+                background.borders = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
+            }
+
+            case getPropertyId("RoundedBorderRadius"):
+            {
+                background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+            }
+
+            case getPropertyId("TextColor"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case getPropertyId("TextColorDown"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case getPropertyId("TextColorHover"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case getPropertyId("TextColorDownHover"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case getPropertyId("TextColorDisabled"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("TextColorDownDisabled"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case getPropertyId("TextColorFocused"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case getPropertyId("TextColorDownFocused"):
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case getPropertyId("TextStyle"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
+                break;
+
+            case getPropertyId("TextStyleDown"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case getPropertyId("TextStyleHover"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case getPropertyId("TextStyleDownHover"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case getPropertyId("TextStyleDisabled"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("TextStyleDownDisabled"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case getPropertyId("TextStyleFocused"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case getPropertyId("TextStyleDownFocused"):
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case getPropertyId("Texture"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
+                break;
+
+            case getPropertyId("TextureDown"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case getPropertyId("TextureHover"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case getPropertyId("TextureDownHover"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case getPropertyId("TextureDisabled"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("TextureDownDisabled"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("TextureFocused"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case getPropertyId("TextureDownFocused"):
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case getPropertyId("BorderColor"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case getPropertyId("BorderColorDown"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case getPropertyId("BorderColorHover"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case getPropertyId("BorderColorDownHover"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case getPropertyId("BorderColorDisabled"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("BorderColorDownDisabled"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case getPropertyId("BorderColorFocused"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case getPropertyId("BorderColorDownFocused"):
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case getPropertyId("BackgroundColor"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case getPropertyId("BackgroundColorDown"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case getPropertyId("BackgroundColorHover"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case getPropertyId("BackgroundColorDownHover"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case getPropertyId("BackgroundColorDisabled"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case getPropertyId("BackgroundColorDownDisabled"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case getPropertyId("BackgroundColorFocused"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case getPropertyId("BackgroundColorDownFocused"):
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case getPropertyId("TextOutlineThickness"):
+            {
+                m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
+                break;
+            }
+
+            case getPropertyId("TextOutlineColor"):
+            {
+                m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                ClickableWidget::rendererChanged(property);
+                m_textComponent->setOpacity(m_opacityCached);
+                m_backgroundComponent->setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                ClickableWidget::rendererChanged(property);
+
+                m_textComponent->setFont(m_fontCached);
+                updateTextSize();
+                break;
+            }
+
+            default:
+                ClickableWidget::rendererChanged(property);
+                break;
         }
-        else if (property == "RoundedBorderRadius")
-        {
-            background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == "TextColor")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == "TextColorDown")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == "TextColorHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == "TextColorDownHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == "TextColorDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "TextColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == "TextColorFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == "TextColorDownFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == "TextStyle")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == "TextStyleDown")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == "TextStyleHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == "TextStyleDownHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == "TextStyleDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "TextStyleDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == "TextStyleFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == "TextStyleDownFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == "Texture")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == "TextureDown")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == "TextureHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == "TextureDownHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == "TextureDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "TextureDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "TextureFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == "TextureDownFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == "BorderColor")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == "BorderColorDown")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == "BorderColorHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == "BorderColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == "BorderColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "BorderColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == "BorderColorFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == "BorderColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == "BackgroundColor")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == "BackgroundColorDown")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == "BackgroundColorHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == "BackgroundColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == "BackgroundColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == "BackgroundColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == "BackgroundColorFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == "BackgroundColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == "TextOutlineThickness")
-        {
-            m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-        }
-        else if (property == "TextOutlineColor")
-        {
-            m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-            m_textComponent->setOpacity(m_opacityCached);
-            m_backgroundComponent->setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textComponent->setFont(m_fontCached);
-            updateTextSize();
-        }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -434,7 +531,7 @@ namespace tgui
         ClickableWidget::load(node, renderers);
 
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
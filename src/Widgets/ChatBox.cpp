@@ -458,66 +458,90 @@ namespace tgui
 
     void ChatBox::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("Padding"):
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
             }
-        }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll->setInheritedOpacity(m_opacityCached);
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Scrollbar"):
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    updateSizeAfterRendererChange();
+                }
+                break;
+            }
+
+            case getPropertyId("ScrollbarWidth"):
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
 
-            recalculateAllLines();
+                // Changing the size recalculates all lines
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,11 +596,11 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["TextColor"])
-            setTextColor(Deserializer::deserialize(ObjectConverter::Type::Color, node->propertyValuePairs["TextColor"]->value).getColor());
+            setTextColor(Deserializer::deserialize(ObjectConverter::Type::Color, *node->propertyValuePairs["TextColor"]).getColor());
         if (node->propertyValuePairs["TextStyle"])
-            setTextStyle(Deserializer::deserialize(ObjectConverter::Type::TextStyle, node->propertyValuePairs["TextStyle"]->value).getTextStyle());
+            setTextStyle(Deserializer::deserialize(ObjectConverter::Type::TextStyle, *node->propertyValuePairs["TextStyle"]).getTextStyle());
         if (node->propertyValuePairs["LineLimit"])
-            setLineLimit(node->propertyValuePairs["LineLimit"]->value.toInt());
+            setLineLimit(node->propertyValuePairs["LineLimit"]->getValue().toInt());
 
         for (const auto& childNode : node->children)
         {
@@ -584,25 +608,25 @@ namespace tgui
             {
                 Color lineTextColor = getTextColor();
                 if (childNode->propertyValuePairs["Color"])
-                    lineTextColor = Deserializer::deserialize(ObjectConverter::Type::Color, childNode->propertyValuePairs["Color"]->value).getColor();
+                    lineTextColor = Deserializer::deserialize(ObjectConverter::Type::Color, *childNode->propertyValuePairs["Color"]).getColor();
 
                 TextStyles lineTextStyle = getTextStyle();
                 if (childNode->propertyValuePairs["Style"])
-                    lineTextStyle = Deserializer::deserialize(ObjectConverter::Type::TextStyle, childNode->propertyValuePairs["Style"]->value).getTextStyle();
+                    lineTextStyle = Deserializer::deserialize(ObjectConverter::Type::TextStyle, *childNode->propertyValuePairs["Style"]).getTextStyle();
 
                 if (childNode->propertyValuePairs["Text"])
-                    addLine(Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Text"]->value).getString(), lineTextColor, lineTextStyle);
+                    addLine(Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Text"]).getString(), lineTextColor, lineTextStyle);
             }
         }
         node->children.erase(std::remove_if(node->children.begin(), node->children.end(),
                                         [](const std::unique_ptr<DataIO::Node>& child){ return child->name == "Line"; }), node->children.end());
 
         if (node->propertyValuePairs["LinesStartFromTop"])
-            setLinesStartFromTop(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["LinesStartFromTop"]->value).getBool());
+            setLinesStartFromTop(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["LinesStartFromTop"]).getBool());
 
         // This has to be parsed after the lines have been added
         if (node->propertyValuePairs["NewLinesBelowOthers"])
-            setNewLinesBelowOthers(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["NewLinesBelowOthers"]->value).getBool());
+            setNewLinesBelowOthers(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["NewLinesBelowOthers"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
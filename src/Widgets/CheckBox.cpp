@@ -188,10 +188,16 @@ namespace tgui
 
     void CheckBox::rendererChanged(const String& property)
     {
-        if (property == "TextureUnchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "TextureChecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (getPropertyId(property))
+        {
+            case getPropertyId("TextureUnchecked"):
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+
+            case getPropertyId("TextureChecked"):
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+        }
 
         RadioButton::rendererChanged(property);
     }
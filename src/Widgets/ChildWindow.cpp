@@ -59,8 +59,6 @@ namespace tgui
 
         setTitleTextSize(getGlobalTextSize());
         m_titleBarHeightCached = m_titleText.getSize().y * 1.25f;
-        if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-            m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
 
         if (initRenderer)
         {
@@ -83,6 +81,8 @@ namespace tgui
         m_draggingPosition                 {other.m_draggingPosition},
         m_maximumSize                      {other.m_maximumSize},
         m_minimumSize                      {other.m_minimumSize},
+        m_clientSizeLayout                 {other.m_clientSizeLayout},
+        m_sizeSetFromClientSize            {other.m_sizeSetFromClientSize},
         m_titleAlignment                   {other.m_titleAlignment},
         m_titleButtons                     {other.m_titleButtons},
         m_titleTextSize                    {other.m_titleTextSize},
@@ -123,6 +123,8 @@ namespace tgui
         m_draggingPosition                 {std::move(other.m_draggingPosition)},
         m_maximumSize                      {std::move(other.m_maximumSize)},
         m_minimumSize                      {std::move(other.m_minimumSize)},
+        m_clientSizeLayout                 {std::move(other.m_clientSizeLayout)},
+        m_sizeSetFromClientSize            {std::move(other.m_sizeSetFromClientSize)},
         m_titleAlignment                   {std::move(other.m_titleAlignment)},
         m_titleButtons                     {std::move(other.m_titleButtons)},
         m_titleTextSize                    {std::move(other.m_titleTextSize)},
@@ -168,6 +170,8 @@ namespace tgui
             m_draggingPosition                  = other.m_draggingPosition;
             m_maximumSize                       = other.m_maximumSize;
             m_minimumSize                       = other.m_minimumSize;
+            m_clientSizeLayout                  = other.m_clientSizeLayout;
+            m_sizeSetFromClientSize             = other.m_sizeSetFromClientSize;
             m_titleAlignment                    = other.m_titleAlignment;
             m_titleButtons                      = other.m_titleButtons;
             m_titleTextSize                     = other.m_titleTextSize;
@@ -216,6 +220,8 @@ namespace tgui
             m_draggingPosition                  = std::move(other.m_draggingPosition);
             m_maximumSize                       = std::move(other.m_maximumSize);
             m_minimumSize                       = std::move(other.m_minimumSize);
+            m_clientSizeLayout                  = std::move(other.m_clientSizeLayout);
+            m_sizeSetFromClientSize             = std::move(other.m_sizeSetFromClientSize);
             m_titleAlignment                    = std::move(other.m_titleAlignment);
             m_titleButtons                      = std::move(other.m_titleButtons);
             m_titleTextSize                     = std::move(other.m_titleTextSize);
@@ -367,6 +373,10 @@ namespace tgui
 
     void ChildWindow::setSize(const Layout2d& size)
     {
+        // The size no longer depends on the client size when a different layout is set
+        if (&size != &m_size)
+            m_sizeSetFromClientSize = false;
+
         Container::setSize(size);
 
         m_bordersCached.updateParentSize(getSize());
@@ -390,17 +400,14 @@ namespace tgui
 
     void ChildWindow::setClientSize(const Layout2d& size)
     {
-        m_decorationLayoutX = nullptr;
-        m_decorationLayoutY = nullptr;
-
         const Vector2f decorationSize = {m_bordersCached.getLeft() + m_bordersCached.getRight(),
                                          m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached};
 
         setSize(size + decorationSize);
 
-        // Keep a pointer to the layout containing the decoration size. If the decoration changes then we need to update this layout
-        m_decorationLayoutX = m_size.x.getRightOperand();
-        m_decorationLayoutY = m_size.y.getRightOperand();
+        // Keep the client size layout. If the decoration changes then the size has to be recreated from it.
+        m_clientSizeLayout = size;
+        m_sizeSetFromClientSize = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -587,6 +594,10 @@ namespace tgui
     void ChildWindow::setResizable(bool resizable)
     {
         m_resizable = resizable;
+
+        // The resize border can be clicked outside the window
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -647,7 +658,27 @@ namespace tgui
 
     bool ChildWindow::isMouseOnWidget(Vector2f pos) const
     {
-        FloatRect region{getPosition(), getSize()};
+        FloatRect region = getHitBounds();
+        region.left += getPosition().x;
+        region.top += getPosition().y;
+
+        if (region.contains(pos))
+        {
+            // If the mouse enters the border or title bar then then none of the widgets can still be under the mouse
+            if (m_widgetBelowMouse && !FloatRect{getPosition() + getChildWidgetsOffset(), getClientSize()}.contains(pos))
+                m_widgetBelowMouse->mouseNoLongerOnWidget();
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect ChildWindow::getHitBounds() const
+    {
+        FloatRect region{{0, 0}, getSize()};
 
         // Expand the region if the child window is resizable (to make the borders easier to click on)
         if (m_resizable)
@@ -660,16 +691,7 @@ namespace tgui
                              + std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getBottom());
         }
 
-        if (region.contains(pos))
-        {
-            // If the mouse enters the border or title bar then then none of the widgets can still be under the mouse
-            if (m_widgetBelowMouse && !FloatRect{getPosition() + getChildWidgetsOffset(), getClientSize()}.contains(pos))
-                m_widgetBelowMouse->mouseNoLongerOnWidget();
-
-            return true;
-        }
-
-        return false;
+        return region;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1044,157 +1066,197 @@ namespace tgui
 
     void ChildWindow::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
 
-            if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
-                m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                if (m_sizeSetFromClientSize)
+                    setClientSize(m_clientSizeLayout);
+                else
+                    updateSizeAfterRendererChange();
+                break;
+            }
 
-            setSize(m_size);
-        }
-        else if (property == "TitleColor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if ((property == "TextureTitleBar") || (property == "TitleBarHeight"))
-        {
-            const float oldTitleBarHeight = m_titleBarHeightCached;
+            case getPropertyId("TitleColor"):
+            {
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
+            }
 
-            if (property == "TextureTitleBar")
+            case getPropertyId("TextureTitleBar"):
+            case getPropertyId("TitleBarHeight"):
             {
-                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+                const float oldTitleBarHeight = m_titleBarHeightCached;
 
-                // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
-                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-                if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                if (property == "TextureTitleBar")
+                {
+                    m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+
+                    // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
+                    m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                    if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                        updateTitleBarHeight();
+                }
+                else // if (property == "TitleBarHeight")
+                {
+                    m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
                     updateTitleBarHeight();
+                }
+
+                if (oldTitleBarHeight != m_titleBarHeightCached)
+                {
+                    if (m_sizeSetFromClientSize)
+                        setClientSize(m_clientSizeLayout);
+
+                    // If the title bar changes in height then the inner size will also change
+                    for (auto& layout : m_boundSizeLayouts)
+                        layout->recalculateValue();
+                }
+                break;
             }
-            else // if (property == "TitleBarHeight")
+
+            case getPropertyId("TextureBackground"):
             {
-                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-                updateTitleBarHeight();
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
             }
 
-            if (oldTitleBarHeight != m_titleBarHeightCached)
+            case getPropertyId("BorderBelowTitleBar"):
             {
-                if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                    m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
+                if (m_sizeSetFromClientSize)
+                    setClientSize(m_clientSizeLayout);
+                break;
+            }
 
-                // If the title bar changes in height then the inner size will also change
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+            case getPropertyId("DistanceToSide"):
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
             }
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "BorderBelowTitleBar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-        }
-        else if (property == "DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == "PaddingBetweenButtons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == "MinimumResizableBorderWidth")
-        {
-            m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == "ShowTextOnTitleButtons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == "CloseButton")
-        {
-            if (m_closeButton->isVisible())
+
+            case getPropertyId("PaddingBetweenButtons"):
             {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "MaximizeButton")
-        {
-            if (m_maximizeButton->isVisible())
+            case getPropertyId("MinimumResizableBorderWidth"):
             {
-                m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "MinimizeButton")
-        {
-            if (m_minimizeButton->isVisible())
+            case getPropertyId("ShowTextOnTitleButtons"):
             {
-                m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "TitleBarColor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Container::rendererChanged(property);
+            case getPropertyId("CloseButton"):
+            {
+                if (m_closeButton->isVisible())
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                updateTitleBarHeight();
+                break;
+            }
+
+            case getPropertyId("MaximizeButton"):
             {
-                if (button->isVisible())
-                    button->setInheritedOpacity(m_opacityCached);
+                if (m_maximizeButton->isVisible())
+                {
+                    m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                break;
             }
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Container::rendererChanged(property);
+            case getPropertyId("MinimizeButton"):
+            {
+                if (m_minimizeButton->isVisible())
+                {
+                    m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                updateTitleBarHeight();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
             {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
             }
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+            case getPropertyId("TitleBarColor"):
+            {
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+            }
 
-            setPosition(m_position);
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BorderColorFocused"):
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedOpacity(m_opacityCached);
+                }
+
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
+
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                break;
+            }
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1255,11 +1317,11 @@ namespace tgui
 
         if (node->propertyValuePairs["TitleAlignment"])
         {
-            if (node->propertyValuePairs["TitleAlignment"]->value == "Left")
+            if (node->propertyValuePairs["TitleAlignment"]->getValue() == "Left")
                 setTitleAlignment(TitleAlignment::Left);
-            else if (node->propertyValuePairs["TitleAlignment"]->value == "Center")
+            else if (node->propertyValuePairs["TitleAlignment"]->getValue() == "Center")
                 setTitleAlignment(TitleAlignment::Center);
-            else if (node->propertyValuePairs["TitleAlignment"]->value == "Right")
+            else if (node->propertyValuePairs["TitleAlignment"]->getValue() == "Right")
                 setTitleAlignment(TitleAlignment::Right);
             else
                 throw Exception{"Failed to parse TitleAlignment property. Only the values Left, Center and Right are correct."};
@@ -1268,7 +1330,7 @@ namespace tgui
         if (node->propertyValuePairs["TitleButtons"])
         {
             int decodedTitleButtons = TitleButton::None;
-            std::vector<String> titleButtons = Deserializer::split(node->propertyValuePairs["TitleButtons"]->value, '|');
+            std::vector<String> titleButtons = Deserializer::split(node->propertyValuePairs["TitleButtons"]->getValue(), '|');
             for (const auto& elem : titleButtons)
             {
                 String requestedTitleButton = elem.trim();
@@ -1284,24 +1346,24 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["Title"])
-            setTitle(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Title"]->value).getString());
+            setTitle(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Title"]).getString());
 
         if (node->propertyValuePairs["TitleTextSize"])
-            setTitleTextSize(static_cast<unsigned int>(Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["TitleTextSize"]->value).getNumber()));
+            setTitleTextSize(static_cast<unsigned int>(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["TitleTextSize"]).getNumber()));
 
         if (node->propertyValuePairs["KeepInParent"])
-            setKeepInParent(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["KeepInParent"]->value).getBool());
+            setKeepInParent(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["KeepInParent"]).getBool());
 
         if (node->propertyValuePairs["Resizable"])
-            setResizable(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["Resizable"]->value).getBool());
+            setResizable(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["Resizable"]).getBool());
         if (node->propertyValuePairs["PositionLocked"])
-            setPositionLocked(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["PositionLocked"]->value).getBool());
+            setPositionLocked(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["PositionLocked"]).getBool());
 
         if (node->propertyValuePairs["MinimumSize"])
-            setMinimumSize(Vector2f{node->propertyValuePairs["MinimumSize"]->value});
+            setMinimumSize(Vector2f{node->propertyValuePairs["MinimumSize"]->getValue()});
 
         if (node->propertyValuePairs["MaximumSize"])
-            setMaximumSize(Vector2f{node->propertyValuePairs["MaximumSize"]->value});
+            setMaximumSize(Vector2f{node->propertyValuePairs["MaximumSize"]->getValue()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1429,6 +1491,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChildWindow::canLoadWidgetsLazily() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -525,46 +525,59 @@ namespace tgui
 
     void ColorPicker::rendererChanged(const String& property)
     {
-        if (property == "Button")
+        switch (getPropertyId(property))
         {
-            const auto &renderer = getSharedRenderer()->getButton();
+            case getPropertyId("Button"):
+            {
+                const auto &renderer = getSharedRenderer()->getButton();
 
-            get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
-            get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
-            get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
-        }
-        else if (property == "Label")
-        {
-            const auto &renderer = getSharedRenderer()->getLabel();
+                get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
+                get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
+                get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                break;
+            }
 
-            for (const auto &it : getWidgets())
+            case getPropertyId("Label"):
             {
-                auto label = std::dynamic_pointer_cast<Label>(it);
-                if (label)
+                const auto &renderer = getSharedRenderer()->getLabel();
+
+                for (const auto &it : getWidgets())
                 {
-                    label->setRenderer(renderer);
+                    auto label = std::dynamic_pointer_cast<Label>(it);
+                    if (label)
+                    {
+                        label->setRenderer(renderer);
+                    }
                 }
+                break;
             }
-        }
-        else if (property == "Slider")
-        {
-            const auto &renderer = getSharedRenderer()->getSlider();
 
-            m_red->setRenderer(renderer);
-            m_green->setRenderer(renderer);
-            m_blue->setRenderer(renderer);
-            m_alpha->setRenderer(renderer);
+            case getPropertyId("Slider"):
+            {
+                const auto &renderer = getSharedRenderer()->getSlider();
 
-            m_value->setRenderer(renderer);
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            m_colorWheelSprite.setOpacity(m_opacityCached);
-            ChildWindow::rendererChanged(property);
+                m_red->setRenderer(renderer);
+                m_green->setRenderer(renderer);
+                m_blue->setRenderer(renderer);
+                m_alpha->setRenderer(renderer);
+
+                m_value->setRenderer(renderer);
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+                m_colorWheelSprite.setOpacity(m_opacityCached);
+                ChildWindow::rendererChanged(property);
+                break;
+            }
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -712,6 +725,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ColorPicker::canLoadWidgetsLazily() const
+    {
+        // The internal widgets are looked up in the child widgets while loading
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -637,136 +637,189 @@ namespace tgui
 
     void ComboBox::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            if (m_enabled || !m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorCached);
-            if (!getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            if (!m_enabled && m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorDisabledCached);
-        }
-        else if (property == "TextStyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-            if (!getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "DefaultTextColor")
-        {
-            if (getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-            else
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "DefaultTextStyle")
-        {
-            if (getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-            else
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "TextureBackgroundDisabled")
-        {
-            m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
-        }
-        else if (property == "TextureArrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == "TextureArrowHover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == "TextureArrowDisabled")
-        {
-            m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
-        }
-        else if (property == "ListBox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "ArrowBackgroundColorDisabled")
-        {
-            m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
-        }
-        else if (property == "ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "ArrowColorDisabled")
-        {
-            m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
-            m_spriteArrowDisabled.setOpacity(m_opacityCached);
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                if (m_enabled || !m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorCached);
+                if (!getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
 
-            m_text.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
+            case getPropertyId("TextColorDisabled"):
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                if (!m_enabled && m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorDisabledCached);
+                break;
+            }
 
-            setSize(m_size);
+            case getPropertyId("TextStyle"):
+            {
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                if (!getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+
+            case getPropertyId("DefaultTextColor"):
+            {
+                if (getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                else
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+
+            case getPropertyId("DefaultTextStyle"):
+            {
+                if (getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                else
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("TextureBackgroundDisabled"):
+            {
+                m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
+                break;
+            }
+
+            case getPropertyId("TextureArrow"):
+            {
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureArrowHover"):
+            {
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+            }
+
+            case getPropertyId("TextureArrowDisabled"):
+            {
+                m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
+                break;
+            }
+
+            case getPropertyId("ListBox"):
+            {
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorDisabled"):
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case getPropertyId("ArrowBackgroundColor"):
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("ArrowBackgroundColorHover"):
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("ArrowBackgroundColorDisabled"):
+            {
+                m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
+                break;
+            }
+
+            case getPropertyId("ArrowColor"):
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+
+            case getPropertyId("ArrowColorHover"):
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+
+            case getPropertyId("ArrowColorDisabled"):
+            {
+                m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+                m_spriteArrowDisabled.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
+
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -852,21 +905,21 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["ItemsToDisplay"])
-            setItemsToDisplay(node->propertyValuePairs["ItemsToDisplay"]->value.toInt());
+            setItemsToDisplay(node->propertyValuePairs["ItemsToDisplay"]->getValue().toInt());
         if (node->propertyValuePairs["MaximumItems"])
-            setMaximumItems(node->propertyValuePairs["MaximumItems"]->value.toInt());
+            setMaximumItems(node->propertyValuePairs["MaximumItems"]->getValue().toInt());
         if (node->propertyValuePairs["SelectedItemIndex"])
-            setSelectedItemByIndex(node->propertyValuePairs["SelectedItemIndex"]->value.toInt());
+            setSelectedItemByIndex(node->propertyValuePairs["SelectedItemIndex"]->getValue().toInt());
         if (node->propertyValuePairs["ChangeItemOnScroll"])
-            m_changeItemOnScroll = Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ChangeItemOnScroll"]->value).getBool();
+            m_changeItemOnScroll = Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ChangeItemOnScroll"]).getBool();
 
         if (node->propertyValuePairs["ExpandDirection"])
         {
-            if (node->propertyValuePairs["ExpandDirection"]->value == "Up")
+            if (node->propertyValuePairs["ExpandDirection"]->getValue() == "Up")
                 setExpandDirection(ComboBox::ExpandDirection::Up);
-            else if (node->propertyValuePairs["ExpandDirection"]->value == "Down")
+            else if (node->propertyValuePairs["ExpandDirection"]->getValue() == "Down")
                 setExpandDirection(ComboBox::ExpandDirection::Down);
-            else if (node->propertyValuePairs["ExpandDirection"]->value == "Automatic")
+            else if (node->propertyValuePairs["ExpandDirection"]->getValue() == "Automatic")
                 setExpandDirection(ComboBox::ExpandDirection::Automatic);
             else
                 throw Exception{"Failed to parse ExpandDirection property. Only the values Up, Down and Automatic are correct."};
@@ -394,6 +394,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            requestUpdateTime();
         }
         else // Unfocusing
         {
@@ -471,6 +472,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            requestUpdateTime();
         }
 
         onMousePress.emit(this, pos);
@@ -694,142 +696,201 @@ namespace tgui
 
     void EditBox::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            updateTextSize();
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == "CaretWidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == "TextColor") || (property == "TextColorDisabled") || (property == "TextColorFocused"))
-        {
-            updateTextColor();
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "Texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "TextureHover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "TextureDisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "TextureFocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == "TextStyle")
-        {
-            const TextStyles style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textSuffix.setStyle(style);
-            m_textFull.setStyle(style);
-        }
-        else if (property == "DefaultTextStyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "BackgroundColorFocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == "CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "CaretColorHover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == "CaretColorFocused")
-        {
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
-        }
-        else if (property == "SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-            m_textSuffix.setOpacity(m_opacityCached);
-
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textSuffix.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            updateTextSize();
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                updateTextSize();
+
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+            }
+
+            case getPropertyId("CaretWidth"):
+            {
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+            }
+
+            case getPropertyId("TextColor"):
+            case getPropertyId("TextColorDisabled"):
+            case getPropertyId("TextColorFocused"):
+            {
+                updateTextColor();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
+
+            case getPropertyId("DefaultTextColor"):
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+            }
+
+            case getPropertyId("Texture"):
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+            }
+
+            case getPropertyId("TextureHover"):
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+            }
+
+            case getPropertyId("TextureDisabled"):
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+            }
+
+            case getPropertyId("TextureFocused"):
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                break;
+            }
+
+            case getPropertyId("TextStyle"):
+            {
+                const TextStyles style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textSuffix.setStyle(style);
+                m_textFull.setStyle(style);
+                break;
+            }
+
+            case getPropertyId("DefaultTextStyle"):
+            {
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BorderColorHover"):
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case getPropertyId("BorderColorDisabled"):
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+
+            case getPropertyId("BorderColorFocused"):
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorDisabled"):
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorFocused"):
+            {
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                break;
+            }
+
+            case getPropertyId("CaretColor"):
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+
+            case getPropertyId("CaretColorHover"):
+            {
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                break;
+            }
+
+            case getPropertyId("CaretColorFocused"):
+            {
+                m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+                break;
+            }
+
+            case getPropertyId("SelectedTextBackgroundColor"):
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                m_textSuffix.setOpacity(m_opacityCached);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textSuffix.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                updateTextSize();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -883,44 +944,44 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
         if (node->propertyValuePairs["DefaultText"])
-            setDefaultText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["DefaultText"]->value).getString());
+            setDefaultText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["DefaultText"]).getString());
         if (node->propertyValuePairs["MaximumCharacters"])
-            setMaximumCharacters(node->propertyValuePairs["MaximumCharacters"]->value.toInt());
+            setMaximumCharacters(node->propertyValuePairs["MaximumCharacters"]->getValue().toInt());
         if (node->propertyValuePairs["TextWidthLimited"])
-            limitTextWidth(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["TextWidthLimited"]->value).getBool());
+            limitTextWidth(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["TextWidthLimited"]).getBool());
         if (node->propertyValuePairs["ReadOnly"])
-            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ReadOnly"]->value).getBool());
+            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ReadOnly"]).getBool());
         if (node->propertyValuePairs["Suffix"])
-            setSuffix(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Suffix"]->value).getString());
+            setSuffix(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Suffix"]).getString());
         if (node->propertyValuePairs["PasswordCharacter"])
         {
-            const String pass = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["PasswordCharacter"]->value).getString();
+            const String pass = Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["PasswordCharacter"]).getString();
             if (!pass.empty())
                 setPasswordCharacter(pass[0]);
         }
         if (node->propertyValuePairs["Alignment"])
         {
-            if (node->propertyValuePairs["Alignment"]->value == "Left")
+            if (node->propertyValuePairs["Alignment"]->getValue() == "Left")
                 setAlignment(EditBox::Alignment::Left);
-            else if (node->propertyValuePairs["Alignment"]->value == "Center")
+            else if (node->propertyValuePairs["Alignment"]->getValue() == "Center")
                 setAlignment(EditBox::Alignment::Center);
-            else if (node->propertyValuePairs["Alignment"]->value == "Right")
+            else if (node->propertyValuePairs["Alignment"]->getValue() == "Right")
                 setAlignment(EditBox::Alignment::Right);
             else
                 throw Exception{"Failed to parse Alignment property. Only the values Left, Center and Right are correct."};
         }
         if (node->propertyValuePairs["InputValidator"])
         {
-            if (node->propertyValuePairs["InputValidator"]->value == "Int")
+            if (node->propertyValuePairs["InputValidator"]->getValue() == "Int")
                 setInputValidator(EditBox::Validator::Int);
-            else if (node->propertyValuePairs["InputValidator"]->value == "UInt")
+            else if (node->propertyValuePairs["InputValidator"]->getValue() == "UInt")
                 setInputValidator(EditBox::Validator::UInt);
-            else if (node->propertyValuePairs["InputValidator"]->value == "Float")
+            else if (node->propertyValuePairs["InputValidator"]->getValue() == "Float")
                 setInputValidator(EditBox::Validator::Float);
             else
-                setInputValidator(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["InputValidator"]->value).getString());
+                setInputValidator(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["InputValidator"]).getString());
         }
     }
 
@@ -1290,6 +1351,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isUpdateTimeRequired() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> EditBox::getTimeUntilNextUpdate() const
+    {
+        if (!m_focused && !m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getEditCursorBlinkRate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::backspaceKeyPressed()
     {
         if (m_readOnly)
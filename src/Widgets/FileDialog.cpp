@@ -28,6 +28,10 @@
 #include <vector>
 #include <map>
 #include <ctime>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
 
 #ifdef TGUI_SYSTEM_WINDOWS
     #include <TGUI/extlibs/IncludeWindows.hpp>
@@ -39,6 +43,17 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct FileDialog::DirectoryListing
+    {
+        std::atomic<bool> cancelled{false}; // Set by the main thread when the listing is no longer needed
+        std::mutex mutex;
+        std::vector<Filesystem::FileInfo> foundFiles; // Files that weren't passed to the main thread yet, protected by the mutex
+        bool finished = false; // Protected by the mutex
+        std::thread thread; // Always joined by the dialog before it releases the listing, but only blocks when the dialog is destroyed
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     FileDialog::FileDialog(const char* typeName, bool initRenderer) :
         ChildWindow{typeName, false},
         m_iconLoader(FileDialogIconLoader::createInstance())
@@ -185,6 +200,8 @@ namespace tgui
         m_fileTypeFilters       {std::move(other.m_fileTypeFilters)},
         m_selectedFileTypeFilter{std::move(other.m_selectedFileTypeFilter)},
         m_iconLoader            {std::move(other.m_iconLoader)},
+        m_directoryListing      {std::move(other.m_directoryListing)},
+        m_cancelledDirectoryListings{std::move(other.m_cancelledDirectoryListings)},
         m_selectedFiles         {std::move(other.m_selectedFiles)}
     {
         connectSignals();
@@ -255,6 +272,11 @@ namespace tgui
             m_fileTypeFilters = std::move(other.m_fileTypeFilters);
             m_selectedFileTypeFilter = std::move(other.m_selectedFileTypeFilter);
             m_iconLoader = std::move(other.m_iconLoader);
+            cancelDirectoryListing();
+            m_directoryListing = std::move(other.m_directoryListing);
+            m_cancelledDirectoryListings.insert(m_cancelledDirectoryListings.end(),
+                std::make_move_iterator(other.m_cancelledDirectoryListings.begin()), std::make_move_iterator(other.m_cancelledDirectoryListings.end()));
+            other.m_cancelledDirectoryListings.clear();
             m_selectedFiles = std::move(other.m_selectedFiles);
 
             connectSignals();
@@ -265,6 +287,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FileDialog::~FileDialog()
+    {
+        cancelDirectoryListing();
+        joinCancelledDirectoryListings(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     FileDialog::Ptr FileDialog::create(String title, String confirmButtonText)
     {
         auto fileDialog = std::make_shared<FileDialog>();
@@ -595,10 +625,16 @@ namespace tgui
 
     bool FileDialog::updateTime(Duration elapsedTime)
     {
-        const bool childWidgetUpdated = ChildWindow::updateTime(elapsedTime);
+        bool screenRefreshRequired = ChildWindow::updateTime(elapsedTime);
+
+        joinCancelledDirectoryListings(false);
+
+        if (updateDirectoryListing())
+            screenRefreshRequired = true;
 
-        if (!m_iconLoader->update())
-            return childWidgetUpdated;
+        // While the directory is still being listed, the icons that might have finished loading belong to the previous directory
+        if (!m_iconLoader->update() || m_directoryListing)
+            return screenRefreshRequired;
 
         m_fileIcons = m_iconLoader->retrieveFileIcons();
 
@@ -610,6 +646,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialog::isUpdateTimeRequired() const
+    {
+        return m_directoryListing || m_iconLoader->isLoading() || ChildWindow::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> FileDialog::getTimeUntilNextUpdate() const
+    {
+        const Optional<Duration> time = ChildWindow::getTimeUntilNextUpdate();
+        if (!m_directoryListing && !m_iconLoader->isLoading())
+            return time;
+
+        // The background threads can't wake up the main loop, so their results are picked up at the rate the listing
+        // thread passes its files to the dialog
+        const Duration pollInterval = std::chrono::milliseconds(50);
+        return (time && (*time < pollInterval)) ? *time : pollInterval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FileDialog::changePath(const Filesystem::Path& path, bool updateHistory)
     {
         if (updateHistory && (m_currentDirectory != path))
@@ -625,14 +682,16 @@ namespace tgui
         m_currentDirectory = path;
         m_editBoxPath->setText(m_currentDirectory.asString());
 
-        m_filesInDirectory = Filesystem::listFilesInDirectory(path);
+        cancelDirectoryListing();
+        m_filesInDirectory.clear();
+        m_fileIcons.clear();
+        m_listView->removeAllItems();
 
 #ifdef TGUI_SYSTEM_WINDOWS
         if (path.asString().empty())
         {
             m_listView->setHeaderVisible(false);
             m_listView->setShowVerticalGridLines(false);
-            m_listView->removeAllItems();
             wchar_t logicalDrives[MAX_PATH];
 
             if (GetLogicalDriveStringsW(MAX_PATH, logicalDrives))
@@ -644,35 +703,195 @@ namespace tgui
                     drive += std::wcslen(drive) + 1;
                 }
             }
-            m_filesInDirectory.clear();
             return;
         }
 #endif // TGUI_SYSTEM_WINDOWS
 
-        // If only directories should be shown then remove the files from the list
-        if (m_selectingDirectory)
+        if (!m_listView->getHeaderVisible())
         {
-            m_filesInDirectory.erase(std::remove_if(m_filesInDirectory.begin(), m_filesInDirectory.end(),
-                [](const Filesystem::FileInfo& info){ return !info.directory; }), m_filesInDirectory.end());
+            m_listView->setHeaderVisible(true);
+            m_listView->setShowVerticalGridLines(true);
         }
 
-        m_fileIcons.clear();
-        if (m_iconLoader->hasGenericIcons())
+        m_listView->setVerticalScrollbarValue(0);
+
+        // If the directory was listed before and nothing changed since then, the files can be shown immediately.
+        // Otherwise the files are added to the list view in updateTime while they are being found in a background thread.
+        if (Filesystem::getCachedFilesInDirectory(path, m_filesInDirectory))
         {
-            m_fileIcons.reserve(m_filesInDirectory.size());
-            for (const auto& file : m_filesInDirectory)
-                m_fileIcons.push_back(m_iconLoader->getGenericFileIcon(file));
+            // If only directories should be shown then remove the files from the list
+            if (m_selectingDirectory)
+            {
+                m_filesInDirectory.erase(std::remove_if(m_filesInDirectory.begin(), m_filesInDirectory.end(),
+                    [](const Filesystem::FileInfo& info){ return !info.directory; }), m_filesInDirectory.end());
+            }
+
+            if (m_iconLoader->hasGenericIcons())
+            {
+                m_fileIcons.reserve(m_filesInDirectory.size());
+                for (const auto& file : m_filesInDirectory)
+                    m_fileIcons.push_back(m_iconLoader->getGenericFileIcon(file));
+            }
+
+            m_iconLoader->requestFileIcons(m_filesInDirectory);
+            sortFilesInListView();
         }
+        else
+            startDirectoryListing();
 
-        m_iconLoader->requestFileIcons(m_filesInDirectory);
+        // The files that are being listed and the icons that are being loaded are picked up in updateTime
+        if (isUpdateTimeRequired())
+            requestUpdateTime();
 
-        m_listView->setVerticalScrollbarValue(0);
-        sortFilesInListView();
         updateConfirmButtonEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void FileDialog::startDirectoryListing()
+    {
+        cancelDirectoryListing();
+
+        auto listing = std::make_shared<DirectoryListing>();
+        m_directoryListing = listing;
+
+        // When the dialog navigates elsewhere or is destroyed then the thread will notice it was cancelled and stop listing
+        // the remaining files. The dialog only waits for the thread to finish when it is destroyed, so it never outlives the dialog.
+        const Filesystem::Path path = m_currentDirectory;
+        const bool directoriesOnly = m_selectingDirectory;
+        listing->thread = std::thread([listing,path,directoriesOnly]{
+            std::vector<Filesystem::FileInfo> batch;
+            auto lastBatchTime = std::chrono::steady_clock::now();
+            const auto passBatchToMainThread = [&]{
+                std::lock_guard<std::mutex> lock(listing->mutex);
+                if (listing->foundFiles.empty())
+                    listing->foundFiles = std::move(batch);
+                else
+                    listing->foundFiles.insert(listing->foundFiles.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+
+                batch.clear();
+                lastBatchTime = std::chrono::steady_clock::now();
+            };
+
+            Filesystem::listFilesInDirectory(path, [&](Filesystem::FileInfo&& file){
+                if (listing->cancelled)
+                    return false;
+
+                // Files are passed in batches, but on slow filesystems we don't want to wait too long before showing them
+                batch.push_back(std::move(file));
+                if ((batch.size() >= 256) || (std::chrono::steady_clock::now() - lastBatchTime >= std::chrono::milliseconds(50)))
+                    passBatchToMainThread();
+
+                return true;
+            }, directoriesOnly, !directoriesOnly);
+
+            passBatchToMainThread();
+
+            std::lock_guard<std::mutex> lock(listing->mutex);
+            listing->finished = true;
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::cancelDirectoryListing()
+    {
+        if (!m_directoryListing)
+            return;
+
+        // Listing a single file can take long on a slow filesystem, so we don't wait here for the thread to notice the flag
+        m_directoryListing->cancelled = true;
+        m_cancelledDirectoryListings.push_back(std::move(m_directoryListing));
+        m_directoryListing = nullptr;
+
+        joinCancelledDirectoryListings(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::joinCancelledDirectoryListings(bool waitForAll)
+    {
+        for (auto it = m_cancelledDirectoryListings.begin(); it != m_cancelledDirectoryListings.end();)
+        {
+            if (!waitForAll)
+            {
+                std::lock_guard<std::mutex> lock((*it)->mutex);
+                if (!(*it)->finished)
+                {
+                    ++it;
+                    continue;
+                }
+            }
+
+            (*it)->thread.join();
+            it = m_cancelledDirectoryListings.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::updateDirectoryListing()
+    {
+        if (!m_directoryListing)
+            return false;
+
+        std::vector<Filesystem::FileInfo> newFiles;
+        bool finished;
+        {
+            std::lock_guard<std::mutex> lock(m_directoryListing->mutex);
+            newFiles.swap(m_directoryListing->foundFiles);
+            finished = m_directoryListing->finished;
+        }
+
+        // Until all files are known, new files are just added at the end of the list
+        const bool useGenericIcons = m_iconLoader->hasGenericIcons() && (m_fileIcons.size() == m_filesInDirectory.size());
+        for (auto& file : newFiles)
+        {
+            Texture icon;
+            if (useGenericIcons)
+            {
+                icon = m_iconLoader->getGenericFileIcon(file);
+                m_fileIcons.push_back(icon);
+            }
+
+            addFileToListView(file, icon);
+            m_filesInDirectory.push_back(std::move(file));
+        }
+
+        if (!finished)
+            return !newFiles.empty();
+
+        m_directoryListing->thread.join();
+        m_directoryListing = nullptr;
+
+        // Icons may have become available while the listing was busy, in which case the earlier files didn't get an icon
+        if (m_fileIcons.size() != m_filesInDirectory.size())
+            m_fileIcons.clear();
+
+        // Now that all files are known, show them in the requested order and load their icons
+        const int selectedItemIndex = m_listView->getSelectedItemIndex();
+        const String selectedItem = (selectedItemIndex >= 0) ? m_listView->getItem(static_cast<std::size_t>(selectedItemIndex)) : U"";
+
+        sortFilesInListView();
+
+        if (!selectedItem.empty())
+        {
+            for (std::size_t i = 0; i < m_listView->getItemCount(); ++i)
+            {
+                if (m_listView->getItem(i) == selectedItem)
+                {
+                    m_listView->setSelectedItem(i);
+                    break;
+                }
+            }
+        }
+
+        m_iconLoader->requestFileIcons(m_filesInDirectory);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FileDialog::historyChanged()
     {
         m_buttonBack->setEnabled(m_pathHistoryIndex > 0);
@@ -744,94 +963,96 @@ namespace tgui
         }
         m_listView->removeAllItems();
         for (const auto& item : items)
+            addFileToListView(item.first, item.second);
+
+        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::addFileToListView(const Filesystem::FileInfo& file, const Texture& icon)
+    {
+        // Filter the files
+        if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
         {
-            const Filesystem::FileInfo& file = item.first;
-            const Texture& icon = item.second;
+            const String& lowercaseFilename = file.filename.toLower();
 
-            // Filter the files
-            if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
+            bool fileAccepted = false;
+            for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
             {
-                const String& lowercaseFilename = file.filename.toLower();
+                TGUI_ASSERT(!filter.empty(), "FileDialog::addFileToListView can't have empty filter, they are removed in setFileTypeFilters");
 
-                bool fileAccepted = false;
-                for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
+                if (filter[0] == '*')
                 {
-                    TGUI_ASSERT(!filter.empty(), "FileDialog::sortFilesInListView can't have empty filter, they are removed in setFileTypeFilters");
-
-                    if (filter[0] == '*')
-                    {
-                        if ((lowercaseFilename.length() >= filter.length() - 1)
-                         && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
-                                                       filter.length() - 1, filter, 1, filter.length() - 1) == 0))
-                        {
-                            fileAccepted = true;
-                            break;
-                        }
-                    }
-                    // Check if the filter matches exactly with the filename
-                    else if (lowercaseFilename == filter)
+                    if ((lowercaseFilename.length() >= filter.length() - 1)
+                     && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
+                                                   filter.length() - 1, filter, 1, filter.length() - 1) == 0))
                     {
                         fileAccepted = true;
                         break;
                     }
                 }
-
-                if (!fileAccepted)
-                    continue;
+                // Check if the filter matches exactly with the filename
+                else if (lowercaseFilename == filter)
+                {
+                    fileAccepted = true;
+                    break;
+                }
             }
 
-            String fileSizeStr;
-            if (!file.directory)
-            {
-                if (file.fileSize == 0)
-                    fileSizeStr = U"0.0 KB";
-                else if (file.fileSize < 100u)
-                    fileSizeStr = U"0.1 KB";
-                else if (file.fileSize < 1000u*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
-                else if (file.fileSize < 1000u*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
-                else if (file.fileSize < 1000ull*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
-                else if (file.fileSize < 1000ull*1000*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
-            }
+            if (!fileAccepted)
+                return;
+        }
 
-            String modificationTimeStr;
-            char buffer[19];
+        String fileSizeStr;
+        if (!file.directory)
+        {
+            if (file.fileSize == 0)
+                fileSizeStr = U"0.0 KB";
+            else if (file.fileSize < 100u)
+                fileSizeStr = U"0.1 KB";
+            else if (file.fileSize < 1000u*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
+            else if (file.fileSize < 1000u*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
+            else if (file.fileSize < 1000ull*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
+            else if (file.fileSize < 1000ull*1000*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
+        }
+
+        String modificationTimeStr;
+        char buffer[19];
 #if defined(TGUI_SYSTEM_WINDOWS) && defined(_MSC_VER)
-            tm TimeStructure;
-            if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
-            {
-                if (strftime(buffer, 19, "%e %b %Y  %R", &TimeStructure) != 0)
-                    modificationTimeStr = buffer;
-            }
-#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
-            if (strftime(buffer, 19, "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+        tm TimeStructure;
+        if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
+        {
+            if (strftime(buffer, 19, "%e %b %Y  %R", &TimeStructure) != 0)
                 modificationTimeStr = buffer;
+        }
+#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
+        if (strftime(buffer, 19, "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeStr = buffer;
 #else
-            if (strftime(buffer, 19, "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
-                modificationTimeStr = buffer;
+        if (strftime(buffer, 19, "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeStr = buffer;
 #endif
 
 #if defined(TGUI_SYSTEM_WINDOWS)
-            // Hide .lnk and .url extensions
-            String filename = file.filename;
-            const auto filenameLen = file.filename.length();
-            if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
-                filename.erase(filenameLen - 4, 4);
+        // Hide .lnk and .url extensions
+        String filename = file.filename;
+        const auto filenameLen = file.filename.length();
+        if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
+            filename.erase(filenameLen - 4, 4);
 
-            const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
 #else
-            const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
 #endif
-            m_listView->setItemData(itemIndex, file.directory);
-
-            if (icon.getData())
-                m_listView->setItemIcon(itemIndex, icon);
-        }
+        m_listView->setItemData(itemIndex, file.directory);
 
-        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+        if (icon.getData())
+            m_listView->setItemIcon(itemIndex, icon);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1033,90 +1254,114 @@ namespace tgui
 
     void FileDialog::rendererChanged(const String& property)
     {
-        if (property == "ListView")
-        {
-            m_listView->setRenderer(getSharedRenderer()->getListView());
-        }
-        else if (property == "EditBox")
-        {
-            const auto& renderer = getSharedRenderer()->getEditBox();
-            m_editBoxFilename->setRenderer(renderer);
-            m_editBoxPath->setRenderer(renderer);
-        }
-        else if (property == "Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            m_buttonCancel->setRenderer(renderer);
-            m_buttonConfirm->setRenderer(renderer);
-
-            if (!getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(renderer);
-            if (!getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(renderer);
-            if (!getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(renderer);
-        }
-        else if (property == "BackButton")
-        {
-            if (getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
-            else
-                m_buttonBack->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == "ForwardButton")
-        {
-            if (getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
-            else
-                m_buttonForward->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == "UpButton")
-        {
-            if (getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
-            else
-                m_buttonUp->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == "FilenameLabel")
+        switch (getPropertyId(property))
         {
-            m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
-        }
-        else if (property == "FileTypeComboBox")
-        {
-            m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
-        }
-        else if (property == "ArrowsOnNavigationButtonsVisible")
-        {
-            if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+            case getPropertyId("ListView"):
             {
-                m_buttonBack->setText(U"\u2190");
-                m_buttonForward->setText(U"\u2192");
-                m_buttonUp->setText(U"\u2191");
+                m_listView->setRenderer(getSharedRenderer()->getListView());
+                break;
             }
-            else
+
+            case getPropertyId("EditBox"):
             {
-                m_buttonBack->setText(U"");
-                m_buttonForward->setText(U"");
-                m_buttonUp->setText(U"");
+                const auto& renderer = getSharedRenderer()->getEditBox();
+                m_editBoxFilename->setRenderer(renderer);
+                m_editBoxPath->setRenderer(renderer);
+                break;
             }
+
+            case getPropertyId("Button"):
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                m_buttonCancel->setRenderer(renderer);
+                m_buttonConfirm->setRenderer(renderer);
+
+                if (!getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(renderer);
+                if (!getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(renderer);
+                if (!getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(renderer);
+                break;
+            }
+
+            case getPropertyId("BackButton"):
+            {
+                if (getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
+                else
+                    m_buttonBack->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+
+            case getPropertyId("ForwardButton"):
+            {
+                if (getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
+                else
+                    m_buttonForward->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+
+            case getPropertyId("UpButton"):
+            {
+                if (getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
+                else
+                    m_buttonUp->setRenderer(getSharedRenderer()->getButton());
+                break;
+            }
+
+            case getPropertyId("FilenameLabel"):
+            {
+                m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
+                break;
+            }
+
+            case getPropertyId("FileTypeComboBox"):
+            {
+                m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
+                break;
+            }
+
+            case getPropertyId("ArrowsOnNavigationButtonsVisible"):
+            {
+                if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+                {
+                    m_buttonBack->setText(U"\u2190");
+                    m_buttonForward->setText(U"\u2192");
+                    m_buttonUp->setText(U"\u2191");
+                }
+                else
+                {
+                    m_buttonBack->setText(U"");
+                    m_buttonForward->setText(U"");
+                    m_buttonUp->setText(U"");
+                }
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                ChildWindow::rendererChanged(property);
+
+                m_buttonBack->setInheritedFont(m_fontCached);
+                m_buttonForward->setInheritedFont(m_fontCached);
+                m_buttonUp->setInheritedFont(m_fontCached);
+                m_editBoxPath->setInheritedFont(m_fontCached);
+                m_listView->setInheritedFont(m_fontCached);
+                m_labelFilename->setInheritedFont(m_fontCached);
+                m_editBoxFilename->setInheritedFont(m_fontCached);
+                m_comboBoxFileTypes->setInheritedFont(m_fontCached);
+                m_buttonCancel->setInheritedFont(m_fontCached);
+                m_buttonConfirm->setInheritedFont(m_fontCached);
+                break;
+            }
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else if (property == "Font")
-        {
-            ChildWindow::rendererChanged(property);
-
-            m_buttonBack->setInheritedFont(m_fontCached);
-            m_buttonForward->setInheritedFont(m_fontCached);
-            m_buttonUp->setInheritedFont(m_fontCached);
-            m_editBoxPath->setInheritedFont(m_fontCached);
-            m_listView->setInheritedFont(m_fontCached);
-            m_labelFilename->setInheritedFont(m_fontCached);
-            m_editBoxFilename->setInheritedFont(m_fontCached);
-            m_comboBoxFileTypes->setInheritedFont(m_fontCached);
-            m_buttonCancel->setInheritedFont(m_fontCached);
-            m_buttonConfirm->setInheritedFont(m_fontCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1196,7 +1441,7 @@ namespace tgui
             if (!childNode->propertyValuePairs["Pattern"]->listNode)
                 throw Exception{"Failed to parse 'Pattern' property inside the 'FileTypeFilter' property, expected a list as value"};
 
-            String description = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Description"]->value).getString();
+            String description = Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Description"]).getString();
 
             std::vector<String> patterns;
             for (const auto& item : childNode->propertyValuePairs["Pattern"]->valueList)
@@ -1220,17 +1465,17 @@ namespace tgui
         connectSignals();
 
         if (node->propertyValuePairs["FileMustExist"])
-            setFileMustExist(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["FileMustExist"]->value).getBool());
+            setFileMustExist(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["FileMustExist"]).getBool());
         if (node->propertyValuePairs["SelectingDirectory"])
-            setSelectingDirectory(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["SelectingDirectory"]->value).getBool());
+            setSelectingDirectory(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["SelectingDirectory"]).getBool());
         if (node->propertyValuePairs["MultiSelect"])
-            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["MultiSelect"]->value).getBool());
+            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["MultiSelect"]).getBool());
 
         if (!fileTypeFilters.empty())
         {
             std::size_t filterIndex = 0;
             if (node->propertyValuePairs["SelectedFileTypeFilter"])
-                filterIndex = static_cast<std::size_t>(Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["SelectedFileTypeFilter"]->value).getNumber());
+                filterIndex = static_cast<std::size_t>(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["SelectedFileTypeFilter"]).getNumber());
 
             setFileTypeFilters(fileTypeFilters, filterIndex);
         }
@@ -1246,6 +1491,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::canLoadWidgetsLazily() const
+    {
+        // The internal widgets are looked up in the child widgets while loading
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
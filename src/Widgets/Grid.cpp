@@ -523,7 +523,7 @@ namespace tgui
         Container::load(node, renderers);
 
         if (node->propertyValuePairs["AutoSize"])
-            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoSize"]->value).getBool());
+            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["AutoSize"]).getBool());
 
         if (node->propertyValuePairs["GridWidgets"])
         {
@@ -138,13 +138,19 @@ namespace tgui
 
     void Group::rendererChanged(const String& property)
     {
-        if (property == "Padding")
+        switch (getPropertyId(property))
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +177,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Group::canLoadWidgetsLazily() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,46 +472,67 @@ namespace tgui
 
     void Knob::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
-        }
-        else if (property == "TextureForeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "ImageRotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureForeground"):
+            {
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("ThumbColor"):
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case getPropertyId("ImageRotation"):
+            {
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -537,17 +558,17 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["StartRotation"])
-            setStartRotation(node->propertyValuePairs["StartRotation"]->value.toFloat());
+            setStartRotation(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["StartRotation"]).getNumber());
         if (node->propertyValuePairs["EndRotation"])
-            setEndRotation(node->propertyValuePairs["EndRotation"]->value.toFloat());
+            setEndRotation(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["EndRotation"]).getNumber());
         if (node->propertyValuePairs["Minimum"])
-            setMinimum(node->propertyValuePairs["Minimum"]->value.toFloat());
+            setMinimum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Minimum"]).getNumber());
         if (node->propertyValuePairs["Maximum"])
-            setMaximum(node->propertyValuePairs["Maximum"]->value.toFloat());
+            setMaximum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Maximum"]).getNumber());
         if (node->propertyValuePairs["Value"])
-            setValue(node->propertyValuePairs["Value"]->value.toFloat());
+            setValue(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Value"]).getNumber());
         if (node->propertyValuePairs["ClockwiseTurning"])
-            setClockwiseTurning(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ClockwiseTurning"]->value).getBool());
+            setClockwiseTurning(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ClockwiseTurning"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
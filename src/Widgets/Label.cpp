@@ -298,6 +298,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    requestUpdateTime();
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -369,89 +370,140 @@ namespace tgui
 
     void Label::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "TextOutlineThickness")
-        {
-            m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
-            for (auto& line : m_lines)
-                line.setOutlineThickness(m_textOutlineThicknessCached);
-        }
-        else if (property == "TextOutlineColor")
-        {
-            m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
-            for (auto& line : m_lines)
-                line.setOutlineColor(m_textOutlineColorCached);
-        }
-        else if (property == "Scrollbar")
-        {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                            getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                rearrangeText();
+                break;
+            }
+
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
+            }
+
+            case getPropertyId("TextStyle"):
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                break;
+            }
+
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                    line.setColor(m_textColorCached);
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("TextOutlineThickness"):
+            {
+                m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
+                for (auto& line : m_lines)
+                    line.setOutlineThickness(m_textOutlineThicknessCached);
+                break;
+            }
+
+            case getPropertyId("TextOutlineColor"):
+            {
+                m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
+                for (auto& line : m_lines)
+                    line.setOutlineColor(m_textOutlineColorCached);
+                break;
+            }
+
+            case getPropertyId("Scrollbar"):
+            {
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                    rearrangeText();
+                }
+                break;
+            }
+
+            case getPropertyId("ScrollbarWidth"):
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setSize({width, m_scrollbar->getSize().y});
+                rearrangeText();
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("Font"):
             {
-                m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                Widget::rendererChanged(property);
                 rearrangeText();
+                break;
             }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == "ScrollbarWidth")
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::rendererPropertiesChanged(const std::vector<String>& properties)
+    {
+        m_rearrangeTextPostponed = true;
+        try
         {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
+            Widget::rendererPropertiesChanged(properties);
         }
-        else if (property == "Font")
+        catch (const Exception&)
         {
-            Widget::rendererChanged(property);
+            m_rearrangeTextPostponed = false;
             rearrangeText();
+            throw;
         }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
+        m_rearrangeTextPostponed = false;
+        rearrangeText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,7 +550,7 @@ namespace tgui
 
         if (node->propertyValuePairs["HorizontalAlignment"])
         {
-            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["HorizontalAlignment"]->value).getString();
+            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["HorizontalAlignment"]).getString();
             if (alignment == "Right")
                 setHorizontalAlignment(Label::HorizontalAlignment::Right);
             else if (alignment == "Center")
@@ -509,7 +561,7 @@ namespace tgui
 
         if (node->propertyValuePairs["VerticalAlignment"])
         {
-            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["VerticalAlignment"]->value).getString();
+            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["VerticalAlignment"]).getString();
             if (alignment == "Bottom")
                 setVerticalAlignment(Label::VerticalAlignment::Bottom);
             else if (alignment == "Center")
@@ -520,7 +572,7 @@ namespace tgui
 
         if (node->propertyValuePairs["ScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["ScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["ScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -532,14 +584,14 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
         if (node->propertyValuePairs["MaximumTextWidth"])
-            setMaximumTextWidth(node->propertyValuePairs["MaximumTextWidth"]->value.toFloat());
+            setMaximumTextWidth(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["MaximumTextWidth"]).getNumber());
         if (node->propertyValuePairs["AutoSize"])
-            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoSize"]->value).getBool());
+            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["AutoSize"]).getBool());
 
         if (node->propertyValuePairs["IgnoreMouseEvents"])
-            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["IgnoreMouseEvents"]->value).getBool());
+            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["IgnoreMouseEvents"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -559,12 +611,74 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Label::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
-        m_lines.clear();
+        if (m_rearrangeTextPostponed)
+            return;
+
+        RearrangeTextParams params;
+        params.string = m_string;
+        params.font = m_fontCached;
+        params.textSize = m_textSizeCached;
+        params.textStyle = m_textStyleCached;
+        params.size = getSize();
+        params.maximumTextWidth = m_maximumTextWidth;
+        params.scrollbarWidth = m_scrollbar->getSize().x;
+        params.borders = m_bordersCached;
+        params.padding = m_paddingCached;
+        params.horizontalAlignment = m_horizontalAlignment;
+        params.verticalAlignment = m_verticalAlignment;
+        params.scrollbarPolicy = m_scrollbarPolicy;
+        params.autoSize = m_autoSize;
+
+        const auto& oldParams = m_rearrangeTextParams;
+        const bool lineStyleChanged = (params.font != oldParams.font) || (params.textSize != oldParams.textSize) || (params.textStyle != oldParams.textStyle);
+        const bool textChanged = (params.string != oldParams.string);
+
+        // Nothing has to be done if none of the parameters changed since the last time the text was arranged
+        if (!lineStyleChanged && !textChanged
+         && (params.size == oldParams.size)
+         && (params.maximumTextWidth == oldParams.maximumTextWidth)
+         && (params.scrollbarWidth == oldParams.scrollbarWidth)
+         && (params.borders == oldParams.borders)
+         && (params.padding == oldParams.padding)
+         && (params.horizontalAlignment == oldParams.horizontalAlignment)
+         && (params.verticalAlignment == oldParams.verticalAlignment)
+         && (params.scrollbarPolicy == oldParams.scrollbarPolicy)
+         && (params.autoSize == oldParams.autoSize))
+        {
+            return;
+        }
+
+        // Previously word-wrapped strings can't be reused when the text or its style changed
+        if (lineStyleChanged || textChanged)
+            m_wordWrapCache.clear();
+
+        m_rearrangeTextParams = std::move(params);
 
         if (m_fontCached == nullptr)
+        {
+            m_lines.clear();
             return;
+        }
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached, m_textStyleCached);
 
@@ -602,18 +716,21 @@ namespace tgui
                 maxWidth -= m_scrollbar->getSize().x;
 
             if (maxWidth <= 0)
+            {
+                m_lines.clear();
                 return;
+            }
         }
 
         // Fit the text in the available space
-        String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
+        const String* string = &getWordWrappedText(maxWidth);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
                                  m_paddingCached.getRight() + m_bordersCached.getRight(),
                                  m_paddingCached.getBottom() + m_bordersCached.getBottom()};
 
-        const auto lineCount = std::count(string.begin(), string.end(), U'\n') + 1;
+        const auto lineCount = std::count(string->begin(), string->end(), U'\n') + 1;
         float requiredTextHeight = lineCount * m_fontCached.getLineSpacing(m_textSizeCached)
                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSizeCached, m_textStyleCached)
                                    + Text::getExtraVerticalPadding(m_textSizeCached);
@@ -626,11 +743,14 @@ namespace tgui
             {
                 maxWidth -= m_scrollbar->getSize().x;
                 if (maxWidth <= 0)
+                {
+                    m_lines.clear();
                     return;
+                }
 
-                string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
+                string = &getWordWrappedText(maxWidth);
 
-                const auto newLineCount = std::count(string.begin(), string.end(), U'\n') + 1;
+                const auto newLineCount = std::count(string->begin(), string->end(), U'\n') + 1;
                 requiredTextHeight = newLineCount * m_fontCached.getLineSpacing(m_textSizeCached)
                                      + Text::calculateExtraVerticalSpace(m_fontCached, m_textSizeCached, m_textStyleCached)
                                      + Text::getExtraVerticalPadding(m_textSizeCached);
@@ -643,34 +763,54 @@ namespace tgui
             m_scrollbar->setScrollAmount(m_textSizeCached);
         }
 
-        // Split the string in multiple lines
+        // The existing lines can only be reused if they still have the correct font and style
+        if (lineStyleChanged)
+            m_lines.clear();
+
+        // Split the string in multiple lines. Lines that didn't change (e.g. when text was only added at the end) are kept.
         float width = 0;
+        std::size_t lineIndex = 0;
         std::size_t searchPosStart = 0;
         std::size_t newLinePos = 0;
         while (newLinePos != String::npos)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            TGUI_EMPLACE_BACK(line, m_lines)
-            line.setCharacterSize(getTextSize());
-            line.setFont(m_fontCached);
-            line.setStyle(m_textStyleCached);
-            line.setColor(m_textColorCached);
-            line.setOpacity(m_opacityCached);
-            line.setOutlineColor(m_textOutlineColorCached);
-            line.setOutlineThickness(m_textOutlineThicknessCached);
+            newLinePos = string->find('\n', searchPosStart);
 
+            String lineString;
             if (newLinePos != String::npos)
-                line.setString(string.substr(searchPosStart, newLinePos - searchPosStart));
+                lineString = string->substr(searchPosStart, newLinePos - searchPosStart);
+            else
+                lineString = string->substr(searchPosStart);
+
+            if (lineIndex < m_lines.size())
+            {
+                if (m_lines[lineIndex].getString() != lineString)
+                    m_lines[lineIndex].setString(lineString);
+            }
             else
-                line.setString(string.substr(searchPosStart));
+            {
+                TGUI_EMPLACE_BACK(line, m_lines)
+                line.setCharacterSize(getTextSize());
+                line.setFont(m_fontCached);
+                line.setStyle(m_textStyleCached);
+                line.setColor(m_textColorCached);
+                line.setOpacity(m_opacityCached);
+                line.setOutlineColor(m_textOutlineColorCached);
+                line.setOutlineThickness(m_textOutlineThicknessCached);
+                line.setString(lineString);
+            }
 
-            if (line.getSize().x > width)
-                width = line.getSize().x;
+            if (m_lines[lineIndex].getSize().x > width)
+                width = m_lines[lineIndex].getSize().x;
 
+            ++lineIndex;
             searchPosStart = newLinePos + 1;
         }
 
+        // Remove the lines that are no longer needed
+        if (lineIndex < m_lines.size())
+            m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex), m_lines.end());
+
         // Update the size of the label
         if (m_autoSize)
         {
@@ -680,6 +820,11 @@ namespace tgui
 
             m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+
+            // The size is a result of rearranging the text, so it shouldn't cause the text to be rearranged again
+            m_rearrangeTextParams.size = getSize();
+            m_rearrangeTextParams.borders = m_bordersCached;
+            m_rearrangeTextParams.padding = m_paddingCached;
         }
 
         // Update the line positions
@@ -735,6 +880,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const String& Label::getWordWrappedText(float maxWidth)
+    {
+        for (const auto& pair : m_wordWrapCache)
+        {
+            if (pair.first == maxWidth)
+                return pair.second;
+        }
+
+        // Only keep the results for the last two widths (with and without scrollbar)
+        if (m_wordWrapCache.size() >= 2)
+            m_wordWrapCache.erase(m_wordWrapCache.begin());
+
+        m_wordWrapCache.emplace_back(maxWidth, Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold));
+        return m_wordWrapCache.back().second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
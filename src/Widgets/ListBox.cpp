@@ -626,6 +626,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
             }
         }
 
@@ -758,127 +759,195 @@ namespace tgui
 
     void ListBox::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == "SelectedTextStyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
 
-            if (m_selectedItem >= 0)
+            case getPropertyId("TextColorHover"):
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColorHover"):
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("TextStyle"):
             {
-                if (m_selectedTextStyleCached.isSet())
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                for (auto& item : m_items)
+                    item.text.setStyle(m_textStyleCached);
+
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
                     m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].text.setStyle(m_textStyleCached);
+                break;
             }
-        }
-        else if (property == "Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("SelectedTextStyle"):
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[m_selectedItem].text.setStyle(m_textStyleCached);
+                }
+                break;
             }
-        }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_scroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Scrollbar"):
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    updateSizeAfterRendererChange();
+                }
+                break;
+            }
+
+            case getPropertyId("ScrollbarWidth"):
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColor"):
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
 
-            // Recalculate the text size with the new font
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+            case getPropertyId("SelectedBackgroundColorHover"):
             {
-                m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
+                    item.text.setOpacity(m_opacityCached);
+                break;
             }
 
-            updateItemPositions();
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& item : m_items)
+                    item.text.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.text.setCharacterSize(m_textSizeCached);
+                }
+
+                updateItemPositions();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rendererPropertiesChanged(const std::vector<String>& properties)
+    {
+        const auto finishPostponedColorUpdate = [this]{
+            m_itemColorsUpdatePostponed = false;
+            if (m_itemColorsUpdatePending)
+            {
+                m_itemColorsUpdatePending = false;
+                updateItemColorsAndStyle();
+            }
+        };
+
+        m_itemColorsUpdatePostponed = true;
+        try
+        {
+            Widget::rendererPropertiesChanged(properties);
+        }
+        catch (const Exception&)
+        {
+            finishPostponedColorUpdate();
+            throw;
+        }
+
+        finishPostponedColorUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -967,7 +1036,7 @@ namespace tgui
 
         if (node->propertyValuePairs["TextAlignment"])
         {
-            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["TextAlignment"]->value).getString();
+            String alignment = Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["TextAlignment"]).getString();
             if (alignment == "Right")
                 setTextAlignment(TextAlignment::Right);
             else if (alignment == "Center")
@@ -977,13 +1046,13 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["AutoScroll"])
-            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoScroll"]->value).getBool());
+            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["AutoScroll"]).getBool());
         if (node->propertyValuePairs["ItemHeight"])
-            setItemHeight(node->propertyValuePairs["ItemHeight"]->value.toInt());
+            setItemHeight(node->propertyValuePairs["ItemHeight"]->getValue().toInt());
         if (node->propertyValuePairs["MaximumItems"])
-            setMaximumItems(node->propertyValuePairs["MaximumItems"]->value.toInt());
+            setMaximumItems(node->propertyValuePairs["MaximumItems"]->getValue().toInt());
         if (node->propertyValuePairs["SelectedItemIndex"])
-            setSelectedItemByIndex(node->propertyValuePairs["SelectedItemIndex"]->value.toInt());
+            setSelectedItemByIndex(node->propertyValuePairs["SelectedItemIndex"]->getValue().toInt());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1030,6 +1099,12 @@ namespace tgui
 
     void ListBox::updateItemColorsAndStyle()
     {
+        if (m_itemColorsUpdatePostponed)
+        {
+            m_itemColorsUpdatePending = true;
+            return;
+        }
+
         for (auto& item : m_items)
         {
             item.text.setColor(m_textColorCached);
@@ -1114,6 +1189,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> ListBox::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -1303,6 +1303,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
             }
         }
 
@@ -1548,145 +1549,215 @@ namespace tgui
 
     void ListView::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColors();
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            if (!m_headerTextColorCached.isSet())
-                updateHeaderTextsColor();
-        }
-        else if (property == "TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColors();
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColors();
-        }
-        else if (property == "SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColors();
-        }
-        else if (property == "Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("TextColor"):
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColors();
+
+                if (!m_headerTextColorCached.isSet())
+                    updateHeaderTextsColor();
+                break;
+            }
+
+            case getPropertyId("TextColorHover"):
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColors();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColors();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColorHover"):
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColors();
+                break;
             }
-        }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == "GridLinesColor")
-        {
-            m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
-        }
-        else if (property == "HeaderTextColor")
-        {
-            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
-            updateHeaderTextsColor();
-        }
-        else if (property == "HeaderBackgroundColor")
-        {
-            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+            case getPropertyId("Scrollbar"):
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            for (auto& column : m_columns)
-                column.text.setOpacity(m_opacityCached);
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    updateSizeAfterRendererChange();
+                }
+                break;
+            }
 
-            for (auto& item : m_items)
+            case getPropertyId("ScrollbarWidth"):
             {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-                item.icon.setOpacity(m_opacityCached);
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("SeparatorColor"):
+            {
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
             }
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
 
-            for (auto& column : m_columns)
-                column.text.setFont(m_fontCached);
+            case getPropertyId("GridLinesColor"):
+            {
+                m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
+                break;
+            }
 
-            for (auto& item : m_items)
+            case getPropertyId("HeaderTextColor"):
             {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
+                m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+                updateHeaderTextsColor();
+                break;
             }
 
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+            case getPropertyId("HeaderBackgroundColor"):
             {
-                // Recalculate the text size with the new font
-                updateTextSize();
+                m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+                break;
             }
-            else
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColor"):
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColorHover"):
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& column : m_columns)
+                    column.text.setOpacity(m_opacityCached);
+
+                for (auto& item : m_items)
+                {
+                    for (auto& text : item.texts)
+                        text.setOpacity(m_opacityCached);
+
+                    item.icon.setOpacity(m_opacityCached);
+                }
+                break;
+            }
+
+            case getPropertyId("Font"):
             {
-                // Recalculate the width of the columns if they depended on the header text
+                Widget::rendererChanged(property);
+
                 for (auto& column : m_columns)
+                    column.text.setFont(m_fontCached);
+
+                for (auto& item : m_items)
                 {
-                    if (column.designWidth == 0)
-                        column.width = calculateAutoColumnWidth(column.text);
+                    for (auto& text : item.texts)
+                        text.setFont(m_fontCached);
                 }
-                updateHorizontalScrollbarMaximum();
+
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    // Recalculate the text size with the new font
+                    updateTextSize();
+                }
+                else
+                {
+                    // Recalculate the width of the columns if they depended on the header text
+                    for (auto& column : m_columns)
+                    {
+                        if (column.designWidth == 0)
+                            column.width = calculateAutoColumnWidth(column.text);
+                    }
+                    updateHorizontalScrollbarMaximum();
+                }
+                break;
             }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::rendererPropertiesChanged(const std::vector<String>& properties)
+    {
+        const auto finishPostponedColorUpdate = [this]{
+            m_itemColorsUpdatePostponed = false;
+            if (m_itemColorsUpdatePending)
+            {
+                m_itemColorsUpdatePending = false;
+                updateItemColors();
+            }
+        };
+
+        m_itemColorsUpdatePostponed = true;
+        try
+        {
+            Widget::rendererPropertiesChanged(properties);
+        }
+        catch (const Exception&)
+        {
+            finishPostponedColorUpdate();
+            throw;
+        }
+
+        finishPostponedColorUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1808,13 +1879,13 @@ namespace tgui
             ColumnAlignment alignment = ColumnAlignment::Left;
 
             if (childNode->propertyValuePairs["Text"])
-                text = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Text"]->value).getString();
+                text = Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Text"]).getString();
             if (childNode->propertyValuePairs["Width"])
-                width = Deserializer::deserialize(ObjectConverter::Type::Number, childNode->propertyValuePairs["Width"]->value).getNumber();
+                width = Deserializer::deserialize(ObjectConverter::Type::Number, *childNode->propertyValuePairs["Width"]).getNumber();
 
             if (childNode->propertyValuePairs["Alignment"])
             {
-                String alignmentString = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Alignment"]->value).getString();
+                String alignmentString = Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Alignment"]).getString();
                 if (alignmentString == "Right")
                     alignment = ColumnAlignment::Right;
                 else if (alignmentString == "Center")
@@ -1844,28 +1915,28 @@ namespace tgui
             const std::size_t index = addItem(itemRow);
 
             if (childNode->propertyValuePairs["Icon"])
-                setItemIcon(index, Deserializer::deserialize(ObjectConverter::Type::Texture, childNode->propertyValuePairs["Icon"]->value).getTexture());
+                setItemIcon(index, Deserializer::deserialize(ObjectConverter::Type::Texture, *childNode->propertyValuePairs["Icon"]).getTexture());
         }
 
         if (node->propertyValuePairs["AutoScroll"])
-            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoScroll"]->value).getBool());
+            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["AutoScroll"]).getBool());
         if (node->propertyValuePairs["HeaderVisible"])
-            setHeaderVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["HeaderVisible"]->value).getBool());
+            setHeaderVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["HeaderVisible"]).getBool());
         if (node->propertyValuePairs["HeaderHeight"])
-            setHeaderHeight(node->propertyValuePairs["HeaderHeight"]->value.toFloat());
+            setHeaderHeight(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["HeaderHeight"]).getNumber());
         if (node->propertyValuePairs["HeaderTextSize"])
-            setHeaderTextSize(node->propertyValuePairs["HeaderTextSize"]->value.toInt());
+            setHeaderTextSize(node->propertyValuePairs["HeaderTextSize"]->getValue().toInt());
         if (node->propertyValuePairs["SeparatorWidth"])
-            setSeparatorWidth(node->propertyValuePairs["SeparatorWidth"]->value.toInt());
+            setSeparatorWidth(node->propertyValuePairs["SeparatorWidth"]->getValue().toInt());
         if (node->propertyValuePairs["HeaderSeparatorHeight"])
-            setHeaderSeparatorHeight(node->propertyValuePairs["HeaderSeparatorHeight"]->value.toInt());
+            setHeaderSeparatorHeight(node->propertyValuePairs["HeaderSeparatorHeight"]->getValue().toInt());
         if (node->propertyValuePairs["ItemHeight"])
-            setItemHeight(node->propertyValuePairs["ItemHeight"]->value.toInt());
+            setItemHeight(node->propertyValuePairs["ItemHeight"]->getValue().toInt());
         if (node->propertyValuePairs["MultiSelect"])
-            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["MultiSelect"]->value).getBool());
+            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["MultiSelect"]).getBool());
 
         if (node->propertyValuePairs["FixedIconSize"])
-            setFixedIconSize(Vector2f(node->propertyValuePairs["FixedIconSize"]->value));
+            setFixedIconSize(Vector2f(node->propertyValuePairs["FixedIconSize"]->getValue()));
 
         if (node->propertyValuePairs["SelectedItemIndices"])
         {
@@ -1876,17 +1947,17 @@ namespace tgui
                 addSelectedItem(item.toInt());
         }
         if (node->propertyValuePairs["GridLinesWidth"])
-            setGridLinesWidth(node->propertyValuePairs["GridLinesWidth"]->value.toInt());
+            setGridLinesWidth(node->propertyValuePairs["GridLinesWidth"]->getValue().toInt());
         if (node->propertyValuePairs["ShowHorizontalGridLines"])
-            setShowHorizontalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ShowHorizontalGridLines"]->value).getBool());
+            setShowHorizontalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ShowHorizontalGridLines"]).getBool());
         if (node->propertyValuePairs["ShowVerticalGridLines"])
-            setShowVerticalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ShowVerticalGridLines"]->value).getBool());
+            setShowVerticalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ShowVerticalGridLines"]).getBool());
         if (node->propertyValuePairs["ExpandLastColumn"])
-            setExpandLastColumn(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ExpandLastColumn"]->value).getBool());
+            setExpandLastColumn(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ExpandLastColumn"]).getBool());
 
         if (node->propertyValuePairs["VerticalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setVerticalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -1899,7 +1970,7 @@ namespace tgui
 
         if (node->propertyValuePairs["HorizontalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setHorizontalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -1988,6 +2059,12 @@ namespace tgui
 
     void ListView::updateItemColors()
     {
+        if (m_itemColorsUpdatePostponed)
+        {
+            m_itemColorsUpdatePending = true;
+            return;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
             setItemColor(i, m_textColorCached);
 
@@ -2534,6 +2611,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> ListView::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -742,74 +742,109 @@ namespace tgui
 
     void MenuBar::rendererChanged(const String& property)
     {
-        if (property == "TextColor")
+        switch (getPropertyId(property))
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "TextureItemBackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == "TextureSelectedItemBackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == "SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == "SeparatorThickness")
-        {
-            m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
-        }
-        else if (property == "SeparatorVerticalPadding")
-        {
-            m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
-        }
-        else if (property == "SeparatorSidePadding")
-        {
-            m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+
+            case getPropertyId("TextColorDisabled"):
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("TextureItemBackground"):
+            {
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
+            }
+
+            case getPropertyId("TextureSelectedItemBackground"):
+            {
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColor"):
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("DistanceToSide"):
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+            }
+
+            case getPropertyId("SeparatorColor"):
+            {
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
+            }
+
+            case getPropertyId("SeparatorThickness"):
+            {
+                m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
+                break;
+            }
+
+            case getPropertyId("SeparatorVerticalPadding"):
+            {
+                m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
+                break;
+            }
+
+            case getPropertyId("SeparatorSidePadding"):
+            {
+                m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+                updateTextFont(m_menus);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -834,9 +869,9 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["MinimumSubMenuWidth"])
-            setMinimumSubMenuWidth(node->propertyValuePairs["MinimumSubMenuWidth"]->value.toFloat());
+            setMinimumSubMenuWidth(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["MinimumSubMenuWidth"]).getNumber());
         if (node->propertyValuePairs["InvertedMenuDirection"])
-            setInvertedMenuDirection(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Bool, node->propertyValuePairs["InvertedMenuDirection"]->value).getBool());
+            setInvertedMenuDirection(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Bool, *node->propertyValuePairs["InvertedMenuDirection"]).getBool());
 
         loadMenus(node, m_menus);
 
@@ -984,11 +1019,11 @@ namespace tgui
             if (!childNode->propertyValuePairs["Text"])
                 throw Exception{"Failed to parse 'Menu' property, expected a nested 'Text' propery"};
 
-            const String menuText = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Text"]->value).getString();
+            const String menuText = Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Text"]).getString();
             createMenu(menus, menuText);
 
             if (childNode->propertyValuePairs["Enabled"])
-                menus.back().enabled = Deserializer::deserialize(ObjectConverter::Type::Bool, childNode->propertyValuePairs["Enabled"]->value).getBool();
+                menus.back().enabled = Deserializer::deserialize(ObjectConverter::Type::Bool, *childNode->propertyValuePairs["Enabled"]).getBool();
 
             // Recursively handle the menu nodes
             if (!childNode->children.empty())
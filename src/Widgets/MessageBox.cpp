@@ -290,29 +290,39 @@ namespace tgui
 
     void MessageBox::rendererChanged(const String& property)
     {
-        if (property == "TextColor")
+        switch (getPropertyId(property))
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == "Font")
-        {
-            ChildWindow::rendererChanged(property);
+            case getPropertyId("TextColor"):
+            {
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
+            }
 
-            m_label->setInheritedFont(m_fontCached);
+            case getPropertyId("Button"):
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                ChildWindow::rendererChanged(property);
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+                m_label->setInheritedFont(m_fontCached);
 
-            rearrange();
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
+
+                rearrange();
+                break;
+            }
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,6 +377,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MessageBox::canLoadWidgetsLazily() const
+    {
+        // The label and buttons are looked up in the child widgets while loading
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
             }
         }
     }
@@ -221,35 +222,51 @@ namespace tgui
 
     void Panel::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-        else if (property == "RoundedBorderRadius")
-        {
-            m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Container::rendererChanged(property);
-            m_spriteBackground.setOpacity(m_opacityCached);
+            case getPropertyId("RoundedBorderRadius"):
+            {
+                m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Container::rendererChanged(property);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +286,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Panel::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Panel::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
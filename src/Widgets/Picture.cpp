@@ -107,6 +107,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Picture::loadTextureAsync(const String& id, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        const unsigned int request = ++m_asyncTextureRequest;
+        const std::weak_ptr<Picture> weakPicture = std::static_pointer_cast<Picture>(shared_from_this());
+        Texture::loadAsync(id, [weakPicture,request](const Texture& texture){
+            // Ignore the texture when the picture no longer exists or when another texture was requested in the meantime
+            const auto picture = weakPicture.lock();
+            if (!picture || (picture->m_asyncTextureRequest != request))
+                return;
+
+            if (texture.getData())
+                picture->getRenderer()->setTexture(texture);
+
+            picture->onTextureLoad.emit(picture.get(), texture.getData() != nullptr);
+        }, partRect, middleRect, smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::ignoreMouseEvents(bool ignore)
     {
         m_ignoringMouseEvents = ignore;
@@ -162,6 +181,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
             }
         }
     }
@@ -172,6 +192,8 @@ namespace tgui
     {
         if (signalName == onDoubleClick.getName())
             return onDoubleClick;
+        else if (signalName == onTextureLoad.getName())
+            return onTextureLoad;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -180,22 +202,31 @@ namespace tgui
 
     void Picture::rendererChanged(const String& property)
     {
-        if (property == "Texture")
+        switch (getPropertyId(property))
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            case getPropertyId("Texture"):
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
-                setSize(Vector2f{texture.getImageSize()});
+                if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
+                    setSize(Vector2f{texture.getImageSize()});
 
-            m_sprite.setTexture(texture);
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -217,7 +248,7 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["IgnoreMouseEvents"])
-            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["IgnoreMouseEvents"]->value).getBool());
+            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["IgnoreMouseEvents"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -237,6 +268,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Picture::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(BackendRenderTarget& target, RenderStates states) const
     {
         target.drawSprite(states, m_sprite);
@@ -266,66 +266,92 @@ namespace tgui
 
     void ProgressBar::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if ((property == "TextColor") || (property == "TextColorFilled"))
-        {
-            m_textBack.setColor(getSharedRenderer()->getTextColor());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            if (getSharedRenderer()->getTextColorFilled().isSet())
-                m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
-            else
-                m_textFront.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "TextureFill")
-        {
-            m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
-            recalculateFillSize();
-        }
-        else if (property == "TextStyle")
-        {
-            m_textBack.setStyle(getSharedRenderer()->getTextStyle());
-            m_textFront.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "FillColor")
-        {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextColor"):
+            case getPropertyId("TextColorFilled"):
+            {
+                m_textBack.setColor(getSharedRenderer()->getTextColor());
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteFill.setOpacity(m_opacityCached);
+                if (getSharedRenderer()->getTextColorFilled().isSet())
+                    m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
+                else
+                    m_textFront.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
 
-            m_textBack.setOpacity(m_opacityCached);
-            m_textFront.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("TextureFill"):
+            {
+                m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
+                recalculateFillSize();
+                break;
+            }
+
+            case getPropertyId("TextStyle"):
+            {
+                m_textBack.setStyle(getSharedRenderer()->getTextStyle());
+                m_textFront.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
 
-            m_textBack.setFont(m_fontCached);
-            m_textFront.setFont(m_fontCached);
-            updateTextSize();
+            case getPropertyId("FillColor"):
+            {
+                m_fillColorCached = getSharedRenderer()->getFillColor();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteFill.setOpacity(m_opacityCached);
+
+                m_textBack.setOpacity(m_opacityCached);
+                m_textFront.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                m_textBack.setFont(m_fontCached);
+                m_textFront.setFont(m_fontCached);
+                updateTextSize();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,17 +387,17 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Minimum"])
-            setMinimum(node->propertyValuePairs["Minimum"]->value.toInt());
+            setMinimum(node->propertyValuePairs["Minimum"]->getValue().toInt());
         if (node->propertyValuePairs["Maximum"])
-            setMaximum(node->propertyValuePairs["Maximum"]->value.toInt());
+            setMaximum(node->propertyValuePairs["Maximum"]->getValue().toInt());
         if (node->propertyValuePairs["Value"])
-            setValue(node->propertyValuePairs["Value"]->value.toInt());
+            setValue(node->propertyValuePairs["Value"]->getValue().toInt());
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
 
         if (node->propertyValuePairs["FillDirection"])
         {
-            String direction = node->propertyValuePairs["FillDirection"]->value.trim();
+            String direction = node->propertyValuePairs["FillDirection"]->getValue().trim();
             if (direction == "LeftToRight")
                 setFillDirection(ProgressBar::FillDirection::LeftToRight);
             else if (direction == "RightToLeft")
@@ -164,7 +164,9 @@ namespace tgui
 
     void RadioButton::setText(const String& text)
     {
+        const FloatRect oldHitBounds = getHitBounds();
         m_text.setString(text);
+        hitBoundsChanged(oldHitBounds);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,7 +180,9 @@ namespace tgui
 
     void RadioButton::setTextClickable(bool acceptTextClick)
     {
+        const FloatRect oldHitBounds = getHitBounds();
         m_allowTextClick = acceptTextClick;
+        hitBoundsChanged(oldHitBounds);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,10 +196,22 @@ namespace tgui
 
     void RadioButton::updateTextSize()
     {
+        const FloatRect oldHitBounds = getHitBounds();
+
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, getSize().y * 0.8f);
 
         m_text.setCharacterSize(m_textSizeCached);
+        hitBoundsChanged(oldHitBounds);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::hitBoundsChanged(const FloatRect& oldHitBounds)
+    {
+        // The parent has to be informed when the clickable text area changes, as it won't change the size of the widget
+        if (m_parent && (getHitBounds() != oldHitBounds))
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +247,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect RadioButton::getHitBounds() const
+    {
+        if (m_allowTextClick && !getText().empty())
+            return Widget::getHitBounds();
+        else
+            return {{0, 0}, getSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::leftMouseReleased(Vector2f pos)
     {
         const bool mouseDown = m_mouseDown;
@@ -284,165 +310,238 @@ namespace tgui
 
     void RadioButton::rendererChanged(const String& property)
     {
-        if (property == "Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == "TextColor") || (property == "TextColorHover") || (property == "TextColorDisabled")
-              || (property == "TextColorChecked") || (property == "TextColorCheckedHover") || (property == "TextColorCheckedDisabled"))
-        {
-            updateTextColor();
-        }
-        else if (property == "TextStyle")
+        switch (getPropertyId(property))
         {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateTextureSizes();
+                break;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "TextStyleChecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+            case getPropertyId("TextColor"):
+            case getPropertyId("TextColorHover"):
+            case getPropertyId("TextColorDisabled"):
+            case getPropertyId("TextColorChecked"):
+            case getPropertyId("TextColorCheckedHover"):
+            case getPropertyId("TextColorCheckedDisabled"):
+            {
+                updateTextColor();
+                break;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "TextureUnchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == "TextureChecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == "TextureUncheckedHover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == "TextureCheckedHover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == "TextureUncheckedDisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == "TextureCheckedDisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == "TextureUncheckedFocused")
-        {
-            m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
-        }
-        else if (property == "TextureCheckedFocused")
-        {
-            m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
-        }
-        else if (property == "CheckColor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == "CheckColorHover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == "CheckColorDisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "BorderColorChecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == "BorderColorCheckedHover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == "BorderColorCheckedDisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == "BorderColorCheckedFocused")
-        {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "BackgroundColorChecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == "BackgroundColorCheckedHover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == "BackgroundColorCheckedDisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == "TextDistanceRatio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteUncheckedFocused.setOpacity(m_opacityCached);
-            m_spriteCheckedFocused.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextStyle"):
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
+
+            case getPropertyId("TextStyleChecked"):
+            {
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
+
+            case getPropertyId("TextureUnchecked"):
+            {
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateTextureSizes();
+                break;
+            }
+
+            case getPropertyId("TextureChecked"):
+            {
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateTextureSizes();
+                break;
+            }
+
+            case getPropertyId("TextureUncheckedHover"):
+            {
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                break;
+            }
+
+            case getPropertyId("TextureCheckedHover"):
+            {
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                break;
+            }
+
+            case getPropertyId("TextureUncheckedDisabled"):
+            {
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                break;
+            }
+
+            case getPropertyId("TextureCheckedDisabled"):
+            {
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                break;
+            }
+
+            case getPropertyId("TextureUncheckedFocused"):
+            {
+                m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
+                break;
+            }
+
+            case getPropertyId("TextureCheckedFocused"):
+            {
+                m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
+                break;
+            }
+
+            case getPropertyId("CheckColor"):
+            {
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                break;
+            }
+
+            case getPropertyId("CheckColorHover"):
+            {
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                break;
+            }
+
+            case getPropertyId("CheckColorDisabled"):
+            {
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BorderColorHover"):
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case getPropertyId("BorderColorDisabled"):
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
 
-            m_text.setFont(m_fontCached);
-            updateTextSize();
+            case getPropertyId("BorderColorFocused"):
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+
+            case getPropertyId("BorderColorChecked"):
+            {
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                break;
+            }
+
+            case getPropertyId("BorderColorCheckedHover"):
+            {
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                break;
+            }
+
+            case getPropertyId("BorderColorCheckedDisabled"):
+            {
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                break;
+            }
+
+            case getPropertyId("BorderColorCheckedFocused"):
+            {
+                m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorDisabled"):
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorChecked"):
+            {
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorCheckedHover"):
+            {
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorCheckedDisabled"):
+            {
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                break;
+            }
+
+            case getPropertyId("TextDistanceRatio"):
+            {
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteUncheckedFocused.setOpacity(m_opacityCached);
+                m_spriteCheckedFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                updateTextSize();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -468,11 +567,11 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
         if (node->propertyValuePairs["TextClickable"])
-            setTextClickable(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["TextClickable"]->value).getBool());
+            setTextClickable(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["TextClickable"]).getBool());
         if (node->propertyValuePairs["Checked"])
-            setChecked(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["Checked"]->value).getBool());
+            setChecked(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["Checked"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
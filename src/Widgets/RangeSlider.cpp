@@ -526,91 +526,128 @@ namespace tgui
 
     void RangeSlider::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "TextureTrack")
-        {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_verticalImage = true;
-            else
-                m_verticalImage = false;
+            case getPropertyId("TextureTrack"):
+            {
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == "TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == "TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-            setSize(m_size);
-        }
-        else if (property == "TextureSelectedTrack")
-        {
-            m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
-            setSize(m_size);
-        }
-        else if (property == "TextureSelectedTrackHover")
-        {
-            m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
-            setSize(m_size);
-        }
-        else if (property == "TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "SelectedTrackColor")
-        {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
-        }
-        else if (property == "SelectedTrackColorHover")
-        {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
-        }
-        else if (property == "ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTrack.setOpacity(m_opacityCached);
-            m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_verticalImage = true;
+                else
+                    m_verticalImage = false;
+
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureTrackHover"):
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+
+            case getPropertyId("TextureThumb"):
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureThumbHover"):
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureSelectedTrack"):
+            {
+                m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureSelectedTrackHover"):
+            {
+                m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TrackColor"):
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+
+            case getPropertyId("TrackColorHover"):
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+
+            case getPropertyId("SelectedTrackColor"):
+            {
+                m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+                break;
+            }
+
+            case getPropertyId("SelectedTrackColorHover"):
+            {
+                m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+                break;
+            }
+
+            case getPropertyId("ThumbColor"):
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case getPropertyId("ThumbColorHover"):
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BorderColorHover"):
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTrack.setOpacity(m_opacityCached);
+                m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -635,15 +672,15 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Minimum"])
-            setMinimum(node->propertyValuePairs["Minimum"]->value.toFloat());
+            setMinimum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Minimum"]).getNumber());
         if (node->propertyValuePairs["Maximum"])
-            setMaximum(node->propertyValuePairs["Maximum"]->value.toFloat());
+            setMaximum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Maximum"]).getNumber());
         if (node->propertyValuePairs["SelectionStart"])
-            setSelectionStart(node->propertyValuePairs["SelectionStart"]->value.toFloat());
+            setSelectionStart(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["SelectionStart"]).getNumber());
         if (node->propertyValuePairs["SelectionEnd"])
-            setSelectionEnd(node->propertyValuePairs["SelectionEnd"]->value.toFloat());
+            setSelectionEnd(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["SelectionEnd"]).getNumber());
         if (node->propertyValuePairs["Step"])
-            setStep(node->propertyValuePairs["Step"]->value.toFloat());
+            setStep(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Step"]).getNumber());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -666,29 +666,37 @@ namespace tgui
 
     void ScrollablePanel::rendererChanged(const String& property)
     {
-        if (property == "Scrollbar")
+        switch (getPropertyId(property))
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Scrollbar"):
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    updateScrollbars();
+                }
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("ScrollbarWidth"):
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 updateScrollbars();
+                break;
             }
+
+            default:
+                Panel::rendererChanged(property);
+                break;
         }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            updateScrollbars();
-        }
-        else
-            Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -723,11 +731,11 @@ namespace tgui
         Panel::load(node, renderers);
 
         if (node->propertyValuePairs["ContentSize"])
-            setContentSize(Vector2f{node->propertyValuePairs["ContentSize"]->value});
+            setContentSize(Vector2f{node->propertyValuePairs["ContentSize"]->getValue()});
 
         if (node->propertyValuePairs["VerticalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setVerticalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -740,7 +748,7 @@ namespace tgui
 
         if (node->propertyValuePairs["HorizontalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setHorizontalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -779,99 +779,138 @@ namespace tgui
 
     void Scrollbar::rendererChanged(const String& property)
     {
-        if (property == "TextureTrack")
+        switch (getPropertyId(property))
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            if (m_sizeSet)
-                updateSize();
-            else
+            case getPropertyId("TextureTrack"):
             {
-                if (m_verticalScroll)
-                    setSize({getDefaultWidth(), getSize().y});
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                if (m_sizeSet)
+                    updateSize();
                 else
-                    setSize({getSize().x, getDefaultWidth()});
+                {
+                    if (m_verticalScroll)
+                        setSize({getDefaultWidth(), getSize().y});
+                    else
+                        setSize({getSize().x, getDefaultWidth()});
 
-                m_sizeSet = false;
+                    m_sizeSet = false;
+                }
+                break;
             }
+
+            case getPropertyId("TextureTrackHover"):
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+
+            case getPropertyId("TextureThumb"):
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateSize();
+                break;
+            }
+
+            case getPropertyId("TextureThumbHover"):
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+            }
+
+            case getPropertyId("TextureArrowUp"):
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                updateSize();
+                break;
+            }
+
+            case getPropertyId("TextureArrowUpHover"):
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+            }
+
+            case getPropertyId("TextureArrowDown"):
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                updateSize();
+                break;
+            }
+
+            case getPropertyId("TextureArrowDownHover"):
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+            }
+
+            case getPropertyId("TrackColor"):
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+
+            case getPropertyId("TrackColorHover"):
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+
+            case getPropertyId("ThumbColor"):
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case getPropertyId("ThumbColorHover"):
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+
+            case getPropertyId("ArrowBackgroundColor"):
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("ArrowBackgroundColorHover"):
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("ArrowColor"):
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+
+            case getPropertyId("ArrowColorHover"):
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == "TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            updateSize();
-        }
-        else if (property == "TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "TextureArrowUp")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            updateSize();
-        }
-        else if (property == "TextureArrowUpHover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "TextureArrowDown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            updateSize();
-        }
-        else if (property == "TextureArrowDownHover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -896,15 +935,15 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["ViewportSize"])
-            setViewportSize(node->propertyValuePairs["ViewportSize"]->value.toInt());
+            setViewportSize(node->propertyValuePairs["ViewportSize"]->getValue().toInt());
         if (node->propertyValuePairs["Maximum"])
-            setMaximum(node->propertyValuePairs["Maximum"]->value.toInt());
+            setMaximum(node->propertyValuePairs["Maximum"]->getValue().toInt());
         if (node->propertyValuePairs["Value"])
-            setValue(node->propertyValuePairs["Value"]->value.toInt());
+            setValue(node->propertyValuePairs["Value"]->getValue().toInt());
         if (node->propertyValuePairs["ScrollAmount"])
-            setScrollAmount(node->propertyValuePairs["ScrollAmount"]->value.toInt());
+            setScrollAmount(node->propertyValuePairs["ScrollAmount"]->getValue().toInt());
         if (node->propertyValuePairs["AutoHide"])
-            setAutoHide(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoHide"]->value).getBool());
+            setAutoHide(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["AutoHide"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,8 +92,12 @@ namespace tgui
 
     void SeparatorLine::rendererChanged(const String& property)
     {
-        if (property == "Color")
-            m_colorCached = getSharedRenderer()->getColor();
+        switch (getPropertyId(property))
+        {
+            case getPropertyId("Color"):
+                m_colorCached = getSharedRenderer()->getColor();
+                break;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
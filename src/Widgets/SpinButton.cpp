@@ -317,63 +317,92 @@ namespace tgui
 
     void SpinButton::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "BorderBetweenArrows")
-        {
-            m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
-        }
-        else if (property == "TextureArrowUp")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-        }
-        else if (property == "TextureArrowUpHover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "TextureArrowDown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-        }
-        else if (property == "TextureArrowDownHover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BorderBetweenArrows"):
+            {
+                m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("TextureArrowUp"):
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                break;
+            }
 
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
+            case getPropertyId("TextureArrowUpHover"):
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+            }
+
+            case getPropertyId("TextureArrowDown"):
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                break;
+            }
+
+            case getPropertyId("TextureArrowDownHover"):
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("ArrowColor"):
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+
+            case getPropertyId("ArrowColorHover"):
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -395,13 +424,13 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Minimum"])
-            setMinimum(node->propertyValuePairs["Minimum"]->value.toFloat());
+            setMinimum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Minimum"]).getNumber());
         if (node->propertyValuePairs["Maximum"])
-            setMaximum(node->propertyValuePairs["Maximum"]->value.toFloat());
+            setMaximum(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Maximum"]).getNumber());
         if (node->propertyValuePairs["Value"])
-            setValue(node->propertyValuePairs["Value"]->value.toFloat());
+            setValue(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Value"]).getNumber());
         if (node->propertyValuePairs["Step"])
-            setStep(node->propertyValuePairs["Step"]->value.toFloat());
+            setStep(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["Step"]).getNumber());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
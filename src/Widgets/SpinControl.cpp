@@ -236,7 +236,7 @@ namespace tgui
         SubwidgetContainer::load(node, renderers);
 
         if (node->propertyValuePairs["DecimalPlaces"])
-            setDecimalPlaces(node->propertyValuePairs["DecimalPlaces"]->value.toUInt());
+            setDecimalPlaces(node->propertyValuePairs["DecimalPlaces"]->getValue().toUInt());
 
         m_spinText = m_container->get<tgui::EditBox>("SpinText");
         m_spinButton = m_container->get<tgui::SpinButton>("SpinButton");
@@ -548,125 +548,176 @@ namespace tgui
 
     void Tabs::rendererChanged(const String& property)
     {
-        if (property == "Borders")
+        switch (getPropertyId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == "TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors();
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == "SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "TextureTab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == "TextureTabHover")
-        {
-            m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
-        }
-        else if (property == "TextureSelectedTab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == "TextureSelectedTabHover")
-        {
-            m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
-        }
-        else if (property == "TextureDisabledTab")
-        {
-            m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
-        }
-        else if (property == "DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "SelectedBorderColor")
-        {
-            m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
-        }
-        else if (property == "SelectedBorderColorHover")
-        {
-            m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                recalculateTabsWidth();
+                break;
+            }
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteTabHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTabHover.setOpacity(m_opacityCached);
-            m_spriteDisabledTab.setOpacity(m_opacityCached);
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors();
+                break;
+            }
 
-            for (auto& tab : m_tabs)
-                tab.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextColorHover"):
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors();
+                break;
+            }
 
-            for (auto& tab : m_tabs)
-                tab.text.setFont(m_fontCached);
+            case getPropertyId("TextColorDisabled"):
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors();
+                break;
+            }
 
-            // Recalculate the size when the text is auto sizing
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-                updateTextSize();
-            else
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColorHover"):
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors();
+                break;
+            }
+
+            case getPropertyId("TextureTab"):
+            {
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                break;
+            }
+
+            case getPropertyId("TextureTabHover"):
+            {
+                m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
+                break;
+            }
+
+            case getPropertyId("TextureSelectedTab"):
+            {
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                break;
+            }
+
+            case getPropertyId("TextureSelectedTabHover"):
+            {
+                m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
+                break;
+            }
+
+            case getPropertyId("TextureDisabledTab"):
+            {
+                m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
+                break;
+            }
+
+            case getPropertyId("DistanceToSide"):
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
                 recalculateTabsWidth();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorDisabled"):
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColor"):
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColorHover"):
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("BorderColorHover"):
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case getPropertyId("SelectedBorderColor"):
+            {
+                m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
+                break;
+            }
+
+            case getPropertyId("SelectedBorderColorHover"):
+            {
+                m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteTabHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTabHover.setOpacity(m_opacityCached);
+                m_spriteDisabledTab.setOpacity(m_opacityCached);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setFont(m_fontCached);
+
+                // Recalculate the size when the text is auto sizing
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                    updateTextSize();
+                else
+                    recalculateTabsWidth();
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -758,11 +809,11 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["MaximumTabWidth"])
-            setMaximumTabWidth(node->propertyValuePairs["MaximumTabWidth"]->value.toFloat());
+            setMaximumTabWidth(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["MaximumTabWidth"]).getNumber());
         if (node->propertyValuePairs["TabHeight"])
-            setTabHeight(node->propertyValuePairs["TabHeight"]->value.toFloat());
+            setTabHeight(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["TabHeight"]).getNumber());
         if (node->propertyValuePairs["Selected"])
-            select(node->propertyValuePairs["Selected"]->value.toInt());
+            select(node->propertyValuePairs["Selected"]->getValue().toInt());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,6 +387,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            requestUpdateTime();
         }
         else // Unfocusing
         {
@@ -534,6 +535,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
             }
 
             // Update the texts
@@ -1580,6 +1582,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextArea::isUpdateTimeRequired() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> TextArea::getTimeUntilNextUpdate() const
+    {
+        if (!m_focused && !m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getEditCursorBlinkRate());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1727,103 +1746,138 @@ namespace tgui
 
     void TextArea::rendererChanged(const String& property)
     {
-        if (property == "Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
+        switch (getPropertyId(property))
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "TextColor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("Padding"):
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
             }
-        }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "CaretWidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
+            case getPropertyId("TextColor"):
+            {
+                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
+                m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            setTextSize(getTextSize());
+            case getPropertyId("DefaultTextColor"):
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+            }
+
+            case getPropertyId("TextureBackground"):
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case getPropertyId("Scrollbar"):
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    updateSizeAfterRendererChange();
+                }
+                break;
+            }
+
+            case getPropertyId("ScrollbarWidth"):
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("SelectedTextBackgroundColor"):
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BorderColor"):
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("CaretColor"):
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+
+            case getPropertyId("CaretWidth"):
+            {
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                break;
+            }
+
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection1.setOpacity(m_opacityCached);
+                m_textAfterSelection2.setOpacity(m_opacityCached);
+                m_textSelection1.setOpacity(m_opacityCached);
+                m_textSelection2.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection1.setFont(m_fontCached);
+                m_textSelection2.setFont(m_fontCached);
+                m_textAfterSelection1.setFont(m_fontCached);
+                m_textAfterSelection2.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1864,17 +1918,17 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["Text"])
-            setText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Text"]->value).getString());
+            setText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["Text"]).getString());
         if (node->propertyValuePairs["DefaultText"])
-            setDefaultText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["DefaultText"]->value).getString());
+            setDefaultText(Deserializer::deserialize(ObjectConverter::Type::String, *node->propertyValuePairs["DefaultText"]).getString());
         if (node->propertyValuePairs["MaximumCharacters"])
-            setMaximumCharacters(node->propertyValuePairs["MaximumCharacters"]->value.toInt());
+            setMaximumCharacters(node->propertyValuePairs["MaximumCharacters"]->getValue().toInt());
         if (node->propertyValuePairs["ReadOnly"])
-            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ReadOnly"]->value).getBool());
+            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ReadOnly"]).getBool());
 
         if (node->propertyValuePairs["VerticalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["VerticalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setVerticalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -1887,7 +1941,7 @@ namespace tgui
 
         if (node->propertyValuePairs["HorizontalScrollbarPolicy"])
         {
-            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->value.trim();
+            String policy = node->propertyValuePairs["HorizontalScrollbarPolicy"]->getValue().trim();
             if (policy == "Automatic")
                 setHorizontalScrollbarPolicy(Scrollbar::Policy::Automatic);
             else if (policy == "Always")
@@ -69,39 +69,95 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::shared_ptr<TreeView::Node> cloneNode(const std::shared_ptr<TreeView::Node>& oldNode, TreeView::Node* parent)
+        std::shared_ptr<TreeView::Node> cloneNode(const std::shared_ptr<TreeView::Node>& oldNode, TreeView::Node* parent,
+                                                  std::unordered_map<const TreeView::Node*, std::shared_ptr<TreeView::Node>>& clonedNodes)
         {
             auto newNode = std::make_shared<TreeView::Node>();
             newNode->text = oldNode->text;
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
+            newNode->lazyChildren = oldNode->lazyChildren;
             newNode->parent = parent;
 
             for (const auto& oldChild : oldNode->nodes)
-                newNode->nodes.push_back(cloneNode(oldChild, newNode.get()));
+            {
+                newNode->nodes.push_back(cloneNode(oldChild, newNode.get(), clonedNodes));
+                newNode->nodesByText.emplace(newNode->nodes.back()->text.getString(), newNode->nodes.back().get());
+            }
 
+            clonedNodes[oldNode.get()] = newNode;
             return newNode;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void cloneVisibleNodeList(const std::vector<std::shared_ptr<TreeView::Node>>& oldNodes,
-                                  std::vector<std::shared_ptr<TreeView::Node>>& newNodes,
-                                  const std::vector<std::shared_ptr<TreeView::Node>>& oldList,
-                                  std::vector<std::shared_ptr<TreeView::Node>>& newList)
+        bool isBranchNode(const TreeView::Node& node)
         {
-            TGUI_ASSERT(oldNodes.size() == newNodes.size(), "Nodes must have been allocated before calling cloneVisibleNodeList");
-            TGUI_ASSERT(oldList.size() == newList.size(), "Nodes must have been allocated before calling cloneVisibleNodeList");
+            return !node.nodes.empty() || node.lazyChildren;
+        }
 
-            for (unsigned int i = 0; i < oldNodes.size(); ++i)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isNodeVisible(const TreeView::Node& node)
+        {
+            const auto* parent = node.parent;
+            while (parent)
             {
-                for (unsigned int j = 0; j < oldList.size(); ++j)
-                {
-                    if (oldNodes[i] == oldList[j])
-                        newList[j] = newNodes[i];
-                }
+                if (!parent->expanded)
+                    return false;
 
-                cloneVisibleNodeList(oldNodes[i]->nodes, newNodes[i]->nodes, oldList, newList);
+                parent = parent->parent;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<String> getNodeHierarchy(const TreeView::Node* node)
+        {
+            std::vector<String> hierarchy;
+            while (node)
+            {
+                hierarchy.push_back(node->text.getString());
+                node = node->parent;
+            }
+
+            std::reverse(hierarchy.begin(), hierarchy.end());
+            return hierarchy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectVisibleNodes(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::vector<std::shared_ptr<TreeView::Node>>& visibleNodes)
+        {
+            for (const auto& node : nodes)
+            {
+                visibleNodes.push_back(node);
+                if (node->expanded && !node->nodes.empty())
+                    collectVisibleNodes(node->nodes, visibleNodes);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void eraseNode(std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::unordered_map<String, TreeView::Node*>& nodesByText,
+                       std::vector<std::shared_ptr<TreeView::Node>>::iterator nodeIt)
+        {
+            const TreeView::Node* node = nodeIt->get();
+            const String text = node->text.getString();
+            nodes.erase(nodeIt);
+
+            // If the lookup table pointed to the removed node then it has to point to the next node with the same text, if there is one
+            const auto lookupIt = nodesByText.find(text);
+            if ((lookupIt != nodesByText.end()) && (lookupIt->second == node))
+            {
+                const auto sameTextIt = std::find_if(nodes.begin(), nodes.end(),
+                    [&text](const std::shared_ptr<TreeView::Node>& sibling){ return sibling->text.getString() == text; });
+                if (sameTextIt != nodes.end())
+                    lookupIt->second = sameTextIt->get();
+                else
+                    nodesByText.erase(lookupIt);
             }
         }
 
@@ -111,6 +167,7 @@ namespace tgui
         {
             for (auto& node : nodes)
             {
+                // Lazy nodes without children are skipped, expanding them would require requesting their children
                 if (!node->nodes.empty())
                 {
                     node->expanded = expandNode;
@@ -121,38 +178,38 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<std::shared_ptr<TreeView::Node>>& nodes)
+        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex,
+                            std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::unordered_map<String, TreeView::Node*>& nodesByText)
         {
-            for (auto it = nodes.begin(); it != nodes.end(); ++it)
+            const auto lookupIt = nodesByText.find(hierarchy[parentIndex]);
+            if (lookupIt == nodesByText.end())
+                return false; // The hierarchy doesn't exist
+
+            auto* node = lookupIt->second;
+            const auto it = std::find_if(nodes.begin(), nodes.end(), [node](const std::shared_ptr<TreeView::Node>& child){ return child.get() == node; });
+            TGUI_ASSERT(it != nodes.end(), "Node in lookup table must exist in list of nodes");
+
+            if (parentIndex + 1 == hierarchy.size())
             {
-                if ((*it)->text.getString() != hierarchy[parentIndex])
-                    continue;
+                eraseNode(nodes, nodesByText, it);
+                return true;
+            }
+            else
+            {
+                // Return false if some menu in the hierarchy couldn't be found
+                if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, node->nodes, node->nodesByText))
+                    return false;
 
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    nodes.erase(it);
+                // If parents don't have to be removed as well then we are done
+                if (!removeParentsWhenEmpty)
                     return true;
-                }
-                else
-                {
-                    // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes))
-                        return false;
-
-                    // If parents don't have to be removed as well then we are done
-                    if (!removeParentsWhenEmpty)
-                        return true;
 
-                    // Also delete the parent if empty
-                    if ((*it)->nodes.empty())
-                        nodes.erase(it);
+                // Also delete the parent if empty
+                if (node->nodes.empty())
+                    eraseNode(nodes, nodesByText, it);
 
-                    return true;
-                }
+                return true;
             }
-
-            // The hierarchy doesn't exist
-            return false;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,19 +230,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        TreeView::Node* findNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, const std::vector<String>& hierarchy, unsigned int parentIndex)
+        TreeView::Node* findNode(const std::unordered_map<String, TreeView::Node*>& nodesByText, const std::vector<String>& hierarchy, unsigned int parentIndex)
         {
-            for (auto& node : nodes)
-            {
-                if (node->text.getString() != hierarchy[parentIndex])
-                    continue;
-                else if (parentIndex + 1 == hierarchy.size())
-                    return node.get();
-                else
-                    return findNode(node->nodes, hierarchy, parentIndex + 1);
-            }
-
-            return nullptr;
+            const auto it = nodesByText.find(hierarchy[parentIndex]);
+            if (it == nodesByText.end())
+                return nullptr;
+            else if (parentIndex + 1 == hierarchy.size())
+                return it->second;
+            else
+                return findNode(it->second->nodesByText, hierarchy, parentIndex + 1);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +316,7 @@ namespace tgui
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
         onRightClick                        {other.onRightClick},
+        onItemsRequested                    {other.onItemsRequested},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -288,11 +342,16 @@ namespace tgui
         m_backgroundColorHoverCached        {other.m_backgroundColorHoverCached},
         m_textStyleCached                   {other.m_textStyleCached}
     {
+        std::unordered_map<const Node*, std::shared_ptr<Node>> clonedNodes;
         for (const auto& node : other.m_nodes)
-            m_nodes.push_back(cloneNode(node, nullptr));
+        {
+            m_nodes.push_back(cloneNode(node, nullptr, clonedNodes));
+            m_nodesByText.emplace(m_nodes.back()->text.getString(), m_nodes.back().get());
+        }
 
-        m_visibleNodes.resize(other.m_visibleNodes.size(), nullptr);
-        cloneVisibleNodeList(other.m_nodes, m_nodes, other.m_visibleNodes, m_visibleNodes);
+        m_visibleNodes.reserve(other.m_visibleNodes.size());
+        for (const auto& visibleNode : other.m_visibleNodes)
+            m_visibleNodes.push_back(clonedNodes[visibleNode.get()]);
 
         TGUI_ASSERT(std::count(m_visibleNodes.begin(), m_visibleNodes.end(), nullptr) == 0, "Cloned nodes can't contain a nullptr");
     }
@@ -311,7 +370,9 @@ namespace tgui
             std::swap(onExpand,                             temp.onExpand);
             std::swap(onCollapse,                           temp.onCollapse);
             std::swap(onRightClick,                         temp.onRightClick);
+            std::swap(onItemsRequested,                     temp.onItemsRequested);
             std::swap(m_nodes,                              temp.m_nodes);
+            std::swap(m_nodesByText,                        temp.m_nodesByText);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
@@ -404,21 +465,54 @@ namespace tgui
 
     bool TreeView::addItem(const std::vector<String>& hierarchy, bool createParents)
     {
-        if (hierarchy.empty())
+        auto* node = addItemImpl(hierarchy, createParents);
+        if (!node)
             return false;
 
-        if (hierarchy.size() >= 2)
+        // The visible items only have to be updated when the new item can be seen
+        if (isNodeVisible(*node))
+            markNodesDirty();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::addItems(const std::vector<std::vector<String>>& hierarchies, bool createParents)
+    {
+        std::size_t itemsAdded = 0;
+        bool visibleItemAdded = false;
+        for (const auto& hierarchy : hierarchies)
         {
-            auto* node = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
+            auto* node = addItemImpl(hierarchy, createParents);
             if (!node)
-                return false;
+                continue;
 
-            createNode(node->nodes, node, hierarchy.back());
+            ++itemsAdded;
+            if (!visibleItemAdded && isNodeVisible(*node))
+                visibleItemAdded = true;
         }
-        else // Root node
-            createNode(m_nodes, nullptr, hierarchy.back());
 
-        markNodesDirty();
+        if (visibleItemAdded)
+            markNodesDirty();
+
+        return itemsAdded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::addLazyItem(const std::vector<String>& hierarchy, bool createParents)
+    {
+        auto* node = addItemImpl(hierarchy, createParents);
+        if (!node)
+            return false;
+
+        node->expanded = false;
+        node->lazyChildren = true;
+
+        if (isNodeVisible(*node))
+            markNodesDirty();
+
         return true;
     }
 
@@ -463,7 +557,7 @@ namespace tgui
                 return false;
         }
 
-        auto* node = findNode(m_nodes, hierarchy, 0);
+        auto* node = findNode(m_nodesByText, hierarchy, 0);
         if (!node)
             return false;
 
@@ -490,7 +584,10 @@ namespace tgui
 
     bool TreeView::removeItem(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty)
     {
-        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
+        if (hierarchy.empty())
+            return false;
+
+        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes, m_nodesByText);
         markNodesDirty();
         return ret;
     }
@@ -500,6 +597,7 @@ namespace tgui
     void TreeView::removeAllItems()
     {
         m_nodes.clear();
+        m_nodesByText.clear();
         markNodesDirty();
     }
 
@@ -529,24 +627,33 @@ namespace tgui
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        const auto node = m_visibleNodes[index];
+        if (!isBranchNode(*node))
             return;
 
-        std::vector<String> hierarchy;
-        auto* node = m_visibleNodes[index].get();
-        while (node)
+        if (!node->expanded && node->lazyChildren)
         {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
-            node = node->parent;
+            requestLazyChildren(node);
+
+            // The signal handler could have changed the visible items
+            if ((index >= m_visibleNodes.size()) || (m_visibleNodes[index] != node))
+            {
+                const auto it = std::find(m_visibleNodes.begin(), m_visibleNodes.end(), node);
+                if (it == m_visibleNodes.end())
+                    return;
+
+                index = static_cast<std::size_t>(it - m_visibleNodes.begin());
+            }
         }
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+        node->expanded = !node->expanded;
+        updateVisibleNodesAfterToggle(index);
+
+        const std::vector<String> hierarchy = getNodeHierarchy(node.get());
+        if (node->expanded)
             onExpand.emit(this, hierarchy.back(), hierarchy);
         else
             onCollapse.emit(this, hierarchy.back(), hierarchy);
-
-        markNodesDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -731,7 +838,7 @@ namespace tgui
                     toggleNodeInternal(selectedIndex);
 
                     // Send double click if this was a leaf node
-                    if (m_visibleNodes[selectedIndex]->nodes.empty())
+                    if ((selectedIndex < static_cast<int>(m_visibleNodes.size())) && !isBranchNode(*m_visibleNodes[selectedIndex]))
                     {
                         std::vector<String> hierarchy;
                         auto* node = m_visibleNodes[selectedIndex].get();
@@ -749,6 +856,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestUpdateTime();
                 m_doubleClickNodeIndex = selectedIndex;
             }
         }
@@ -899,7 +1007,7 @@ namespace tgui
             if (!m_visibleNodes[m_selectedItem]->nodes.empty() && m_visibleNodes[m_selectedItem]->expanded)
             {
                 m_visibleNodes[m_selectedItem]->expanded = false;
-                markNodesDirty();
+                updateVisibleNodesAfterToggle(static_cast<std::size_t>(m_selectedItem));
             }
             else if (m_visibleNodes[m_selectedItem]->parent)
             {
@@ -939,10 +1047,18 @@ namespace tgui
         {
             // If item is a collapsed node then expand it. Otherwise simply select the next item.
             TGUI_ASSERT(static_cast<unsigned int>(m_selectedItem) <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[m_selectedItem]->nodes.empty() && !m_visibleNodes[m_selectedItem]->expanded)
+            if (isBranchNode(*m_visibleNodes[m_selectedItem]) && !m_visibleNodes[m_selectedItem]->expanded)
             {
-                m_visibleNodes[m_selectedItem]->expanded = true;
-                markNodesDirty();
+                const auto node = m_visibleNodes[m_selectedItem];
+                if (node->lazyChildren)
+                {
+                    requestLazyChildren(node);
+                    if ((m_selectedItem < 0) || (m_visibleNodes[m_selectedItem] != node))
+                        return;
+                }
+
+                node->expanded = true;
+                updateVisibleNodesAfterToggle(static_cast<std::size_t>(m_selectedItem));
             }
             else if (static_cast<unsigned int>(m_selectedItem) + 1 < m_visibleNodes.size())
                 updateSelectedItem(m_selectedItem + 1);
@@ -963,6 +1079,8 @@ namespace tgui
             return onCollapse;
         else if (signalName == onRightClick.getName())
             return onRightClick;
+        else if (signalName == onItemsRequested.getName())
+            return onItemsRequested;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -971,119 +1089,160 @@ namespace tgui
 
     void TreeView::rendererChanged(const String& property)
     {
-        if (property == "Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "SelectedBackgroundColor")
+        switch (getPropertyId(property))
         {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "TextureBranchExpanded")
-        {
-            m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "TextureBranchCollapsed")
-        {
-            m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "TextureLeaf")
-        {
-            m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case getPropertyId("Borders"):
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("Padding"):
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateSizeAfterRendererChange();
+                break;
+            }
+
+            case getPropertyId("BackgroundColor"):
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColor"):
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case getPropertyId("BackgroundColorHover"):
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case getPropertyId("SelectedBackgroundColorHover"):
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            case getPropertyId("BorderColor"):
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case getPropertyId("TextureBranchExpanded"):
+            {
+                m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+            }
+
+            case getPropertyId("TextureBranchCollapsed"):
+            {
+                m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+            }
+
+            case getPropertyId("TextureLeaf"):
+            {
+                m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+            }
+
+            case getPropertyId("TextColor"):
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+            }
+
+            case getPropertyId("TextColorHover"):
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColor"):
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+            }
+
+            case getPropertyId("SelectedTextColorHover"):
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+            }
+
+            case getPropertyId("Scrollbar"):
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    markNodesDirty();
+                }
+                break;
+            }
+
+            case getPropertyId("ScrollbarWidth"):
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 markNodesDirty();
+                break;
             }
-        }
-        else if (property == "ScrollbarWidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            markNodesDirty();
-        }
-        else if ((property == "Opacity") || (property == "OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            setTextOpacityImpl(m_nodes, m_opacityCached);
+            case getPropertyId("Opacity"):
+            case getPropertyId("OpacityDisabled"):
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteBranchExpanded.setOpacity(m_opacityCached);
-            m_spriteBranchCollapsed.setOpacity(m_opacityCached);
-            m_spriteLeaf.setOpacity(m_opacityCached);
+                setTextOpacityImpl(m_nodes, m_opacityCached);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "Font")
-        {
-            Widget::rendererChanged(property);
-            setTextFontImpl(m_nodes, m_fontCached);
+                m_spriteBranchExpanded.setOpacity(m_opacityCached);
+                m_spriteBranchCollapsed.setOpacity(m_opacityCached);
+                m_spriteLeaf.setOpacity(m_opacityCached);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+
+            case getPropertyId("Font"):
+            {
+                Widget::rendererChanged(property);
+                setTextFontImpl(m_nodes, m_fontCached);
+                break;
+            }
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1103,7 +1262,7 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["ItemHeight"])
-            setItemHeight(node->propertyValuePairs["ItemHeight"]->value.toInt());
+            setItemHeight(node->propertyValuePairs["ItemHeight"]->getValue().toInt());
 
         loadItems(node, m_nodes, nullptr);
 
@@ -1129,6 +1288,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TreeView::isUpdateTimeRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateTimeRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> TreeView::getTimeUntilNextUpdate() const
+    {
+        // The double click has to expire before the next click, even when no other event wakes up the main loop before that
+        if (!m_possibleDoubleClick)
+            return Widget::getTimeUntilNextUpdate();
+
+        return getTimeUntilTimerExpires(getDoubleClickTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent)
     {
         for (const auto& childNode : node->children)
@@ -1139,7 +1316,7 @@ namespace tgui
             if (!childNode->propertyValuePairs["Text"])
                 throw Exception{"Failed to parse 'Item' property, expected a nested 'Text' propery"};
 
-            const String itemText = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["Text"]->value).getString();
+            const String itemText = Deserializer::deserialize(ObjectConverter::Type::String, *childNode->propertyValuePairs["Text"]).getString();
             createNode(items, parent, itemText);
 
             // Recursively handle the menu nodes
@@ -1171,14 +1348,7 @@ namespace tgui
             if (selectedNode == node.get())
                 m_selectedItem = pos;
 
-            const float iconPadding = (m_iconBounds.x / 4.f);
-            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                    (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f)});
-
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
-            if (right > m_maxRight)
-                m_maxRight = right;
+            updateNodeTextPosition(*node, textPadding);
 
             pos++;
             if (node->expanded && !node->nodes.empty())
@@ -1190,6 +1360,87 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TreeView::updateNodeTextPosition(Node& node, float textPadding)
+    {
+        // The vertical position of the item is not included in the text position, so that the texts don't have to be
+        // moved when items are inserted or removed above them. The offset is added when drawing the text.
+        const float iconPadding = (m_iconBounds.x / 4.f);
+        const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node.depth);
+        node.text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding, (m_itemHeight - node.text.getSize().y) / 2.f});
+
+        const float right = node.text.getPosition().x + node.text.getSize().x + m_paddingCached.getRight();
+        if (right > m_maxRight)
+            m_maxRight = right;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateVisibleNodesAfterToggle(std::size_t index)
+    {
+        TGUI_ASSERT(index < m_visibleNodes.size(), "Toggled node has to be visible");
+
+        // Restore the normal text color of the hovered item, the item below the mouse may change
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        const auto& toggledNode = m_visibleNodes[index];
+        if (toggledNode->expanded)
+        {
+            std::vector<std::shared_ptr<Node>> newVisibleNodes;
+            collectVisibleNodes(toggledNode->nodes, newVisibleNodes);
+
+            const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+            for (auto& node : newVisibleNodes)
+                updateNodeTextPosition(*node, textPadding);
+
+            m_visibleNodes.insert(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index) + 1, newVisibleNodes.begin(), newVisibleNodes.end());
+
+            if (m_selectedItem > static_cast<int>(index))
+                m_selectedItem += static_cast<int>(newVisibleNodes.size());
+        }
+        else // The node was collapsed
+        {
+            // All nodes below the collapsed node with a larger depth are its descendants
+            std::size_t endIndex = index + 1;
+            while ((endIndex < m_visibleNodes.size()) && (m_visibleNodes[endIndex]->depth > toggledNode->depth))
+                ++endIndex;
+
+            if ((m_selectedItem > static_cast<int>(index)) && (m_selectedItem < static_cast<int>(endIndex)))
+            {
+                // The selected item is no longer visible
+                m_visibleNodes[m_selectedItem]->text.setColor(m_textColorCached);
+                m_selectedItem = -1;
+            }
+            else if (m_selectedItem >= static_cast<int>(endIndex))
+                m_selectedItem -= static_cast<int>(endIndex - index - 1);
+
+            m_visibleNodes.erase(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index) + 1,
+                                 m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(endIndex));
+
+            // The widest item may have been removed
+            m_maxRight = 0;
+            for (const auto& node : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight());
+        }
+
+        updateScrollbars();
+
+        if ((oldHoveredItem >= 0) && (static_cast<std::size_t>(oldHoveredItem) < m_visibleNodes.size()))
+            updateHoveredItem(oldHoveredItem);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::requestLazyChildren(const std::shared_ptr<Node>& node)
+    {
+        node->lazyChildren = false;
+
+        const std::vector<String> hierarchy = getNodeHierarchy(node.get());
+        onItemsRequested.emit(this, hierarchy.back(), hierarchy);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::markNodesDirty()
     {
         Node* selectedNode = nullptr;
@@ -1213,6 +1464,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1313,7 +1571,7 @@ namespace tgui
                 statesForIcon.transform.translate({std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f))});
 
                 // Draw an icon for the leaf node if a texture is set
-                if (m_visibleNodes[i]->nodes.empty())
+                if (!isBranchNode(*m_visibleNodes[i]))
                 {
                     if (m_spriteLeaf.isSet())
                         target.drawSprite(statesForIcon, m_spriteLeaf);
@@ -1381,7 +1639,11 @@ namespace tgui
 
             // Draw the texts
             for (int i = firstNode; i < lastNode; ++i)
-                target.drawText(states, m_visibleNodes[i]->text);
+            {
+                auto statesForText = states;
+                statesForText.transform.translate({0, static_cast<float>(i * m_itemHeight)});
+                target.drawText(statesForText, m_visibleNodes[i]->text);
+            }
 
             target.removeClippingLayer();
         }
@@ -1392,7 +1654,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const String& text)
+    TreeView::Node* TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const String& text)
     {
         auto newNode = std::make_shared<Node>();
         newNode->text.setFont(m_fontCached);
@@ -1408,71 +1670,98 @@ namespace tgui
         else
             newNode->depth = 0;
 
+        // The lookup table only stores the first node with a given text, just like a linear search would find
+        auto& nodesByText = parent ? parent->nodesByText : m_nodesByText;
+        nodesByText.emplace(text, newNode.get());
+
         nodes.push_back(std::move(newNode));
+        return nodes.back().get();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool TreeView::expandOrCollapse(const std::vector<String>& hierarchy, bool expandNode)
+    TreeView::Node* TreeView::addItemImpl(const std::vector<String>& hierarchy, bool createParents)
     {
         if (hierarchy.empty())
-            return false;
+            return nullptr;
 
         if (hierarchy.size() >= 2)
         {
-            auto* node = findNode(m_nodes, hierarchy, 0);
+            auto* node = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
             if (!node)
-                return false;
+                return nullptr;
 
-            bool nodeChanged = false;
-            if (expandNode)
-            {
-                // When expanding, also expand all parents
-                auto* nodeToExpand = node;
-                while (nodeToExpand)
-                {
-                    if (nodeToExpand->expanded != expandNode)
-                    {
-                        nodeToExpand->expanded = expandNode;
-                        nodeChanged = true;
-                    }
+            return createNode(node->nodes, node, hierarchy.back());
+        }
+        else // Root node
+            return createNode(m_nodes, nullptr, hierarchy.back());
+    }
 
-                    nodeToExpand = nodeToExpand->parent;
-                }
-            }
-            else // Collapsing
-            {
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    nodeChanged = true;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TreeView::expandOrCollapse(const std::vector<String>& hierarchy, bool expandNode)
+    {
+        if (hierarchy.empty())
+            return false;
 
-            if (nodeChanged)
-                markNodesDirty();
+        auto* node = findNode(m_nodesByText, hierarchy, 0);
+        if (!node)
+            return false;
 
-            return true;
+        // When expanding, also expand all parents
+        std::vector<Node*> changedNodes;
+        auto* nodeToChange = node;
+        while (nodeToChange)
+        {
+            if (nodeToChange->expanded != expandNode)
+                changedNodes.push_back(nodeToChange);
+
+            if (!expandNode)
+                break;
+
+            nodeToChange = nodeToChange->parent;
         }
-        else // Root node
+
+        if (changedNodes.empty())
+            return true;
+
+        if (expandNode)
         {
-            for (auto& node : m_nodes)
+            for (auto* changedNode : changedNodes)
             {
-                if (node->text.getString() != hierarchy.back())
-                    continue;
-
-                if (node->expanded != expandNode)
+                if (changedNode->lazyChildren)
                 {
-                    node->expanded = expandNode;
-                    markNodesDirty();
+                    changedNode->lazyChildren = false;
+
+                    const std::vector<String> lazyHierarchy = getNodeHierarchy(changedNode);
+                    onItemsRequested.emit(this, lazyHierarchy.back(), lazyHierarchy);
                 }
+            }
+        }
 
-                return true;
+        // If only a single node changed and it is currently visible then the visible items are updated without rebuilding them
+        std::size_t visibleIndex = m_visibleNodes.size();
+        if ((changedNodes.size() == 1) && isNodeVisible(*changedNodes[0]))
+        {
+            for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
+            {
+                if (m_visibleNodes[i].get() == changedNodes[0])
+                {
+                    visibleIndex = i;
+                    break;
+                }
             }
         }
 
-        return false;
+        for (auto* changedNode : changedNodes)
+            changedNode->expanded = expandNode;
+
+        if (visibleIndex < m_visibleNodes.size())
+            updateVisibleNodesAfterToggle(visibleIndex);
+        else
+            markNodesDirty();
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1562,23 +1851,23 @@ namespace tgui
 
     TreeView::Node* TreeView::findParentNode(const std::vector<String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents)
     {
-        for (auto& node : nodes)
+        const auto& nodesByText = parent ? parent->nodesByText : m_nodesByText;
+        const auto it = nodesByText.find(hierarchy[parentIndex]);
+        if (it != nodesByText.end())
         {
-            if (node->text.getString() != hierarchy[parentIndex])
-                continue;
-            else if (parentIndex + 2 == hierarchy.size())
-                return node.get();
+            if (parentIndex + 2 == hierarchy.size())
+                return it->second;
             else
-                return findParentNode(hierarchy, parentIndex + 1, node->nodes, node.get(), createParents);
+                return findParentNode(hierarchy, parentIndex + 1, it->second->nodes, it->second, createParents);
         }
 
         if (createParents)
         {
-            createNode(nodes, parent, hierarchy[parentIndex]);
+            auto* newNode = createNode(nodes, parent, hierarchy[parentIndex]);
             if (parentIndex + 2 == hierarchy.size())
-                return nodes.back().get();
+                return newNode;
             else
-                return findParentNode(hierarchy, parentIndex + 1, nodes.back()->nodes, nodes.back().get(), createParents);
+                return findParentNode(hierarchy, parentIndex + 1, newNode->nodes, newNode, createParents);
         }
 
         return nullptr;
@@ -262,4 +262,69 @@ TEST_CASE("[Animation]")
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Time updates from gui")
+    {
+        GuiNull gui;
+        gui.add(parent);
+
+        widget->moveWithAnimation({60, 60}, std::chrono::milliseconds(300));
+        parent->moveWithAnimation({90, 90}, std::chrono::milliseconds(300));
+
+        // Each widget is only updated once, even though the animated widget is a child of another animated widget
+        gui.updateTime(std::chrono::milliseconds(100));
+        compareVector2f(widget->getPosition(), {40, 30});
+        compareVector2f(parent->getPosition(), {30, 30});
+
+        // Widgets inside a hidden container don't receive time updates
+        parent->setVisible(false);
+        gui.updateTime(std::chrono::milliseconds(100));
+        compareVector2f(widget->getPosition(), {40, 30});
+        REQUIRE(widget->isAnimationPlaying());
+
+        parent->setVisible(true);
+        gui.updateTime(std::chrono::milliseconds(200));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{60, 60});
+        REQUIRE(!widget->isAnimationPlaying());
+
+        // Animations that were started before the widget was added to the gui are also updated
+        auto widget2 = tgui::ClickableWidget::create();
+        widget2->moveWithAnimation({50, 50}, std::chrono::milliseconds(100));
+        parent->add(widget2);
+        gui.updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f{50, 50});
+    }
+
+    SECTION("Main loop wait time")
+    {
+        GuiNull gui;
+        gui.add(parent);
+        REQUIRE(!gui.getMainLoopWaitTime(false, {}));
+
+        const auto getWaitTime = [&gui]{
+            const tgui::Optional<tgui::Duration> waitTime = gui.getMainLoopWaitTime(false, {});
+            REQUIRE(waitTime);
+            return *waitTime;
+        };
+
+        // Widgets that play an animation are updated every frame
+        widget->moveWithAnimation({60, 60}, std::chrono::milliseconds(300));
+        REQUIRE(getWaitTime() == tgui::Duration{});
+        gui.updateTime(std::chrono::milliseconds(300));
+        REQUIRE(!gui.getMainLoopWaitTime(false, {}));
+
+        // A focused edit box only wakes up the main loop when the caret has to blink
+        auto editBox = tgui::EditBox::create();
+        parent->add(editBox);
+        editBox->setFocused(true);
+        REQUIRE(getWaitTime() == tgui::getEditCursorBlinkRate());
+        gui.updateTime(std::chrono::milliseconds(100));
+        REQUIRE(getWaitTime() == tgui::getEditCursorBlinkRate() - tgui::Duration(std::chrono::milliseconds(100)));
+        gui.updateTime(tgui::getEditCursorBlinkRate());
+        REQUIRE(getWaitTime() == tgui::getEditCursorBlinkRate());
+
+        editBox->setFocused(false);
+        gui.updateTime(std::chrono::milliseconds(100));
+        REQUIRE(!gui.getMainLoopWaitTime(false, {}));
+    }
 }
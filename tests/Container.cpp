@@ -162,6 +162,43 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("renaming and moving widgets")
+        {
+            container->removeAllWidgets();
+
+            auto child1 = tgui::Panel::create();
+            auto child2 = tgui::Panel::create();
+            auto child11 = tgui::Panel::create();
+            auto child111 = tgui::Button::create();
+            child11->add(child111, "111");
+            child1->add(child11, "11");
+            container->add(child1, "1");
+            container->add(child2, "2");
+
+            REQUIRE(container->get("111") == child111);
+            REQUIRE(child1->get("111") == child111);
+            REQUIRE(child2->get("111") == nullptr);
+
+            child111->setWidgetName("renamed");
+            REQUIRE(container->get("111") == nullptr);
+            REQUIRE(container->get("renamed") == child111);
+
+            // Moving a container also moves the names of the widgets inside it
+            child1->remove(child11);
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(child11->get("renamed") == child111);
+
+            child2->add(child11);
+            REQUIRE(container->get("renamed") == child111);
+            REQUIRE(child2->get("renamed") == child111);
+            REQUIRE(child1->get("renamed") == nullptr);
+
+            // Widgets inside a SubwidgetContainer are still found
+            auto spinControl = tgui::SpinControl::create();
+            container->add(spinControl);
+            REQUIRE(container->get("SpinText") != nullptr);
+        }
     }
 
     SECTION("remove")
@@ -437,6 +474,222 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Spatial index")
+    {
+        container->removeAllWidgets();
+        container->getContainer()->setSpatialIndexEnabled(true);
+        container->getContainer()->setSpatialIndexCellSize(50);
+        REQUIRE(container->getContainer()->isSpatialIndexEnabled());
+        REQUIRE(container->getContainer()->getSpatialIndexCellSize() == 50);
+
+        auto w1 = tgui::ClickableWidget::create({200, 200});
+        container->add(w1);
+
+        auto w2 = tgui::ClickableWidget::create({40, 30});
+        w2->setPosition({60, 70});
+        container->add(w2);
+
+        auto w3 = tgui::ClickableWidget::create({40, 30});
+        w3->setPosition({140, 20});
+        w3->setRotation(90);
+        container->add(w3);
+
+        REQUIRE(container->getWidgetAtPosition({10, 10}) == w1);
+        REQUIRE(container->getWidgetAtPosition({80, 80}) == w2);
+        REQUIRE(container->getWidgetAtPosition({120, 40}) == w3);
+        REQUIRE(container->getWidgetAtPosition({250, 250}) == nullptr);
+
+        // Moving and resizing a widget updates the index
+        w2->setPosition({300, 300});
+        REQUIRE(container->getWidgetAtPosition({80, 80}) == w1);
+        REQUIRE(container->getWidgetAtPosition({310, 310}) == w2);
+        w2->setSize({10, 10});
+        REQUIRE(container->getWidgetAtPosition({320, 320}) == nullptr);
+
+        // Changing the z-order updates the index
+        w2->setPosition({10, 10});
+        REQUIRE(container->getWidgetAtPosition({15, 15}) == w2);
+        container->moveWidgetToBack(w2);
+        REQUIRE(container->getWidgetAtPosition({15, 15}) == w1);
+
+        w1->setVisible(false);
+        REQUIRE(container->getWidgetAtPosition({15, 15}) == w2);
+
+        container->remove(w2);
+        REQUIRE(container->getWidgetAtPosition({15, 15}) == nullptr);
+
+        // The resize border of a child window lies outside its size
+        auto window = tgui::ChildWindow::create();
+        window->getRenderer()->setBorders(0);
+        window->getRenderer()->setMinimumResizableBorderWidth(10);
+        window->setPosition({300, 300});
+        window->setSize({100, 80});
+        container->add(window);
+        REQUIRE(container->getWidgetAtPosition({295, 320}) == nullptr);
+
+        window->setResizable(true);
+        REQUIRE(container->getWidgetAtPosition({295, 320}) == window);
+
+        window->getRenderer()->setMinimumResizableBorderWidth(2);
+        REQUIRE(container->getWidgetAtPosition({295, 320}) == nullptr);
+
+        window->getRenderer()->setMinimumResizableBorderWidth(10);
+        REQUIRE(container->getWidgetAtPosition({295, 320}) == window);
+
+        // The text of a check box can be clicked and changes without changing the size of the widget
+        auto checkBox = tgui::CheckBox::create();
+        checkBox->setPosition({300, 100});
+        checkBox->setSize({20, 20});
+        checkBox->setTextSize(16);
+        container->add(checkBox);
+        REQUIRE(container->getWidgetAtPosition({310, 110}) == checkBox);
+        REQUIRE(container->getWidgetAtPosition({360, 110}) == nullptr);
+
+        checkBox->setText("Long text to click on");
+        REQUIRE(container->getWidgetAtPosition({360, 110}) == checkBox);
+
+        checkBox->setTextClickable(false);
+        REQUIRE(container->getWidgetAtPosition({360, 110}) == nullptr);
+        REQUIRE(container->getWidgetAtPosition({310, 110}) == checkBox);
+    }
+
+    SECTION("Lazy loading")
+    {
+        const std::string form =
+            "Panel.Page1 {\n"
+            "    Visible = false;\n"
+            "    Button.Button1 { Text = \"Button\"; }\n"
+            "    Panel.Nested {\n"
+            "        Visible = false;\n"
+            "        Label.NestedLabel { Text = \"Nested\"; }\n"
+            "    }\n"
+            "}\n"
+            "Panel.Page2 {\n"
+            "    Label.Label2 { Text = \"Visible\"; }\n"
+            "}\n"
+            "ChildWindow.Window {\n"
+            "    Visible = false;\n"
+            "    EditBox.EditBox3 {}\n"
+            "}\n"
+            "VerticalLayout.Layout {\n"
+            "    Visible = false;\n"
+            "    Button.Button4 {}\n"
+            "}\n";
+
+        REQUIRE(!tgui::Container::getLazyLoadingEnabled());
+        tgui::Container::setLazyLoadingEnabled(true);
+        REQUIRE(tgui::Container::getLazyLoadingEnabled());
+
+        container->loadWidgetsFromStream(std::stringstream{form});
+        tgui::Container::setLazyLoadingEnabled(false);
+
+        auto page1 = container->get<tgui::Panel>("Page1");
+        auto window = container->get<tgui::ChildWindow>("Window");
+        REQUIRE(page1->getWidgets().empty());
+        REQUIRE(container->get<tgui::Panel>("Page2")->getWidgets().size() == 1);
+        REQUIRE(window->getWidgets().empty());
+        REQUIRE(container->get<tgui::VerticalLayout>("Layout")->getWidgets().size() == 1);
+
+        SECTION("setVisible")
+        {
+            page1->setVisible(true);
+            REQUIRE(page1->getWidgets().size() == 2);
+            REQUIRE(page1->get<tgui::Button>("Button1")->getText() == "Button");
+
+            // Invisible containers inside the page are only loaded when they are needed as well
+            auto nested = page1->get<tgui::Panel>("Nested");
+            REQUIRE(nested->getWidgets().empty());
+            nested->setVisible(true);
+            REQUIRE(nested->getWidgets().size() == 1);
+        }
+
+        SECTION("get")
+        {
+            REQUIRE(container->get("NonExistent") == nullptr);
+            REQUIRE(page1->getWidgets().empty());
+
+            auto label = container->get<tgui::Label>("NestedLabel");
+            REQUIRE(label != nullptr);
+            REQUIRE(label->getText() == "Nested");
+            REQUIRE(page1->getWidgets().size() == 2);
+            REQUIRE(!page1->isVisible());
+            REQUIRE(window->getWidgets().empty());
+
+            REQUIRE(container->get<tgui::EditBox>("EditBox3") != nullptr);
+            REQUIRE(window->getWidgets().size() == 1);
+        }
+
+        SECTION("Copy")
+        {
+            auto pageCopy = tgui::Panel::copy(page1);
+            REQUIRE(pageCopy->getWidgets().empty());
+            pageCopy->setVisible(true);
+            REQUIRE(pageCopy->getWidgets().size() == 2);
+            REQUIRE(page1->getWidgets().empty());
+        }
+
+        SECTION("Saving")
+        {
+            std::stringstream lazyStream;
+            container->saveWidgetsToStream(lazyStream);
+            REQUIRE(page1->getWidgets().size() == 2);
+            REQUIRE(window->getWidgets().size() == 1);
+
+            auto eagerContainer = std::make_shared<GuiNull>();
+            eagerContainer->loadWidgetsFromStream(std::stringstream{form});
+            REQUIRE(eagerContainer->get<tgui::Panel>("Page1")->getWidgets().size() == 2);
+
+            std::stringstream eagerStream;
+            eagerContainer->saveWidgetsToStream(eagerStream);
+            REQUIRE(lazyStream.str() == eagerStream.str());
+        }
+
+        SECTION("Node tree is left intact")
+        {
+            const std::string page =
+                "Panel.Page {\n"
+                "    Visible = false;\n"
+                "    Button.Button1 {}\n"
+                "    Label.Label1 {}\n"
+                "}\n";
+            const auto rootNode = tgui::DataIO::parse(page.data(), page.size());
+
+            tgui::Container::setLazyLoadingEnabled(true);
+            container->getContainer()->loadWidgetsFromNodeTree(rootNode);
+            tgui::Container::setLazyLoadingEnabled(false);
+
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->children.size() == 2);
+            REQUIRE(rootNode->children[0]->children[0]->name == "Button.Button1");
+            REQUIRE(rootNode->children[0]->children[1]->name == "Label.Label1");
+
+            REQUIRE(container->get<tgui::Panel>("Page")->getWidgets().empty());
+            REQUIRE(container->get<tgui::Label>("Label1") != nullptr);
+        }
+
+        SECTION("Unknown widget types")
+        {
+            tgui::Container::setLazyLoadingEnabled(true);
+            REQUIRE_THROWS_AS(container->loadWidgetsFromStream(std::stringstream{
+                "Panel.Page {\n"
+                "    Visible = false;\n"
+                "    Panel.Inner {\n"
+                "        UnknownWidget.Unknown {}\n"
+                "    }\n"
+                "}\n"}), tgui::Exception);
+            REQUIRE_THROWS_AS(container->loadWidgetsFromStream(std::stringstream{
+                "Panel.Page {\n"
+                "    Visible = false;\n"
+                "    Button.Button1 {\n"
+                "        ToolTip {\n"
+                "            UnknownWidget {}\n"
+                "        }\n"
+                "    }\n"
+                "}\n"}), tgui::Exception);
+            tgui::Container::setLazyLoadingEnabled(false);
+        }
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
 
 TEST_CASE("[Filesystem]")
 {
@@ -76,4 +79,52 @@ TEST_CASE("[Filesystem]")
         REQUIRE(tgui::Filesystem::createDirectory("filesystem-test-dir"));
         REQUIRE(tgui::Filesystem::directoryExists("filesystem-test-dir"));
     }
+
+    SECTION("Listing files")
+    {
+        REQUIRE(tgui::Filesystem::createDirectory("filesystem-test-dir"));
+        REQUIRE(tgui::Filesystem::createDirectory("filesystem-test-dir/subdir"));
+        std::ofstream{"filesystem-test-dir/file.txt"} << "Hello";
+        const tgui::Filesystem::Path dirPath("filesystem-test-dir");
+
+        auto files = tgui::Filesystem::listFilesInDirectory(dirPath);
+        std::sort(files.begin(), files.end(), [](const auto& left, const auto& right){ return left.filename < right.filename; });
+        REQUIRE(files.size() == 2);
+        REQUIRE(files[0].filename == "file.txt");
+        REQUIRE(!files[0].directory);
+        REQUIRE(files[0].fileSize == 5);
+        REQUIRE(files[1].filename == "subdir");
+        REQUIRE(files[1].directory);
+
+        std::vector<tgui::String> directories;
+        REQUIRE(tgui::Filesystem::listFilesInDirectory(dirPath, [&](tgui::Filesystem::FileInfo&& file){ directories.push_back(file.filename); return true; }, true));
+        REQUIRE(directories == std::vector<tgui::String>{"subdir"});
+
+        unsigned int callCount = 0;
+        REQUIRE(!tgui::Filesystem::listFilesInDirectory(dirPath, [&](tgui::Filesystem::FileInfo&&){ ++callCount; return false; }));
+        REQUIRE(callCount == 1);
+
+        SECTION("Cache")
+        {
+            tgui::Filesystem::clearDirectoryListingCache();
+
+            std::vector<tgui::Filesystem::FileInfo> cachedFiles;
+            REQUIRE(!tgui::Filesystem::getCachedFilesInDirectory(dirPath, cachedFiles));
+
+            // Aborted listings aren't cached
+            REQUIRE(!tgui::Filesystem::listFilesInDirectory(dirPath, [](tgui::Filesystem::FileInfo&&){ return false; }, false, true));
+            REQUIRE(!tgui::Filesystem::getCachedFilesInDirectory(dirPath, cachedFiles));
+
+            REQUIRE(tgui::Filesystem::listFilesInDirectory(dirPath, [](tgui::Filesystem::FileInfo&&){ return true; }, false, true));
+            REQUIRE(tgui::Filesystem::getCachedFilesInDirectory(dirPath, cachedFiles));
+            REQUIRE(cachedFiles.size() == 2);
+
+            // Adding a file to the directory invalidates the cache
+            std::ofstream{"filesystem-test-dir/file2.txt"} << "Hello";
+            REQUIRE(!tgui::Filesystem::getCachedFilesInDirectory(dirPath, cachedFiles));
+            std::remove("filesystem-test-dir/file2.txt");
+
+            tgui::Filesystem::clearDirectoryListingCache();
+        }
+    }
 }
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <iostream>
+#include <stdexcept>
 
 using namespace tgui::bind_functions;
 using tgui::Layout;
@@ -451,6 +452,127 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Deferred updates")
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setSize(400, 300);
+
+        auto button1 = std::make_shared<tgui::Button>();
+        auto button2 = std::make_shared<tgui::Button>();
+        auto button3 = std::make_shared<tgui::Button>();
+        panel->add(button1, "b1");
+        panel->add(button2, "b2");
+        panel->add(button3, "b3");
+
+        button1->setSize({"&.width / 4", 20});
+        button2->setPosition({"b1.right + 10", 0});
+        button2->setSize({"&.width / 2", 20});
+        button3->setPosition({"b1.right + b2.right", 0});
+
+        unsigned int positionChangeCount = 0;
+        button3->onPositionChange([&]{ ++positionChangeCount; });
+
+        SECTION("Layouts are still updated immediately by default")
+        {
+            panel->setSize(800, 300);
+            REQUIRE(button1->getSize() == tgui::Vector2f(200, 20));
+            REQUIRE(button3->getPosition() == tgui::Vector2f(200 + 610, 0));
+            REQUIRE(positionChangeCount > 0);
+        }
+
+        SECTION("Layouts are updated once when deferred")
+        {
+            tgui::Layout::beginDeferredUpdates();
+            panel->setSize(800, 300);
+            REQUIRE(button1->getSize() == tgui::Vector2f(100, 20));
+            REQUIRE(button3->getPosition() == tgui::Vector2f(100 + 310, 0));
+
+            tgui::Layout::beginDeferredUpdates();
+            panel->setSize(1200, 300);
+            tgui::Layout::endDeferredUpdates();
+            REQUIRE(positionChangeCount == 0);
+
+            tgui::Layout::endDeferredUpdates();
+            REQUIRE(button1->getSize() == tgui::Vector2f(300, 20));
+            REQUIRE(button2->getPosition() == tgui::Vector2f(310, 0));
+            REQUIRE(button2->getSize() == tgui::Vector2f(600, 20));
+            REQUIRE(button3->getPosition() == tgui::Vector2f(300 + 910, 0));
+            REQUIRE(positionChangeCount == 1);
+        }
+
+        SECTION("Removing widgets while updates are deferred")
+        {
+            tgui::Layout::beginDeferredUpdates();
+            panel->setSize(800, 300);
+            panel->remove(button3);
+            button3 = nullptr;
+            tgui::Layout::endDeferredUpdates();
+            REQUIRE(button2->getPosition() == tgui::Vector2f(210, 0));
+            REQUIRE(positionChangeCount == 0);
+        }
+
+        SECTION("Exception thrown while updating layouts")
+        {
+            bool throwException = true;
+            button2->onPositionChange([&]{ if (throwException) throw std::runtime_error("position change failed"); });
+            REQUIRE_THROWS_AS(panel->setSize(800, 300), std::runtime_error);
+
+            // Layouts are still updated after the exception
+            throwException = false;
+            panel->setSize(1000, 300);
+            REQUIRE(button1->getSize() == tgui::Vector2f(250, 20));
+            REQUIRE(button2->getPosition() == tgui::Vector2f(260, 0));
+            REQUIRE(button3->getPosition() == tgui::Vector2f(250 + 760, 0));
+        }
+    }
+
+    SECTION("Nested expressions")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+        auto button = std::make_shared<tgui::Button>();
+        panel->add(button, "b");
+
+        button->setSize({"min(&.innerwidth * 0.5, 150) + max(10, &.innerheight / 10) - 5", "(&.height - 100) / 2 * min(1, 2)"});
+        REQUIRE(button->getSize() == tgui::Vector2f(150 + 30 - 5, 100));
+
+        panel->setSize(200, 500);
+        REQUIRE(button->getSize() == tgui::Vector2f(100 + 50 - 5, 200));
+
+        panel->getRenderer()->setBorders({10, 20, 10, 20});
+        REQUIRE(button->getSize() == tgui::Vector2f(90 + 46 - 5, 200));
+
+        // The copied layout is bound to the same panel
+        auto button2 = tgui::Button::copy(button);
+        panel->add(button2);
+        panel->setSize(100, 100);
+        REQUIRE(button->getSize() == tgui::Vector2f(40 + 10 - 5, 0));
+        REQUIRE(button2->getSize() == tgui::Vector2f(40 + 10 - 5, 0));
+
+        button->setSize({"&.width / (&.height - 100)", 5});
+        REQUIRE(button->getSize() == tgui::Vector2f(0, 5));
+    }
+
+    SECTION("Destroying one of multiple bound widgets")
+    {
+        auto button1 = std::make_shared<tgui::Button>();
+        auto button2 = std::make_shared<tgui::Button>();
+        button1->setSize(100, 20);
+        button2->setSize(50, 30);
+        button2->setWidgetName("b2");
+
+        auto button3 = std::make_shared<tgui::Button>();
+        button3->setSize(bindWidth(button1) + bindWidth(button2) + 5, bindHeight(button2));
+        REQUIRE(button3->getSize() == tgui::Vector2f(155, 30));
+
+        // The steps that bound the destroyed widget become 0, the other binding keeps working
+        button1 = nullptr;
+        REQUIRE(button3->getSize() == tgui::Vector2f(55, 30));
+
+        button2->setSize(60, 40);
+        REQUIRE(button3->getSize() == tgui::Vector2f(65, 40));
+        REQUIRE(button3->getSizeLayout().x.toString() == "(0 + b2.width) + 5");
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -88,14 +88,14 @@ TEST_CASE("[DataIO]")
             REQUIRE(rootNode->children.size() == 1);
             REQUIRE(rootNode->children[0]->name == "\"SpecialChars.{}=:;/*#//\\t\\\"\\\\\"");
             REQUIRE(rootNode->children[0]->propertyValuePairs.size() == 1);
-            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->value == "\"\\\\\\\"Value\\\"\\\\\"");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->getValue() == "\"\\\\\\\"Value\\\"\\\\\"");
 
             REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String,
                                                     rootNode->children[0]->name).getString()
                     == "SpecialChars.{}=:;/*#//\t\"\\");
 
             REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String,
-                                                    rootNode->children[0]->propertyValuePairs["Property"]->value).getString()
+                                                    rootNode->children[0]->propertyValuePairs["Property"]->getValue()).getString()
                     == "\\\"Value\"\\");
         }
 
@@ -105,6 +105,37 @@ TEST_CASE("[DataIO]")
             REQUIRE_NOTHROW(tgui::DataIO::parse(input));
         }
 
+        SECTION("Comments behind quoted value")
+        {
+            std::stringstream input("Property = \"a b\" // Comment\n; Property2 = \"c\"/* Comment */ \"d\";");
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(input));
+            REQUIRE(rootNode->propertyValuePairs["Property"]->getValue() == "\"a b\"");
+            REQUIRE(rootNode->propertyValuePairs["Property2"]->getValue() == "\"c\" \"d\"");
+        }
+
+        SECTION("Parsing from memory")
+        {
+            const std::string input = "Child { Property = [a, \"b, c\" , d]; Child2 { Text = \"\xC3\xA9\"; } }";
+            auto rootNode = tgui::DataIO::parse(input.data(), input.size());
+
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->name == "Child");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->listNode);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->valueList
+                    == std::vector<tgui::String>{"a", "\"b, c\"", "d"});
+            REQUIRE(rootNode->children[0]->children.size() == 1);
+            REQUIRE(rootNode->children[0]->children[0]->propertyValuePairs["Text"]->getValue() == U"\"é\"");
+        }
+
+        SECTION("Error contains line and column")
+        {
+            const std::string input = "Child {\n    Property = Value;\n    Property2 = ;\n}";
+            REQUIRE_THROWS_WITH(tgui::DataIO::parse(input.data(), input.size()),
+                                Catch::Contains("line 3, column 17"));
+        }
+
         SECTION("Unexpected '/' found")
         {
             std::stringstream input("/ {}");
@@ -264,26 +295,26 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children.size() == 2);
         REQUIRE(parsedRoot->propertyValuePairs.size() == 2);
         REQUIRE(!parsedRoot->propertyValuePairs["GlobalProperty1"]->listNode);
-        REQUIRE(parsedRoot->propertyValuePairs["GlobalProperty1"]->value == "GlobalValue1");
+        REQUIRE(parsedRoot->propertyValuePairs["GlobalProperty1"]->getValue() == "GlobalValue1");
         REQUIRE(!parsedRoot->propertyValuePairs["GlobalProperty2"]->listNode);
-        REQUIRE(parsedRoot->propertyValuePairs["GlobalProperty2"]->value == "GlobalValue2");
+        REQUIRE(parsedRoot->propertyValuePairs["GlobalProperty2"]->getValue() == "GlobalValue2");
         REQUIRE(parsedRoot->children[0]->name == "Child1");
         REQUIRE(parsedRoot->children[0]->parent == parsedRoot.get());
         REQUIRE(parsedRoot->children[0]->children.size() == 1);
         REQUIRE(parsedRoot->children[0]->propertyValuePairs.size() == 1);
         REQUIRE(!parsedRoot->children[0]->propertyValuePairs["Property"]->listNode);
-        REQUIRE(parsedRoot->children[0]->propertyValuePairs["Property"]->value == "Value");
+        REQUIRE(parsedRoot->children[0]->propertyValuePairs["Property"]->getValue() == "Value");
         REQUIRE(parsedRoot->children[0]->children[0]->name == "NestedChild");
         REQUIRE(parsedRoot->children[0]->children[0]->parent == parsedRoot->children[0].get());
         REQUIRE(parsedRoot->children[0]->children[0]->children.empty());
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs.size() == 3);
         REQUIRE(!parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyA"]->listNode);
-        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyA"]->value == "ValueA");
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyA"]->getValue() == "ValueA");
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyB"]->listNode);
-        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyB"]->value == "[]");
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyB"]->getValue() == "[]");
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyB"]->valueList.empty());
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->listNode);
-        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->value == "[X, Y, Z]");
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->getValue() == "[X, Y, Z]");
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->valueList.size() == 3);
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->valueList[0] == "X");
         REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["PropertyC"]->valueList[1] == "Y");
@@ -293,4 +324,110 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children[1]->children.empty());
         REQUIRE(parsedRoot->children[1]->propertyValuePairs.empty());
     }
+
+    SECTION("binary")
+    {
+        for (const auto& filename : {"resources/ThemeSpecialCases.txt", "resources/ThemeNested.txt", "resources/Black.txt"})
+        {
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            REQUIRE(fileContents);
+
+            const auto textRoot = tgui::DataIO::parse(reinterpret_cast<const char*>(fileContents.get()), fileSize);
+            REQUIRE(!tgui::DataIO::isBinary(reinterpret_cast<const char*>(fileContents.get()), fileSize));
+
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(textRoot, binaryStream);
+            const std::string binary = binaryStream.str();
+            REQUIRE(tgui::DataIO::isBinary(binary.data(), binary.size()));
+
+            // Loading the binary data results in the same tree as parsing the text
+            const auto binaryRoot = tgui::DataIO::parse(binary.data(), binary.size());
+            std::stringstream textOutput;
+            std::stringstream binaryOutput;
+            tgui::DataIO::emit(textRoot, textOutput);
+            tgui::DataIO::emit(binaryRoot, binaryOutput);
+            REQUIRE(textOutput.str() == binaryOutput.str());
+
+            // Truncated data is detected
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(binary.data(), binary.size() - 1), tgui::Exception);
+        }
+
+        std::stringstream input("Child { Property = [a, \"b, c\"]; Nested {} }");
+        auto root = tgui::DataIO::parse(input);
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(root, binaryStream);
+        root = tgui::DataIO::parse(binaryStream);
+        REQUIRE(root->children.size() == 1);
+        REQUIRE(root->children[0]->parent == root.get());
+        REQUIRE(root->children[0]->propertyValuePairs["Property"]->listNode);
+        REQUIRE(root->children[0]->propertyValuePairs["Property"]->valueList == std::vector<tgui::String>{"a", "\"b, c\""});
+        REQUIRE(root->children[0]->children.size() == 1);
+        REQUIRE(root->children[0]->children[0]->parent == root->children[0].get());
+        REQUIRE(root->children[0]->children[0]->name == "Nested");
+
+        SECTION("Nesting depth")
+        {
+            auto deepRoot = std::make_unique<tgui::DataIO::Node>();
+            tgui::DataIO::Node* deepestNode = deepRoot.get();
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                deepestNode->children.push_back(std::make_unique<tgui::DataIO::Node>());
+                deepestNode->children.back()->parent = deepestNode;
+                deepestNode = deepestNode->children.back().get();
+            }
+
+            std::stringstream deepBinaryStream;
+            tgui::DataIO::emitBinary(deepRoot, deepBinaryStream);
+            const std::string deepBinary = deepBinaryStream.str();
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(deepBinary.data(), deepBinary.size()), tgui::Exception);
+        }
+
+        SECTION("Typed values")
+        {
+            std::stringstream typedInput("Text = \"a\\nb\"; Name = Hello; Number = 1.5; Integer = 007; Bool = true;"
+                                         "Hex = #12AB34; LowercaseHex = #12ab34; Rgb = rgb(1, 2, 3); Rgba = rgba(1, 2, 3, 4);"
+                                         "Outline = (1, 2, 3, 4); RelativeOutline = (1, 2, 3%, 4); Texture = \"image.png\" Smooth;");
+            const auto typedRoot = tgui::DataIO::parse(typedInput);
+            std::stringstream typedBinaryStream;
+            tgui::DataIO::emitBinary(typedRoot, typedBinaryStream);
+            const std::string typedBinary = typedBinaryStream.str();
+            const auto binaryRoot = tgui::DataIO::parse(typedBinary.data(), typedBinary.size());
+
+            // The strings are identical to the ones that were parsed from the text
+            REQUIRE(binaryRoot->propertyValuePairs.size() == typedRoot->propertyValuePairs.size());
+            for (const auto& pair : typedRoot->propertyValuePairs)
+                REQUIRE(binaryRoot->propertyValuePairs[pair.first]->getValue() == pair.second->getValue());
+
+            // Values that could be recognized were deserialized by the parser
+            auto& pairs = binaryRoot->propertyValuePairs;
+            REQUIRE(pairs["Text"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(tgui::ObjectConverter{pairs["Text"]->getDeserializedValue()}.getString() == "a\nb");
+            REQUIRE(pairs["Name"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(pairs["Number"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(tgui::ObjectConverter{pairs["Number"]->getDeserializedValue()}.getNumber() == 1.5f);
+            REQUIRE(pairs["Integer"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(pairs["Bool"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::Bool);
+            REQUIRE(pairs["Hex"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(tgui::ObjectConverter{pairs["Hex"]->getDeserializedValue()}.getColor() == tgui::Color{0x12, 0xAB, 0x34});
+            REQUIRE(pairs["LowercaseHex"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(pairs["Rgb"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(tgui::ObjectConverter{pairs["Rgba"]->getDeserializedValue()}.getColor() == tgui::Color{1, 2, 3, 4});
+            REQUIRE(pairs["Outline"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(tgui::ObjectConverter{pairs["Outline"]->getDeserializedValue()}.getOutline() == tgui::Outline{1, 2, 3, 4});
+            REQUIRE(pairs["RelativeOutline"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(pairs["Texture"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::None);
+
+            // The deserializer uses the value that was already deserialized
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Number, *pairs["Number"]).getNumber() == 1.5f);
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Outline, *pairs["Number"]).getOutline() == tgui::Outline{1.5f});
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, *pairs["Integer"]).getString() == "007");
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Color, *pairs["LowercaseHex"]).getColor() == tgui::Color{0x12, 0xAB, 0x34});
+
+            // Changing the value removes the deserialized value
+            pairs["Number"]->setValue("2");
+            REQUIRE(pairs["Number"]->getDeserializedValue().getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(pairs["Number"]->getValue() == "2");
+        }
+    }
 }
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Label.hpp>
 
 // TODO: Reloading theme
@@ -65,6 +66,58 @@ TEST_CASE("[Theme]")
             tgui::Theme theme2("resources/Black.txt");
             REQUIRE_THROWS_AS(theme2.getRenderer("nonexistent_section"), tgui::Exception);
         }
+
+        SECTION("Nested renderers are not shared between themes")
+        {
+            tgui::Theme theme1("resources/ThemeNested.txt");
+            tgui::Theme theme2("resources/ThemeNested.txt");
+
+            auto listBox1 = theme1.getRenderer("ComboBox4")->propertyValuePairs["ListBox"].getRenderer();
+            auto listBox2 = theme2.getRenderer("ComboBox4")->propertyValuePairs["ListBox"].getRenderer();
+            REQUIRE(listBox1 != listBox2);
+
+            listBox1->propertyValuePairs["BackgroundColor"] = tgui::Color::Red;
+            REQUIRE(listBox2->propertyValuePairs["BackgroundColor"].getColor() == tgui::Color::Magenta);
+            REQUIRE(tgui::Theme("resources/ThemeNested.txt").getRenderer("ComboBox4")->propertyValuePairs["ListBox"].getRenderer()
+                    ->propertyValuePairs["BackgroundColor"].getColor() == tgui::Color::Magenta);
+        }
+
+        SECTION("Properties are only copied when changed")
+        {
+            tgui::Theme theme1("resources/ThemeSpecialCases.txt");
+            tgui::Theme theme2("resources/ThemeSpecialCases.txt");
+
+            const tgui::PropertyValueMap& properties1 = theme1.getRenderer("Button1")->propertyValuePairs;
+            const tgui::PropertyValueMap& properties2 = theme2.getRenderer("Button1")->propertyValuePairs;
+            REQUIRE(!properties1.empty());
+            REQUIRE(&properties1.begin()->second == &properties2.begin()->second);
+
+            tgui::Label::Ptr label = tgui::Label::create();
+            label->setRenderer(theme1.getRenderer("Button1"));
+            REQUIRE(&properties1.begin()->second == &properties2.begin()->second);
+
+            label->getSharedRenderer()->setTextColor(tgui::Color::Blue);
+            REQUIRE(&properties1.begin()->second != &properties2.begin()->second);
+            REQUIRE(tgui::ObjectConverter{properties1.find("TextColor")->second}.getColor() == tgui::Color::Blue);
+            REQUIRE(tgui::ObjectConverter{properties2.find("TextColor")->second}.getColor() == tgui::Color::Red);
+        }
+
+        SECTION("Deserializing a property doesn't change the properties of other themes")
+        {
+            tgui::Theme theme1("resources/Black.txt");
+            tgui::Theme theme2("resources/Black.txt");
+
+            tgui::Button::Ptr button = tgui::Button::create();
+            button->setRenderer(theme1.getRenderer("Button"));
+            REQUIRE(button->getSharedRenderer()->getTexture().getData() != nullptr);
+
+            const tgui::PropertyValueMap& properties1 = theme1.getRenderer("Button")->propertyValuePairs;
+            const tgui::PropertyValueMap& properties2 = theme2.getRenderer("Button")->propertyValuePairs;
+            REQUIRE(properties1.find("Texture")->second.getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(properties2.find("Texture")->second.getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(tgui::Theme("resources/Black.txt").getRenderer("Button")->propertyValuePairs.find("Texture")->second.getType()
+                    == tgui::ObjectConverter::Type::String);
+        }
     }
 
     SECTION("Adding and removing renderers")
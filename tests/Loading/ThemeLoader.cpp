@@ -111,6 +111,34 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["ListBox"] == "{\nBackgroundColor = Cyan;\n\nScrollbar {\n    TrackColor = Black;\n}\n}");
     }
 
+    SECTION("load properties")
+    {
+        auto properties = loader->loadProperties("resources/ThemeSpecialCases.txt", "Button1");
+        REQUIRE(properties == loader->loadProperties("resources/ThemeSpecialCases.txt", "Button1"));
+        REQUIRE(properties->size() == 1);
+        REQUIRE(properties->find("TextColor")->second.getType() == tgui::ObjectConverter::Type::Color);
+
+        // Nested sections and references are already deserialized
+        properties = loader->loadProperties("resources/ThemeNested.txt", "ComboBox4");
+        REQUIRE(properties->size() == 1);
+        auto listBoxProperties = properties->find("ListBox")->second;
+        REQUIRE(listBoxProperties.getType() == tgui::ObjectConverter::Type::RendererData);
+        auto& listBoxPairs = listBoxProperties.getRenderer()->propertyValuePairs;
+        REQUIRE(listBoxPairs.size() == 2);
+        REQUIRE(listBoxPairs["BackgroundColor"].getType() == tgui::ObjectConverter::Type::String); // Type isn't known yet
+        REQUIRE(listBoxPairs["BackgroundColor"].getColor() == tgui::Color::Magenta);
+        REQUIRE(listBoxPairs["Scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(listBoxPairs["Scrollbar"].getRenderer()->propertyValuePairs["ThumbColor"].getColor() == tgui::Color::Green);
+
+        properties = loader->loadProperties("resources/ThemeNested.txt", "ComboBox5");
+        listBoxProperties = properties->find("ListBox")->second;
+        REQUIRE(listBoxProperties.getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(listBoxProperties.getRenderer()->propertyValuePairs["Scrollbar"].getRenderer()
+                ->propertyValuePairs["TrackColor"].getColor() == tgui::Color::Black);
+
+        REQUIRE_THROWS_AS(loader->loadProperties("resources/Black.txt", "NonexistentClassName"), tgui::Exception);
+    }
+
     SECTION("cache")
     {
         REQUIRE(loader->getPropertiesCache().size() == 0);
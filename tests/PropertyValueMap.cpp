@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/PropertyValueMap.hpp>
+
+TEST_CASE("[PropertyValueMap]")
+{
+    SECTION("PropertyId")
+    {
+        REQUIRE(tgui::getPropertyId("TextColor") != tgui::getPropertyId("TextColorHover"));
+        REQUIRE(tgui::getPropertyId(tgui::String("TextColor")) == tgui::getPropertyId("TextColor"));
+        REQUIRE(tgui::getPropertyId(tgui::String(U"été")) == tgui::getPropertyId("\xc3\xa9t\xc3\xa9"));
+    }
+
+    SECTION("Insert and find")
+    {
+        tgui::PropertyValueMap map;
+        REQUIRE(map.empty());
+        REQUIRE(map.find("TextColor") == map.end());
+
+        map["TextColor"] = tgui::Color::Red;
+        map["BackgroundColor"] = tgui::Color::Green;
+        map["Borders"] = tgui::Outline{2};
+        REQUIRE(map.size() == 3);
+        REQUIRE(map.count("TextColor") == 1);
+        REQUIRE(map.count("TextColorHover") == 0);
+
+        REQUIRE(map.find("TextColor") != map.end());
+        REQUIRE(map.find("TextColor")->second.getColor() == tgui::Color::Red);
+        REQUIRE(map.find(tgui::getPropertyId("BackgroundColor"), "BackgroundColor")->second.getColor() == tgui::Color::Green);
+        REQUIRE(map.find(tgui::getPropertyId("Padding"), "Padding") == map.end());
+
+        // Properties are iterated in alphabetical order
+        auto it = map.begin();
+        REQUIRE(it->first == "BackgroundColor");
+        REQUIRE((++it)->first == "Borders");
+        REQUIRE((++it)->first == "TextColor");
+        REQUIRE(++it == map.end());
+    }
+
+    SECTION("Erase")
+    {
+        tgui::PropertyValueMap map{{"TextColor", tgui::Color::Red}, {"BackgroundColor", tgui::Color::Green}};
+        REQUIRE(map.erase("TextColor") == 1);
+        REQUIRE(map.erase("TextColor") == 0);
+        REQUIRE(map.find("TextColor") == map.end());
+        REQUIRE(map.size() == 1);
+
+        map.erase(map.begin());
+        REQUIRE(map.empty());
+        REQUIRE(map.find("BackgroundColor") == map.end());
+    }
+
+    SECTION("Copy")
+    {
+        tgui::PropertyValueMap map{{"TextColor", tgui::Color::Red}};
+        tgui::PropertyValueMap copy = map;
+        map["TextColor"] = tgui::Color::Blue;
+        REQUIRE(copy.find("TextColor")->second.getColor() == tgui::Color::Red);
+        REQUIRE(map.find("TextColor")->second.getColor() == tgui::Color::Blue);
+
+        copy.erase("TextColor");
+        REQUIRE(map.find("TextColor") != map.end());
+    }
+
+    SECTION("Copies share their values until they are changed")
+    {
+        const tgui::PropertyValueMap map{{"TextColor", tgui::Color::Red}, {"BackgroundColor", tgui::Color::Green}};
+        tgui::PropertyValueMap copy = map;
+        const tgui::PropertyValueMap& constCopy = copy;
+        REQUIRE(&constCopy.find("TextColor")->second == &map.find("TextColor")->second);
+        REQUIRE(tgui::ObjectConverter{constCopy.find("TextColor")->second}.getColor() == tgui::Color::Red);
+
+        copy["TextColor"] = tgui::Color::Blue;
+        REQUIRE(&constCopy.find("BackgroundColor")->second != &map.find("BackgroundColor")->second);
+        REQUIRE(tgui::ObjectConverter{map.find("TextColor")->second}.getColor() == tgui::Color::Red);
+
+        // Erasing with an iterator to the shared values
+        tgui::PropertyValueMap copy2 = map;
+        const tgui::PropertyValueMap& constCopy2 = copy2;
+        copy2.erase(constCopy2.find("TextColor"));
+        REQUIRE(copy2.size() == 1);
+        REQUIRE(map.size() == 2);
+    }
+
+    SECTION("References remain valid after copying")
+    {
+        tgui::PropertyValueMap map{{"TextColor", tgui::Color::Red}};
+        tgui::ObjectConverter& value = map["TextColor"];
+        const tgui::PropertyValueMap copy = map;
+        value = tgui::Color::Blue;
+        REQUIRE(tgui::ObjectConverter{copy.find("TextColor")->second}.getColor() == tgui::Color::Red);
+        REQUIRE(map.find("TextColor")->second.getColor() == tgui::Color::Blue);
+    }
+}
@@ -130,6 +130,39 @@ TEST_CASE("[Signal]")
         REQUIRE(i == 4);
     }
 
+    SECTION("Changing handlers while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        unsigned int id2 = 0;
+        widget->onPositionChange([&](){
+            count1++;
+            widget->onPositionChange.disconnect(id2);
+            widget->onPositionChange([&](){ count3++; });
+        });
+        id2 = widget->onPositionChange([&](){ count2++; });
+
+        // Disconnected handlers are no longer called, new handlers are only called on the next emit
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 2);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 1);
+
+        unsigned int nestedCount = 0;
+        widget->onSizeChange([&](){
+            if (++nestedCount < 3)
+                widget->setSize(widget->getSize() + tgui::Vector2f{1, 1});
+        });
+        widget->setSize(100, 50);
+        REQUIRE(nestedCount == 3);
+    }
+
     SECTION("Reference")
     {
         tgui::Signal signal{"Test"};
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Sprite.hpp>
+#include <TGUI/TextureManager.hpp>
 
 TEST_CASE("[Sprite]")
 {
@@ -500,4 +501,57 @@ TEST_CASE("[Sprite]")
             REQUIRE(sprite.getScalingType() == tgui::Sprite::ScalingType::NineSlice);
         }
     }
+
+    SECTION("Svg textures are shared")
+    {
+        tgui::TextureManager::clearSvgTextureCache();
+
+        tgui::Sprite sprite1{{"resources/SFML.svg"}};
+        tgui::Sprite sprite2{{"resources/SFML.svg"}};
+        REQUIRE(sprite1.getSvgTexture() != nullptr);
+        REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+        REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u(130, 130));
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 1);
+
+        // Copies share the texture as well
+        tgui::Sprite sprite3 = sprite1;
+        REQUIRE(sprite3.getSvgTexture() == sprite1.getSvgTexture());
+
+        // Small size changes directly after each other reuse the existing texture until the resize settles
+        const tgui::Duration oldSettleTime = tgui::Sprite::getSvgResizeSettleTime();
+        tgui::Sprite::setSvgResizeSettleTime(std::chrono::hours(1));
+        REQUIRE(tgui::Sprite::getSvgResizeSettleTime() == std::chrono::hours(1));
+        sprite1.setSize({120, 120});
+        REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+        sprite1.setSize({110, 110});
+        REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 1);
+
+        // Once the resize has settled, the svg is rasterized at the exact size
+        tgui::Sprite::setSvgResizeSettleTime(0);
+        REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u(110, 110));
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 2);
+        tgui::Sprite::setSvgResizeSettleTime(oldSettleTime);
+
+        // A size that differs too much is rasterized immediately
+        sprite1.setSize({40, 30});
+        REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u(40, 30));
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 3);
+
+        // Sprites with the same size use the cached texture
+        sprite2.setSize({40, 30});
+        REQUIRE(sprite2.getSvgTexture() == sprite1.getSvgTexture());
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 3);
+
+        // Least recently used textures are removed when the cache is full, sprites keep using their texture
+        const std::size_t oldCacheSize = tgui::TextureManager::getSvgTextureCacheSize();
+        tgui::TextureManager::setSvgTextureCacheSize(1);
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 1);
+        REQUIRE(sprite3.getSvgTexture()->getSize() == tgui::Vector2u(130, 130));
+        tgui::TextureManager::setSvgTextureCacheSize(oldCacheSize);
+
+        tgui::TextureManager::clearSvgTextureCache();
+        REQUIRE(tgui::TextureManager::getCachedSvgTexturesCount() == 0);
+        REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u(40, 30));
+    }
 }
@@ -26,6 +26,8 @@
 #include <TGUI/SvgImage.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Widgets/Picture.hpp>
+#include <algorithm>
+#include <cstdlib>
 
 TEST_CASE("[SvgImage]")
 {
@@ -53,6 +55,48 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Parallel rasterization")
+    {
+        tgui::SvgImage svgImage{"resources/SFML.svg"};
+        const unsigned int oldThreadCount = tgui::SvgImage::getMaxRasterizeThreads();
+
+        tgui::SvgImage::setMaxRasterizeThreads(1);
+        REQUIRE(tgui::SvgImage::getMaxRasterizeThreads() == 1);
+        auto texture1 = tgui::getBackend()->createTexture();
+        svgImage.rasterize(*texture1, tgui::Vector2u{600, 450});
+
+        tgui::SvgImage::setMaxRasterizeThreads(4);
+        REQUIRE(tgui::SvgImage::getMaxRasterizeThreads() == 4);
+        auto texture2 = tgui::getBackend()->createTexture();
+        svgImage.rasterize(*texture2, tgui::Vector2u{600, 450});
+
+        // Workers that were stopped are started again by the next rasterization
+        tgui::SvgImage::stopRasterizeThreads();
+        auto texture3 = tgui::getBackend()->createTexture();
+        svgImage.rasterize(*texture3, tgui::Vector2u{600, 450});
+        REQUIRE(texture3->getSize() == tgui::Vector2u{600, 450});
+
+        tgui::SvgImage::setMaxRasterizeThreads(oldThreadCount);
+
+        // The visible pixels should be the same. Transparent pixels get the color of their neighbours, which may differ
+        // at the edges of the bands because the neighbours lie in another band.
+        REQUIRE(texture2->getSize() == tgui::Vector2u{600, 450});
+        const std::uint8_t* pixels1 = texture1->getPixels();
+        const std::uint8_t* pixels2 = texture2->getPixels();
+        REQUIRE(pixels1 != nullptr);
+        REQUIRE(pixels2 != nullptr);
+        int maxDifference = 0;
+        for (std::size_t i = 0; i < 600 * 450 * 4; i += 4)
+        {
+            if ((pixels1[i + 3] == 0) && (pixels2[i + 3] == 0))
+                continue;
+
+            for (std::size_t c = 0; c < 4; ++c)
+                maxDifference = std::max(maxDifference, std::abs(pixels1[i + c] - pixels2[i + c]));
+        }
+        REQUIRE(maxDifference <= 1);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
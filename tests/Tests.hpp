@@ -193,6 +193,8 @@ public:
 
     void draw() {}
     void mainLoop(tgui::Color = {240, 240, 240}) {}
+
+    using tgui::BackendGui::getMainLoopWaitTime;
 };
 
 extern tgui::BackendGui* globalGui;
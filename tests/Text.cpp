@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <algorithm>
 
 TEST_CASE("[Text]")
 {
@@ -139,4 +140,22 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("WordWrap")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        const float wordWidth = tgui::Text::getLineWidth("Lorem", font, 20);
+        REQUIRE(wordWidth > 0);
+        REQUIRE(tgui::Text::getLineWidth("Lorem ipsum", font, 20) > wordWidth);
+
+        // Words that fit are kept together, the repeated measurement must give the same result
+        REQUIRE(tgui::Text::wordWrap(wordWidth * 1.5f, "Lorem Lorem Lorem", font, 20, false) == "Lorem\nLorem\nLorem");
+        REQUIRE(tgui::Text::wordWrap(wordWidth * 1.5f, "Lorem Lorem Lorem", font, 20, false) == "Lorem\nLorem\nLorem");
+        REQUIRE(tgui::Text::wordWrap(wordWidth * 3, "Lorem Lorem Lorem", font, 20, false) == "Lorem Lorem\nLorem");
+
+        // A word that is too long is split over multiple lines
+        const tgui::String wrapped = tgui::Text::wordWrap(wordWidth + 1, "LoremLoremLorem", font, 20, false);
+        REQUIRE(std::count(wrapped.begin(), wrapped.end(), U'\n') == 2);
+        REQUIRE(wrapped.substr(0, 5) == "Lorem");
+    }
 }
@@ -26,8 +26,25 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+#include <TGUI/Filesystem.hpp>
+#include <cstring>
+#include <cstdio>
+#include <vector>
 #include <TGUI/Backend/Window/Backend.hpp>
 
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3
+    #include <TGUI/Backend/Renderer/OpenGL3/BackendRendererOpenGL3.hpp>
+    #include <TGUI/Backend/Renderer/OpenGL3/BackendTextureOpenGL3.hpp>
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_GLES2
+    #include <TGUI/Backend/Renderer/GLES2/BackendRendererGLES2.hpp>
+    #include <TGUI/Backend/Renderer/GLES2/BackendTextureGLES2.hpp>
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3 || TGUI_HAS_RENDERER_BACKEND_GLES2
+    #include <TGUI/Backend/Renderer/OpenGL.hpp>
+#endif
+
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
     #include <SFML/Graphics/Shader.hpp>
     #include <TGUI/Backend/Renderer/SFML-Graphics/BackendRendererSFML.hpp>
@@ -276,4 +293,251 @@ TEST_CASE("[Texture]")
 
         tgui::Texture::setTextureLoader(oldTextureLoader);
     }
+
+    SECTION("PixelStorage")
+    {
+        REQUIRE(tgui::BackendTexture::getPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+
+        tgui::Vector2u imageSize;
+        auto pixels = tgui::ImageLoader::loadFromFile("resources/TransparentParts.png", imageSize);
+        REQUIRE(pixels != nullptr);
+
+        tgui::BackendTexture::setPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+        REQUIRE(tgui::BackendTexture::getPixelStorage() == tgui::BackendTexture::PixelStorage::AlphaMask);
+        tgui::BackendTexture maskTexture;
+        REQUIRE(maskTexture.load(imageSize, tgui::ImageLoader::loadFromFile("resources/TransparentParts.png", imageSize), true));
+        tgui::BackendTexture::setPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+
+        // Only the transparency of the pixels is remembered
+        REQUIRE(maskTexture.getPixels() == nullptr);
+        for (unsigned int y = 0; y < imageSize.y; ++y)
+        {
+            for (unsigned int x = 0; x < imageSize.x; ++x)
+            {
+                if (maskTexture.isTransparentPixel({x, y}) != (pixels[((y * imageSize.x + x) * 4) + 3] == 0))
+                    FAIL("Transparency of pixel (" << x << "," << y << ") differs");
+            }
+        }
+    }
+
+    SECTION("Disk cache")
+    {
+        REQUIRE(tgui::ImageLoader::getDiskCacheDirectory().empty());
+
+        tgui::Vector2u imageSize;
+        const auto pixels = tgui::ImageLoader::loadFromFile("resources/image.png", imageSize);
+        REQUIRE(pixels != nullptr);
+
+        tgui::ImageLoader::setDiskCacheDirectory("ImageCache");
+        REQUIRE(tgui::ImageLoader::getDiskCacheDirectory() == "ImageCache");
+        REQUIRE(tgui::Filesystem::directoryExists("ImageCache"));
+
+        const std::size_t pixelDataSize = imageSize.x * imageSize.y * 4;
+        const auto loadCachedImage = [&](std::vector<std::uint8_t>& loadedPixels){
+            tgui::Vector2u cachedImageSize;
+            const auto cachedPixels = tgui::ImageLoader::loadFromFile("resources/image.png", cachedImageSize);
+            REQUIRE(cachedPixels != nullptr);
+            REQUIRE(cachedImageSize == imageSize);
+            loadedPixels.assign(cachedPixels.get(), cachedPixels.get() + pixelDataSize);
+        };
+
+        // The first load writes the decoded image to the cache
+        std::vector<std::uint8_t> loadedPixels;
+        loadCachedImage(loadedPixels);
+        REQUIRE(std::memcmp(loadedPixels.data(), pixels.get(), pixelDataSize) == 0);
+
+        const auto cachedFiles = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("ImageCache"));
+        REQUIRE(cachedFiles.size() == 1);
+        const std::string cachedFilename = cachedFiles[0].path.asString().toStdString();
+
+        std::vector<std::uint8_t> cachedFileContents;
+        {
+            FILE* file = std::fopen(cachedFilename.c_str(), "rb");
+            REQUIRE(file != nullptr);
+            std::uint8_t buffer[4096];
+            std::size_t bytesRead;
+            while ((bytesRead = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+                cachedFileContents.insert(cachedFileContents.end(), buffer, buffer + bytesRead);
+            std::fclose(file);
+        }
+        REQUIRE(cachedFileContents.size() > pixelDataSize);
+
+        const auto writeCachedFile = [&](const std::vector<std::uint8_t>& contents){
+            FILE* file = std::fopen(cachedFilename.c_str(), "wb");
+            REQUIRE(file != nullptr);
+            REQUIRE(std::fwrite(contents.data(), 1, contents.size(), file) == contents.size());
+            std::fclose(file);
+        };
+
+        // The second load reads the pixels from the cache, so changing the pixels in the file changes the loaded image
+        auto corruptedContents = cachedFileContents;
+        const std::size_t pixelDataOffset = cachedFileContents.size() - pixelDataSize;
+        corruptedContents[pixelDataOffset] = static_cast<std::uint8_t>(~corruptedContents[pixelDataOffset]);
+        writeCachedFile(corruptedContents);
+
+        loadCachedImage(loadedPixels);
+        REQUIRE(loadedPixels[0] == corruptedContents[pixelDataOffset]);
+        REQUIRE(loadedPixels[0] != pixels[0]);
+        REQUIRE(std::memcmp(loadedPixels.data() + 1, pixels.get() + 1, pixelDataSize - 1) == 0);
+
+        // A truncated cache file is ignored and gets replaced by a complete one
+        writeCachedFile(std::vector<std::uint8_t>(cachedFileContents.begin(), cachedFileContents.end() - 4));
+
+        loadCachedImage(loadedPixels);
+        REQUIRE(std::memcmp(loadedPixels.data(), pixels.get(), pixelDataSize) == 0);
+        const auto rewrittenFiles = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("ImageCache"));
+        REQUIRE(rewrittenFiles.size() == 1);
+        REQUIRE(rewrittenFiles[0].fileSize == cachedFileContents.size());
+
+        // A header claiming a larger image than what the file contains is ignored as well
+        auto oversizedContents = cachedFileContents;
+        oversizedContents[pixelDataOffset - 8] = 0xFF;
+        oversizedContents[pixelDataOffset - 7] = 0xFF;
+        writeCachedFile(oversizedContents);
+
+        loadCachedImage(loadedPixels);
+        REQUIRE(std::memcmp(loadedPixels.data(), pixels.get(), pixelDataSize) == 0);
+
+        tgui::ImageLoader::setDiskCacheDirectory("");
+        REQUIRE(tgui::ImageLoader::getDiskCacheDirectory().empty());
+
+        for (const auto& file : tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("ImageCache")))
+            std::remove(file.path.asString().toStdString().c_str());
+        std::remove("ImageCache");
+    }
+
+    SECTION("Mipmaps")
+    {
+        REQUIRE(!tgui::BackendTexture::getMipmapsEnabled());
+
+        tgui::BackendTexture::setMipmapsEnabled(true);
+        REQUIRE(tgui::BackendTexture::getMipmapsEnabled());
+
+        // The size is a power of two, so that GLES2 can also create mipmaps for it
+        const std::vector<std::uint8_t> pixels(64 * 64 * 4, 255);
+        tgui::Texture smoothTexture;
+        smoothTexture.loadFromPixelData({64, 64}, pixels.data(), {}, {}, true);
+        REQUIRE(smoothTexture.isSmooth());
+
+        tgui::Texture nonSmoothTexture;
+        nonSmoothTexture.loadFromPixelData({64, 64}, pixels.data(), {}, {}, false);
+        REQUIRE(!nonSmoothTexture.isSmooth());
+
+        tgui::BackendTexture::setMipmapsEnabled(false);
+        REQUIRE(!tgui::BackendTexture::getMipmapsEnabled());
+
+        tgui::Texture textureWithoutMipmaps;
+        textureWithoutMipmaps.loadFromPixelData({64, 64}, pixels.data(), {}, {}, true);
+
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3 || TGUI_HAS_RENDERER_BACKEND_GLES2
+        const auto getMinFilter = [](unsigned int textureId){
+            GLint minFilter = 0;
+            glBindTexture(GL_TEXTURE_2D, textureId);
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &minFilter);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            return minFilter;
+        };
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3
+        if (std::dynamic_pointer_cast<tgui::BackendRendererOpenGL3>(tgui::getBackend()->getRenderer()))
+        {
+            const auto smoothBackendTexture = std::static_pointer_cast<tgui::BackendTextureOpenGL3>(smoothTexture.getData()->backendTexture);
+            REQUIRE(smoothBackendTexture->hasMipmaps());
+            REQUIRE(getMinFilter(smoothBackendTexture->getInternalTexture()) == GL_LINEAR_MIPMAP_LINEAR);
+
+            const auto nonSmoothBackendTexture = std::static_pointer_cast<tgui::BackendTextureOpenGL3>(nonSmoothTexture.getData()->backendTexture);
+            REQUIRE(!nonSmoothBackendTexture->hasMipmaps());
+            REQUIRE(getMinFilter(nonSmoothBackendTexture->getInternalTexture()) == GL_NEAREST);
+
+            const auto backendTextureWithoutMipmaps = std::static_pointer_cast<tgui::BackendTextureOpenGL3>(textureWithoutMipmaps.getData()->backendTexture);
+            REQUIRE(!backendTextureWithoutMipmaps->hasMipmaps());
+            REQUIRE(getMinFilter(backendTextureWithoutMipmaps->getInternalTexture()) == GL_LINEAR);
+
+            // Disabling the smooth filter also stops the mipmaps from being used
+            smoothBackendTexture->setSmooth(false);
+            REQUIRE(getMinFilter(smoothBackendTexture->getInternalTexture()) == GL_NEAREST);
+        }
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_GLES2
+        if (std::dynamic_pointer_cast<tgui::BackendRendererGLES2>(tgui::getBackend()->getRenderer()))
+        {
+            const auto smoothBackendTexture = std::static_pointer_cast<tgui::BackendTextureGLES2>(smoothTexture.getData()->backendTexture);
+            REQUIRE(smoothBackendTexture->hasMipmaps());
+            REQUIRE(getMinFilter(smoothBackendTexture->getInternalTexture()) == GL_LINEAR_MIPMAP_LINEAR);
+
+            const auto nonSmoothBackendTexture = std::static_pointer_cast<tgui::BackendTextureGLES2>(nonSmoothTexture.getData()->backendTexture);
+            REQUIRE(!nonSmoothBackendTexture->hasMipmaps());
+            REQUIRE(getMinFilter(nonSmoothBackendTexture->getInternalTexture()) == GL_NEAREST);
+
+            const auto backendTextureWithoutMipmaps = std::static_pointer_cast<tgui::BackendTextureGLES2>(textureWithoutMipmaps.getData()->backendTexture);
+            REQUIRE(!backendTextureWithoutMipmaps->hasMipmaps());
+            REQUIRE(getMinFilter(backendTextureWithoutMipmaps->getInternalTexture()) == GL_LINEAR);
+        }
+#endif
+    }
+
+    SECTION("Compressed textures")
+    {
+        // KTX2 file containing an 8x8 BC3 image with a complete mipmap chain
+        const auto createKtx2File = [](std::uint32_t vkFormat, std::uint32_t supercompressionScheme, std::uint64_t firstLevelLength){
+            const std::uint32_t header[] = {vkFormat, 1, 8, 8, 0, 0, 1, 4, supercompressionScheme, 0, 0, 0, 0, 0, 0, 0, 0};
+            const std::uint64_t levelLengths[] = {firstLevelLength, 16, 16, 16};
+
+            std::vector<std::uint8_t> data = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+            for (const std::uint32_t value : header)
+            {
+                for (unsigned int i = 0; i < 4; ++i)
+                    data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+            }
+
+            std::uint64_t offset = 80 + 4 * 24;
+            for (const std::uint64_t length : levelLengths)
+            {
+                for (const std::uint64_t value : {offset, length, length})
+                {
+                    for (unsigned int i = 0; i < 8; ++i)
+                        data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+                }
+                offset += length;
+            }
+
+            for (unsigned int i = 0; i < 64 + 16 + 16 + 16; ++i)
+                data.push_back(static_cast<std::uint8_t>(i));
+
+            return data;
+        };
+
+        const auto fileData = createKtx2File(137, 0, 64);
+        REQUIRE(tgui::ImageLoader::isCompressedTexture(fileData.data(), fileData.size()));
+
+        tgui::BackendTexture::CompressedImage image;
+        REQUIRE(tgui::ImageLoader::loadCompressedFromMemory(fileData.data(), fileData.size(), image));
+        REQUIRE(image.format == tgui::BackendTexture::CompressedFormat::BC3);
+        REQUIRE(image.size == tgui::Vector2u{8, 8});
+        REQUIRE(image.levels.size() == 4);
+        REQUIRE(image.levels[0].data == fileData.data() + 176);
+        REQUIRE(image.levels[0].dataSize == 64);
+        REQUIRE(image.levels[3].data == fileData.data() + 176 + 64 + 16 + 16);
+        REQUIRE(image.levels[3].dataSize == 16);
+
+        // The base class doesn't know how to upload compressed data
+        tgui::BackendTexture backendTexture;
+        REQUIRE(!backendTexture.loadCompressed(image, true));
+
+        // Unsupported formats, supercompressed data and levels with a wrong size are rejected
+        const auto uncompressedFileData = createKtx2File(37, 0, 64);
+        REQUIRE(!tgui::ImageLoader::loadCompressedFromMemory(uncompressedFileData.data(), uncompressedFileData.size(), image));
+        const auto supercompressedFileData = createKtx2File(137, 2, 64);
+        REQUIRE(!tgui::ImageLoader::loadCompressedFromMemory(supercompressedFileData.data(), supercompressedFileData.size(), image));
+        const auto invalidFileData = createKtx2File(137, 0, 32);
+        REQUIRE(!tgui::ImageLoader::loadCompressedFromMemory(invalidFileData.data(), invalidFileData.size(), image));
+        REQUIRE(!tgui::ImageLoader::loadCompressedFromMemory(fileData.data(), 100, image));
+
+        tgui::Texture texture;
+        REQUIRE_THROWS_AS(texture.loadFromMemory(invalidFileData.data(), invalidFileData.size()), tgui::Exception);
+
+        std::size_t pngFileSize;
+        const auto pngFileData = tgui::readFileToMemory("resources/image.png", pngFileSize);
+        REQUIRE(!tgui::ImageLoader::isCompressedTexture(pngFileData.get(), pngFileSize));
+    }
 }
@@ -26,6 +26,7 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <thread>
 
 TEST_CASE("[TextureManager]")
 {
@@ -55,4 +56,79 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    // Copies of the same texture share a single image, which is released when the last copy is destroyed
+    const std::size_t imagesCount = tgui::TextureManager::getCachedImagesCount();
+    {
+        std::vector<tgui::Texture> textures(1000, tgui::Texture{"resources/image.png"});
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == imagesCount + 1);
+
+        textures.resize(10);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == imagesCount + 1);
+    }
+    REQUIRE(tgui::TextureManager::getCachedImagesCount() == imagesCount);
+
+    // Images can be decoded in the background, requests for the same file share the work
+    std::shared_ptr<tgui::TextureData> asyncData[4];
+    bool asyncDataLoaded[4] = {false, false, false, false};
+    const auto requestTexture = [&](unsigned int index, const tgui::String& filename, bool smooth){
+        tgui::TextureManager::getTextureAsync(filename, smooth, [&asyncData,&asyncDataLoaded,index](std::shared_ptr<tgui::TextureData> data){
+            asyncData[index] = data;
+            asyncDataLoaded[index] = true;
+        });
+    };
+    requestTexture(0, "resources/image.png", true);
+    requestTexture(1, "resources/image.png", false);
+    requestTexture(2, "resources/image.png", true);
+    requestTexture(3, "NonExistent.png", true);
+    REQUIRE(tgui::TextureManager::hasPendingAsyncLoads());
+
+    while (tgui::TextureManager::hasPendingAsyncLoads())
+    {
+        tgui::TextureManager::processAsyncLoads();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    REQUIRE(asyncDataLoaded[0]);
+    REQUIRE(asyncDataLoaded[1]);
+    REQUIRE(asyncDataLoaded[2]);
+    REQUIRE(asyncDataLoaded[3]);
+    REQUIRE(asyncData[0] != nullptr);
+    REQUIRE(asyncData[1] != nullptr);
+    REQUIRE(asyncData[0] == asyncData[2]);
+    REQUIRE(asyncData[0] != asyncData[1]);
+    REQUIRE(asyncData[3] == nullptr);
+    REQUIRE(tgui::TextureManager::getCachedImagesCount() == imagesCount + 1);
+
+    // The loaded texture is reused for the next request
+    std::shared_ptr<tgui::TextureData> reusedData;
+    tgui::TextureManager::getTextureAsync("resources/image.png", false, [&reusedData](std::shared_ptr<tgui::TextureData> data){ reusedData = data; });
+    REQUIRE(!tgui::TextureManager::hasPendingAsyncLoads());
+    REQUIRE(reusedData == asyncData[1]);
+
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(asyncData[0]));
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(asyncData[1]));
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(asyncData[2]));
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(reusedData));
+    REQUIRE(tgui::TextureManager::getCachedImagesCount() == imagesCount);
+
+    // Stopping the worker threads cancels the pending requests, new requests start the workers again
+    bool cancelledCallbackCalled = false;
+    tgui::TextureManager::getTextureAsync("resources/image.png", true, [&cancelledCallbackCalled](std::shared_ptr<tgui::TextureData>){ cancelledCallbackCalled = true; });
+    tgui::TextureManager::stopAsyncLoads();
+    REQUIRE(!tgui::TextureManager::hasPendingAsyncLoads());
+    REQUIRE(!tgui::TextureManager::processAsyncLoads());
+    REQUIRE(!cancelledCallbackCalled);
+
+    asyncDataLoaded[0] = false;
+    requestTexture(0, "resources/image.png", true);
+    while (tgui::TextureManager::hasPendingAsyncLoads())
+    {
+        tgui::TextureManager::processAsyncLoads();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(asyncDataLoaded[0]);
+    REQUIRE(asyncData[0] != nullptr);
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(asyncData[0]));
+    REQUIRE(!cancelledCallbackCalled);
 }
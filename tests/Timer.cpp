@@ -141,6 +141,37 @@ TEST_CASE("[Timer]")
         }
     }
 
+    SECTION("Changing timers from callback")
+    {
+        SECTION("Scheduling from callback")
+        {
+            // A callback that is scheduled from within a callback is only executed on the next update
+            tgui::Timer::scheduleCallback([&]{ ++count; tgui::Timer::scheduleCallback(callback); });
+            tgui::Timer::updateTime(tgui::Duration());
+            REQUIRE(count == 1);
+            tgui::Timer::updateTime(tgui::Duration());
+            REQUIRE(count == 2);
+        }
+
+        SECTION("Stopping timers")
+        {
+            auto timer1 = tgui::Timer::create([&](std::shared_ptr<tgui::Timer> timer){ ++count; timer->setEnabled(false); }, 100);
+            auto timer2 = tgui::Timer::create(callback, 300);
+            auto timer3 = tgui::Timer::create([&]{ ++count; timer2->setEnabled(false); }, 200);
+
+            tgui::Timer::updateTime(std::chrono::milliseconds(250));
+            REQUIRE(count == 2);
+            REQUIRE(!timer1->isEnabled());
+            REQUIRE(!timer2->isEnabled());
+
+            tgui::Timer::updateTime(std::chrono::milliseconds(500));
+            REQUIRE(count == 3); // Only timer3 was still running
+
+            timer3->setEnabled(false);
+            REQUIRE(!tgui::Timer::getNextScheduledTime());
+        }
+    }
+
     SECTION("getNextScheduledTime")
     {
         tgui::Optional<tgui::Duration> duration;
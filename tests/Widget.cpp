@@ -444,6 +444,37 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["Font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Batched updates")
+        {
+            auto data = tgui::RendererData::create();
+            tgui::WidgetRenderer batchRenderer{data};
+
+            unsigned int singleCount = 0;
+            std::vector<std::vector<tgui::String>> batches;
+            batchRenderer.subscribe(&singleCount, [&](const tgui::String&){ ++singleCount; },
+                                    [&](const std::vector<tgui::String>& properties){ batches.push_back(properties); });
+
+            // Without beginUpdate, each property change is reported separately
+            batchRenderer.setOpacity(0.5f);
+            REQUIRE(singleCount == 1);
+            REQUIRE(batches.empty());
+
+            data->beginUpdate();
+            batchRenderer.setOpacity(0.7f);
+            batchRenderer.setTextSize(20);
+            data->beginUpdate();
+            batchRenderer.setOpacity(0.8f);
+            data->endUpdate();
+            REQUIRE(batches.empty());
+            REQUIRE(batchRenderer.getOpacity() == 0.8f);
+            data->endUpdate();
+            REQUIRE(singleCount == 1);
+            REQUIRE(batches.size() == 1);
+            REQUIRE(batches[0] == std::vector<tgui::String>{"Opacity", "TextSize"});
+
+            batchRenderer.unsubscribe(&singleCount);
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/FileDialog.hpp>
 #include <TGUI/FileDialogIconLoader.hpp>
+#include <thread>
 
 TEST_CASE("[FileDialog]")
 {
@@ -137,6 +138,29 @@ TEST_CASE("[FileDialog]")
         REQUIRE(dialog->getIconLoader() == iconLoader);
     }
 
+    SECTION("Time updates")
+    {
+        // The default icon loader doesn't start threads, so only the directory listing is done in the background
+        class CustomIconLoader : public tgui::FileDialogIconLoader {};
+        dialog->setIconLoader(std::make_shared<CustomIconLoader>());
+        tgui::Filesystem::clearDirectoryListingCache();
+
+        GuiNull gui;
+        gui.add(dialog);
+        dialog->setPath("resources");
+
+        // While the files are being listed, the dialog regularly checks whether new files were found
+        REQUIRE(gui.getMainLoopWaitTime(false, {}));
+
+        // Once all files are shown, the dialog no longer wakes up the main loop
+        for (unsigned int i = 0; (i < 500) && gui.getMainLoopWaitTime(false, {}); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            gui.updateTime(std::chrono::milliseconds(10));
+        }
+        REQUIRE(!gui.getMainLoopWaitTime(false, {}));
+    }
+
     testWidgetRenderer(dialog->getRenderer());
     SECTION("Renderer")
     {
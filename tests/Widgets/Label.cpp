@@ -59,6 +59,15 @@ TEST_CASE("[Label]")
         REQUIRE(label->getText() == "");
         label->setText("SomeText");
         REQUIRE(label->getText() == "SomeText");
+
+        // The auto-sized label has to be updated when the text changes, but not when the same text is set again
+        const tgui::Vector2f size = label->getSize();
+        label->setText("SomeText");
+        REQUIRE(label->getSize() == size);
+        label->setText("SomeText with more text");
+        REQUIRE(label->getSize().x > size.x);
+        label->setText("SomeText");
+        REQUIRE(label->getSize() == size);
     }
 
     SECTION("TextSize")
@@ -587,6 +587,44 @@ TEST_CASE("[ListBox]")
 
             REQUIRE(renderer->getTextureBackground().getData() == textureBackground.getData());
         }
+
+        SECTION("Changing multiple properties at once")
+        {
+            struct SizeCountingListBox : public tgui::ListBox
+            {
+                void setSize(const tgui::Layout2d& size) override
+                {
+                    ++setSizeCount;
+                    tgui::ListBox::setSize(size);
+                }
+
+                using tgui::ListBox::setSize;
+                unsigned int setSizeCount = 0;
+            };
+
+            auto countingListBox = std::make_shared<SizeCountingListBox>();
+            countingListBox->setSize(150, 100);
+            countingListBox->addItem("Item 1");
+            countingListBox->addItem("Item 2");
+
+            renderer = countingListBox->getRenderer();
+            countingListBox->setSizeCount = 0;
+            renderer->setBorders({1, 2, 3, 4});
+            renderer->setPadding({5, 6, 7, 8});
+            REQUIRE(countingListBox->setSizeCount == 2);
+
+            // The layout is only recalculated once when the properties are changed together
+            countingListBox->setSizeCount = 0;
+            renderer->getData()->beginUpdate();
+            renderer->setBorders({2, 3, 4, 5});
+            renderer->setPadding({6, 7, 8, 9});
+            renderer->setScrollbarWidth(20);
+            renderer->setTextColor(tgui::Color::Red);
+            renderer->setSelectedTextColor(tgui::Color::Green);
+            renderer->getData()->endUpdate();
+            REQUIRE(countingListBox->setSizeCount == 1);
+            REQUIRE(countingListBox->getSize() == tgui::Vector2f{150, 100});
+        }
     }
 
     SECTION("Saving and loading from file")
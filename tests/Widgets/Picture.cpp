@@ -25,8 +25,10 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Loading/ImageLoader.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <thread>
 
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
     #include <SFML/Graphics/Texture.hpp>
@@ -41,6 +43,9 @@ TEST_CASE("[Picture]")
     {
         picture->onDoubleClick([](){});
         picture->onDoubleClick([](tgui::Vector2f){});
+
+        picture->onTextureLoad([](){});
+        picture->onTextureLoad([](bool){});
     }
 
     SECTION("WidgetType")
@@ -76,6 +81,42 @@ TEST_CASE("[Picture]")
         REQUIRE(picture->getSize() == tgui::Vector2f(static_cast<float>(imageSize.x), static_cast<float>(imageSize.y)));
     }
 
+    SECTION("Load texture asynchronously")
+    {
+        picture = tgui::Picture::create("resources/image.png");
+
+        unsigned int loadCount = 0;
+        bool loadSucceeded = false;
+        picture->onTextureLoad([&](bool success){ ++loadCount; loadSucceeded = success; });
+
+        const auto waitForTextures = []{
+            while (tgui::TextureManager::hasPendingAsyncLoads())
+            {
+                tgui::TextureManager::processAsyncLoads();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        };
+
+        picture->loadTextureAsync("resources/Texture1.png");
+        waitForTextures();
+        REQUIRE(loadCount == 1);
+        REQUIRE(loadSucceeded);
+        REQUIRE(picture->getRenderer()->getTexture().getId() == "resources/Texture1.png");
+
+        // The previous texture remains when loading fails
+        picture->loadTextureAsync("resources/nonexistent.png");
+        waitForTextures();
+        REQUIRE(loadCount == 2);
+        REQUIRE(!loadSucceeded);
+        REQUIRE(picture->getRenderer()->getTexture().getId() == "resources/Texture1.png");
+
+        // Only the last requested texture is used
+        picture->loadTextureAsync("resources/Texture2.png");
+        picture->loadTextureAsync("resources/image.png");
+        waitForTextures();
+        REQUIRE(picture->getRenderer()->getTexture().getId() == "resources/image.png");
+    }
+
     SECTION("Position and Size")
     {
         picture->setPosition(40, 30);
@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/TabContainer.hpp>
 #include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Button.hpp>
 
 TEST_CASE("[tabContainer]")
 {
@@ -210,4 +211,32 @@ TEST_CASE("[tabContainer]")
     {
         testSavingWidget("TabContainer", tabContainer, false);
     }
+
+    SECTION("Lazy loading")
+    {
+        tabContainer->addTab("1")->add(tgui::Button::create("Button1"), "Button1");
+        tabContainer->addTab("2")->add(tgui::Button::create("Button2"), "Button2");
+        tabContainer->select(0);
+
+        auto parent = std::make_shared<GuiNull>();
+        parent->add(tabContainer, "TabContainer");
+
+        std::stringstream stream;
+        parent->saveWidgetsToStream(stream);
+
+        auto loadedParent = std::make_shared<GuiNull>();
+        tgui::Container::setLazyLoadingEnabled(true);
+        loadedParent->loadWidgetsFromStream(stream);
+        tgui::Container::setLazyLoadingEnabled(false);
+
+        // The widgets on the hidden page are only created when the page is selected
+        auto loadedTabContainer = loadedParent->get<tgui::TabContainer>("TabContainer");
+        REQUIRE(loadedTabContainer->getSelectedIndex() == 0);
+        REQUIRE(loadedTabContainer->getPanel(0)->getWidgets().size() == 1);
+        REQUIRE(loadedTabContainer->getPanel(1)->getWidgets().empty());
+
+        loadedTabContainer->select(1);
+        REQUIRE(loadedTabContainer->getPanel(1)->getWidgets().size() == 1);
+        REQUIRE(loadedTabContainer->getPanel(1)->get<tgui::Button>("Button2")->getText() == "Button2");
+    }
 }
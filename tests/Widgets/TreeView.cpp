@@ -52,6 +52,10 @@ TEST_CASE("[TreeView]")
         treeView->onRightClick([](){});
         treeView->onRightClick([](tgui::String){});
         treeView->onRightClick([](std::vector<tgui::String>){});
+
+        treeView->onItemsRequested([](){});
+        treeView->onItemsRequested([](tgui::String){});
+        treeView->onItemsRequested([](std::vector<tgui::String>){});
     }
 
     SECTION("WidgetType")
@@ -145,6 +149,31 @@ TEST_CASE("[TreeView]")
             }
         }
 
+        SECTION("Multiple items at once")
+        {
+            REQUIRE(treeView->addItems({{"Smilies", "Happy"}, {"Smilies", "Sad"}, {"Vehicles", "Parts", "Wheel"}}) == 3);
+            REQUIRE(treeView->addItems({{"Unexisting", "Sub"}, {"Smilies", "Neither"}, {}}, false) == 1);
+
+            REQUIRE(treeView->getNodes().size() == 2);
+            REQUIRE(treeView->getNodes()[0].text == "Smilies");
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 3);
+            REQUIRE(treeView->getNodes()[0].nodes[2].text == "Neither");
+            REQUIRE(treeView->getNodes()[1].nodes[0].nodes[0].text == "Wheel");
+        }
+
+        SECTION("Duplicate items")
+        {
+            REQUIRE(treeView->addItem({"Parent", "Child"}));
+            REQUIRE(treeView->addItem({"Parent", "Child"}));
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+
+            REQUIRE(treeView->removeItem({"Parent", "Child"}));
+            REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+            REQUIRE(treeView->removeItem({"Parent", "Child"}));
+            REQUIRE(treeView->getNodes().empty());
+            REQUIRE(!treeView->removeItem({"Parent", "Child"}));
+        }
+
         SECTION("Invalid calls")
         {
             treeView->addItem({"One"});
@@ -194,6 +223,39 @@ TEST_CASE("[TreeView]")
         REQUIRE(treeView->getNodes()[1].nodes[0].nodes[0].expanded);
     }
 
+    SECTION("Lazy items")
+    {
+        unsigned int requestCount = 0;
+        treeView->onItemsRequested([&](const std::vector<tgui::String>& hierarchy){
+            ++requestCount;
+            REQUIRE(hierarchy == std::vector<tgui::String>{"Root", "Lazy"});
+            treeView->addItems({{"Root", "Lazy", "Child1"}, {"Root", "Lazy", "Child2"}});
+        });
+
+        REQUIRE(treeView->addLazyItem({"Root", "Lazy"}));
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.empty());
+
+        // Expanding all items doesn't request the children of lazy items
+        treeView->expandAll();
+        REQUIRE(requestCount == 0);
+
+        treeView->expand({"Root", "Lazy"});
+        REQUIRE(requestCount == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 2);
+
+        REQUIRE(treeView->selectItem({"Root", "Lazy", "Child2"}));
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Root", "Lazy", "Child2"});
+
+        // Children are only requested once
+        treeView->collapse({"Root", "Lazy"});
+        REQUIRE(treeView->getSelectedItem().empty());
+        treeView->expand({"Root", "Lazy"});
+        REQUIRE(requestCount == 1);
+    }
+
     SECTION("Selecting items")
     {
         treeView->addItem({"Smilies", "Neither"});
@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Global.hpp>
+
+#include <fstream>
+#include <iostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Converts a form or theme file to the binary format, which can be loaded by TGUI without having to parse the text
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: tgui-compile <input file> <output file>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory(argv[1], fileSize);
+        if (!fileContents)
+        {
+            std::cerr << "Failed to open '" << argv[1] << "'." << std::endl;
+            return 1;
+        }
+
+        const auto rootNode = tgui::DataIO::parse(reinterpret_cast<const char*>(fileContents.get()), fileSize);
+
+        std::stringstream stream;
+        tgui::DataIO::emitBinary(rootNode, stream);
+
+        const std::string output = stream.str();
+        std::ofstream file{argv[2], std::ios::binary};
+        if (!file.write(output.data(), static_cast<std::streamsize>(output.size())))
+        {
+            std::cerr << "Failed to write '" << argv[2] << "'." << std::endl;
+            return 1;
+        }
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
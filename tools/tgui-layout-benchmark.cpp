@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Measures how often widgets are repositioned and resized when the form they are in is resized, both when the layouts
+// are recalculated immediately after each change and when they are recalculated in a single deferred pass (as the gui does)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int rowCount = 50;
+    const unsigned int columnCount = 100;
+
+    struct Result
+    {
+        double time;
+        unsigned long long changeCount;
+    };
+
+    // Creates a form of rows of widgets. The width of each widget depends on the size of the form, the position of each
+    // widget depends on the widget in front of it and the widget above it.
+    tgui::Group::Ptr createForm(unsigned long long& changeCount)
+    {
+        auto form = tgui::Group::create({1000, 1000});
+        for (unsigned int row = 0; row < rowCount; ++row)
+        {
+            for (unsigned int column = 0; column < columnCount; ++column)
+            {
+                auto widget = tgui::ClickableWidget::create();
+                form->add(widget, "W" + tgui::String::fromNumber(row) + "_" + tgui::String::fromNumber(column));
+
+                const tgui::String left = (column > 0) ? ("W" + tgui::String::fromNumber(row) + "_" + tgui::String::fromNumber(column - 1) + ".right + 5") : "5";
+                const tgui::String top = (row > 0) ? ("W" + tgui::String::fromNumber(row - 1) + "_" + tgui::String::fromNumber(column) + ".bottom + 5") : "5";
+                widget->setSize({"(parent.width - 5) / " + tgui::String::fromNumber(columnCount) + " - 5", "(parent.height - 5) / " + tgui::String::fromNumber(rowCount) + " - 5"});
+                widget->setPosition({left, top});
+
+                widget->onPositionChange([&changeCount]{ ++changeCount; });
+                widget->onSizeChange([&changeCount]{ ++changeCount; });
+            }
+        }
+
+        return form;
+    }
+
+    Result measureResize(bool deferred)
+    {
+        unsigned long long changeCount = 0;
+        auto form = createForm(changeCount);
+        changeCount = 0;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        if (deferred)
+            tgui::Layout::beginDeferredUpdates();
+
+        form->setSize({1500, 1200});
+
+        if (deferred)
+            tgui::Layout::endDeferredUpdates();
+
+        const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        return {time, changeCount};
+    }
+}
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Resizing a form with " << (rowCount * columnCount) << " widgets" << std::endl;
+
+    const Result immediateResult = measureResize(false);
+    std::cout << "Immediate updates: " << immediateResult.time << " ms, "
+              << immediateResult.changeCount << " position and size changes" << std::endl;
+
+    const Result deferredResult = measureResize(true);
+    std::cout << "Deferred updates: " << deferredResult.time << " ms, "
+              << deferredResult.changeCount << " position and size changes" << std::endl;
+
+    return 0;
+}
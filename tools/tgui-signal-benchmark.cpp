@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Signal.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Measures how long it takes to emit signals and verifies that emitting a signal doesn't allocate any memory.
+// The program returns a non-zero exit code when memory was allocated while the signals were being emitted.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned long long emitCount = 10000000;
+
+    std::atomic<unsigned long long> allocationCount{0};
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    struct Result
+    {
+        double time;
+        unsigned long long allocations;
+    };
+
+    template <typename EmitFunc>
+    Result measureEmits(const EmitFunc& emitFunc)
+    {
+        const unsigned long long allocationsBefore = allocationCount;
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for (unsigned long long i = 0; i < emitCount; ++i)
+            emitFunc();
+
+        const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        return {time, allocationCount - allocationsBefore};
+    }
+
+    bool printResult(const char* description, const Result& result, unsigned long long expectedCalls, unsigned long long calls)
+    {
+        std::cout << description << ": " << result.time << " ms, "
+                  << (result.time * 1000000.0 / emitCount) << " ns per emit, "
+                  << result.allocations << " allocations" << std::endl;
+
+        if (calls != expectedCalls)
+        {
+            std::cerr << "Error: expected " << expectedCalls << " handler calls but got " << calls << std::endl;
+            return false;
+        }
+        if (result.allocations != 0)
+        {
+            std::cerr << "Error: memory was allocated while emitting signals" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Emitting each signal " << emitCount << " times" << std::endl;
+
+    bool success = true;
+
+    {
+        unsigned long long calls = 0;
+        tgui::Signal signal{"Signal"};
+        signal.connect([&calls]{ ++calls; });
+        signal.connect([&calls]{ ++calls; });
+        signal.connect([&calls]{ ++calls; });
+        const Result result = measureEmits([&signal]{ signal.emit(nullptr); });
+        success &= printResult("Signal with 3 handlers", result, 3 * emitCount, calls);
+    }
+
+    {
+        unsigned long long calls = 0;
+        float total = 0;
+        tgui::SignalFloat signal{"SignalFloat"};
+        signal.connect([&calls]{ ++calls; });
+        signal.connect([&calls,&total](float value){ ++calls; total += value; });
+        signal.connect([&calls](float, int extra){ calls += static_cast<unsigned int>(extra); }, 1);
+        const Result result = measureEmits([&signal]{ signal.emit(nullptr, 1.f); });
+        success &= printResult("SignalFloat with 3 handlers", result, 3 * emitCount, calls);
+    }
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2022 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/SvgImage.hpp>
+#include <TGUI/Backend/Renderer/BackendTexture.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Measures how long it takes to rasterize svg images at full screen sizes, with and without splitting the work over threads
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Background with large gradients, similar to what is stretched behind a full screen gui
+    const char* gradientSvg = R"svg(<svg xmlns="http://www.w3.org/2000/svg" width="160" height="90">
+  <defs>
+    <linearGradient id="sky" x1="0" y1="0" x2="0" y2="1">
+      <stop offset="0" stop-color="#1d3557"/><stop offset="1" stop-color="#a8dadc"/>
+    </linearGradient>
+    <radialGradient id="sun" cx="0.5" cy="0.5" r="0.5">
+      <stop offset="0" stop-color="#ffe066"/><stop offset="1" stop-color="#ffe066" stop-opacity="0"/>
+    </radialGradient>
+  </defs>
+  <rect width="160" height="90" fill="url(#sky)"/>
+  <circle cx="120" cy="25" r="20" fill="url(#sun)"/>
+  <path d="M0 70 Q40 40 80 65 T160 60 V90 H0 Z" fill="#2a9d8f"/>
+  <path d="M0 80 Q50 60 100 78 T160 75 V90 H0 Z" fill="#264653"/>
+</svg>)svg";
+
+    // Many small shapes with strokes, which produce a lot of edges
+    std::string createShapesSvg()
+    {
+        std::string svg = R"(<svg xmlns="http://www.w3.org/2000/svg" width="160" height="90">)";
+        for (int y = 0; y < 18; ++y)
+        {
+            for (int x = 0; x < 32; ++x)
+            {
+                svg += "<circle cx=\"" + std::to_string(x * 5 + 2.5) + "\" cy=\"" + std::to_string(y * 5 + 2.5)
+                     + "\" r=\"2\" fill=\"#" + ((x + y) % 2 ? "e63946" : "457b9d") + "\" stroke=\"#1d3557\" stroke-width=\"0.4\"/>";
+            }
+        }
+        svg += "</svg>";
+        return svg;
+    }
+
+    double measureRasterization(tgui::SvgImage& svgImage, tgui::Vector2u size, unsigned int threadCount)
+    {
+        tgui::SvgImage::setMaxRasterizeThreads(threadCount);
+
+        const unsigned int iterations = 5;
+        double bestTime = 0;
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            tgui::BackendTexture texture;
+            const auto startTime = std::chrono::steady_clock::now();
+            svgImage.rasterize(texture, size);
+            const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            if ((i == 0) || (time < bestTime))
+                bestTime = time;
+        }
+
+        return bestTime;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> filenames;
+    for (int i = 1; i < argc; ++i)
+        filenames.emplace_back(argv[i]);
+
+    // Without arguments, the built-in reference images are written to the working directory and used instead
+    if (filenames.empty())
+    {
+        const std::pair<std::string, std::string> referenceImages[] = {
+            {"tgui-benchmark-gradients.svg", gradientSvg},
+            {"tgui-benchmark-shapes.svg", createShapesSvg()}
+        };
+
+        for (const auto& image : referenceImages)
+        {
+            std::ofstream file{image.first};
+            if (!(file << image.second))
+            {
+                std::cerr << "Failed to write '" << image.first << "'." << std::endl;
+                return 1;
+            }
+
+            filenames.push_back(image.first);
+        }
+    }
+
+    const unsigned int defaultThreadCount = tgui::SvgImage::getMaxRasterizeThreads();
+    const std::pair<const char*, tgui::Vector2u> resolutions[] = {
+        {"1080p", {1920, 1080}},
+        {"4K", {3840, 2160}}
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& filename : filenames)
+    {
+        tgui::SvgImage svgImage{filename};
+        if (!svgImage.isSet())
+            return 1;
+
+        for (const auto& resolution : resolutions)
+        {
+            const double singleThreadedTime = measureRasterization(svgImage, resolution.second, 1);
+            const double parallelTime = measureRasterization(svgImage, resolution.second, defaultThreadCount);
+            std::cout << filename << " @ " << resolution.first << ": "
+                      << singleThreadedTime << " ms with 1 thread, "
+                      << parallelTime << " ms with " << defaultThreadCount << " threads ("
+                      << (singleThreadedTime / std::max(parallelTime, 0.001)) << "x)" << std::endl;
+        }
+    }
+
+    return 0;
+}